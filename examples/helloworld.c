@@ -16,7 +16,7 @@ void task_server(void *sched)
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	server = rn_tcp_server(sched, &addr);
+	server = rn_tcp_server(sched, &addr, NULL);
 	while ((client = rn_socket_accept(server, NULL)) != NULL) {
 		rn_task_start(sched, task_client, client);
 	}
@@ -36,7 +36,7 @@ int main()
 	rn_spawn(sched, 10);
 	for (i = 0; i <= 10; i++) {
 		spawn = rn_spawn_get(sched, i);
-		server = rn_tcp_server(spawn, &addr);
+		server = rn_tcp_server(spawn, &addr, NULL);
 		rn_task_start(spawn, task_server, server);
 	}
 	rn_scheduler_loop(sched);
@@ -28,7 +28,7 @@ void process_http_client(void *sched)
 
 	rn_addr4(&addr, "127.0.0.1", port);
 	for (i = 0; i < 10; i++) {
-		socket = rn_tcp_client(sched, &addr, 0);
+		socket = rn_tcp_client(sched, &addr, 0, NULL);
 		if (socket == NULL) {
 			rn_log("Error while creating socket %d: %s", port, strerror(errno));
 			return;
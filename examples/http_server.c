@@ -88,7 +88,7 @@ int main(int argc, char **argv)
 		return -1;
 	}
 	rn_addr4(&addr, "127.0.0.1", atoi(argv[1]));
-	server = rn_tcp_server(master, &addr);
+	server = rn_tcp_server(master, &addr, NULL);
 	if (server == NULL) {
 		rn_log("Could not create server socket on port %s.", argv[1]);
 		rn_scheduler_destroy(master);
@@ -0,0 +1,76 @@
+/**
+ * @file   allocator.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for library allocator hooks
+ *
+ *
+ */
+
+#ifndef RINOO_GLOBAL_ALLOCATOR_H_
+#define RINOO_GLOBAL_ALLOCATOR_H_
+
+typedef struct rn_allocator_s {
+	void *(*malloc)(size_t size);
+	void *(*calloc)(size_t nmemb, size_t size);
+	void *(*realloc)(void *ptr, size_t size);
+	void (*free)(void *ptr);
+	void *(*aligned_alloc)(size_t alignment, size_t size);
+} rn_allocator_t;
+
+typedef struct rn_allocator_stats_s {
+	uint64_t nballoc;
+	uint64_t nbfree;
+	uint64_t bytes;
+} rn_allocator_stats_t;
+
+extern rn_allocator_t rn_allocator;
+extern __thread rn_allocator_stats_t *rn_allocator_stats;
+
+int rn_allocator_set(const rn_allocator_t *allocator);
+rn_allocator_stats_t *rn_allocator_stats_set(rn_allocator_stats_t *stats);
+void *rn_malloc(size_t size);
+void *rn_calloc(size_t nmemb, size_t size);
+void *rn_realloc(void *ptr, size_t oldsize, size_t size);
+void *rn_aligned_alloc(size_t alignment, size_t size);
+void rn_free(void *ptr);
+char *rn_strdup(const char *str);
+
+/**
+ * Accounts an allocation in the current thread statistics.
+ *
+ * @param size Allocation size
+ */
+static inline void rn_allocator_account(size_t size)
+{
+	if (rn_allocator_stats != NULL) {
+		rn_allocator_stats->nballoc++;
+		rn_allocator_stats->bytes += size;
+	}
+}
+
+/**
+ * Accounts a resize in the current thread statistics.
+ *
+ * @param oldsize Previous allocation size
+ * @param size New allocation size
+ */
+static inline void rn_allocator_resize(size_t oldsize, size_t size)
+{
+	if (rn_allocator_stats != NULL) {
+		rn_allocator_stats->bytes += size - oldsize;
+	}
+}
+
+/**
+ * Accounts a release in the current thread statistics.
+ */
+static inline void rn_allocator_release(void)
+{
+	if (rn_allocator_stats != NULL) {
+		rn_allocator_stats->nbfree++;
+	}
+}
+
+#endif /* !RINOO_GLOBAL_ALLOCATOR_H_ */
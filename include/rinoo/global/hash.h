@@ -0,0 +1,25 @@
+/**
+ * @file   hash.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for fast 64-bit hash functions.
+ *
+ *
+ */
+
+#ifndef RINOO_GLOBAL_HASH_H_
+#define RINOO_GLOBAL_HASH_H_
+
+typedef struct rn_hash_key_s {
+	uint64_t seed;
+	uint64_t secret[4];
+} rn_hash_key_t;
+
+uint64_t rn_hash(const void *key, size_t len, uint64_t seed);
+uint64_t rn_hash_u64(uint64_t value, uint64_t seed);
+uint64_t rn_hash_keyed(const void *key, size_t len, const rn_hash_key_t *hkey);
+int rn_hash_key(rn_hash_key_t *hkey);
+uint64_t rn_hash_default(const void *key, size_t len);
+
+#endif /* !RINOO_GLOBAL_HASH_H_ */
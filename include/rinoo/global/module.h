@@ -12,6 +12,7 @@
 #define RINOO_MODULE_GLOBAL_H_
 
 #include <time.h>
+#include <errno.h>
 #include <stdio.h>
 #include <ctype.h>
 #include <stddef.h>
@@ -19,13 +20,18 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
 #include <sys/time.h>
+#include <sys/random.h>
 
 #include "rinoo/debug/module.h"
 
 #include "rinoo/global/macros.h"
 #include "rinoo/global/error.h"
+#include "rinoo/global/allocator.h"
 #include "rinoo/global/utils.h"
 #include "rinoo/global/murmurhash3.h"
+#include "rinoo/global/hash.h"
 
 #endif /* !RINOO_MODULE_GLOBAL_H_ */
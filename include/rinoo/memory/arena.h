@@ -0,0 +1,38 @@
+/**
+ * @file   arena.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Arena allocator structures
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_ARENA_H_
+#define RINOO_MEMORY_ARENA_H_
+
+#define RN_ARENA_ALIGN		16
+#define RN_ARENA_BLKSIZE	(16 * 1024)
+#define RN_ARENA_BUFFER_INISIZE	256
+
+typedef struct rn_arena_block_s {
+	struct rn_arena_block_s *next;
+	size_t size;
+	size_t used;
+	size_t pad;
+} rn_arena_block_t;
+
+typedef struct rn_arena_s {
+	size_t blksize;
+	rn_arena_block_t *head;
+	rn_buffer_class_t class;
+} rn_arena_t;
+
+int rn_arena(rn_arena_t *arena, size_t blksize);
+void rn_arena_destroy(rn_arena_t *arena);
+void rn_arena_reset(rn_arena_t *arena);
+void *rn_arena_alloc(rn_arena_t *arena, size_t size);
+void *rn_arena_realloc(rn_arena_t *arena, void *ptr, size_t oldsize, size_t newsize);
+int rn_buffer_arena(rn_buffer_t *buffer, rn_arena_t *arena);
+
+#endif /* !RINOO_MEMORY_ARENA_H_ */
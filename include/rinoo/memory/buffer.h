@@ -17,6 +17,8 @@ typedef struct rn_buffer_s {
 	void *ptr;
 	size_t size;
 	size_t msize;
+	/* Data erased from the front, ptr - offset is the allocation start */
+	size_t offset;
 	rn_buffer_class_t *class;
 } rn_buffer_t;
 
@@ -26,7 +28,8 @@ typedef struct rn_buffer_s {
 #define rn_buffer_isfull(buffer)		((buffer)->size == (buffer)->msize || (buffer)->msize == 0)
 #define rn_buffer_setsize(buffer, newsize)	do { (buffer)->size = newsize; } while (0)
 #define rn_buffer_set(buffer, str)		do { rn_buffer_static(buffer, (void *)(str), strlen(str)); } while (0)
-#define rn_buffer_reset(buffer)		  	rn_buffer_setsize(buffer, 0)
+#define rn_buffer_reset(buffer)		  	do { if ((buffer)->class->reset != NULL) { (buffer)->class->reset(buffer); } rn_buffer_setsize(buffer, 0); rn_buffer_rewind(buffer); } while (0)
+#define rn_buffer_rewind(buffer)		do { (buffer)->ptr -= (buffer)->offset; if ((buffer)->msize != 0) { (buffer)->msize += (buffer)->offset; } (buffer)->offset = 0; } while (0)
 
 rn_buffer_t *rn_buffer_create(rn_buffer_class_t *class);
 void rn_buffer_static(rn_buffer_t *buffer, void *ptr, size_t size);
@@ -37,8 +40,12 @@ int rn_buffer_vprint(rn_buffer_t *buffer, const char *format, va_list ap);
 int rn_buffer_print(rn_buffer_t *buffer, const char *format, ...);
 int rn_buffer_add(rn_buffer_t *buffer, const char *data, size_t size);
 int rn_buffer_addstr(rn_buffer_t *buffer, const char *str);
+int rn_buffer_addu64(rn_buffer_t *buffer, uint64_t value);
+int rn_buffer_addi64(rn_buffer_t *buffer, int64_t value);
+int rn_buffer_adddouble(rn_buffer_t *buffer, double value);
 int rn_buffer_addnull(rn_buffer_t *buf);
 int rn_buffer_erase(rn_buffer_t *buffer, size_t size);
+void rn_buffer_compact(rn_buffer_t *buffer);
 rn_buffer_t *rn_buffer_dup(rn_buffer_t *buffer);
 int rn_buffer_cmp(rn_buffer_t *buffer1, rn_buffer_t *buffer2);
 int rn_buffer_casecmp(rn_buffer_t *buffer1, rn_buffer_t *buffer2);
@@ -50,7 +57,14 @@ long int rn_buffer_tolong(rn_buffer_t *buffer, size_t *len, int base);
 unsigned long int rn_buffer_toulong(rn_buffer_t *buffer, size_t *len, int base);
 float rn_buffer_tofloat(rn_buffer_t *buffer, size_t *len);
 double rn_buffer_todouble(rn_buffer_t *buffer, size_t *len);
+uint64_t rn_buffer_tou64(rn_buffer_t *buffer, size_t *len);
+int64_t rn_buffer_toi64(rn_buffer_t *buffer, size_t *len);
 char *rn_buffer_tostr(rn_buffer_t *buffer);
 int rn_buffer_b64encode(rn_buffer_t *dst, rn_buffer_t *src);
+int rn_buffer_b64urlencode(rn_buffer_t *dst, rn_buffer_t *src);
+int rn_buffer_b64decode(rn_buffer_t *dst, rn_buffer_t *src);
+int rn_buffer_b64urldecode(rn_buffer_t *dst, rn_buffer_t *src);
+int rn_buffer_hexencode(rn_buffer_t *dst, rn_buffer_t *src);
+int rn_buffer_hexdecode(rn_buffer_t *dst, rn_buffer_t *src);
 
 #endif /* !RINOO_MEMORY_BUFFER_H_ */
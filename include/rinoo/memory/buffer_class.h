@@ -21,6 +21,8 @@ typedef struct rn_buffer_class_s {
 	void *(*malloc)(struct rn_buffer_s *buffer, size_t size);
 	void *(*realloc)(struct rn_buffer_s *buffer, size_t newsize);
 	int (*free)(struct rn_buffer_s *buffer);
+	/* Optional, called by rn_buffer_reset before the buffer is emptied */
+	void (*reset)(struct rn_buffer_s *buffer);
 } rn_buffer_class_t;
 
 #endif /* !RINOO_MEMORY_BUFFER_CLASS_H_ */
@@ -0,0 +1,25 @@
+/**
+ * @file   buffer_map.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for mapped buffer class
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_BUFFER_MAP_H_
+#define RINOO_MEMORY_BUFFER_MAP_H_
+
+/* Default buffers switch to mapped memory past this size */
+#define RN_BUFFER_MAP_THRESHOLD	(1024 * 1024)
+/* Memory kept resident when a mapped buffer is reset */
+#define RN_BUFFER_MAP_KEEP	(256 * 1024)
+#define RN_BUFFER_MAP_HUGEPAGE	(2 * 1024 * 1024)
+
+rn_buffer_class_t *rn_buffer_map_class(void);
+bool rn_buffer_ismapped(rn_buffer_t *buffer);
+void *rn_buffer_map_migrate(rn_buffer_t *buffer, size_t newsize);
+void rn_buffer_map_sethugepage(bool enabled);
+
+#endif /* !RINOO_MEMORY_BUFFER_MAP_H_ */
@@ -0,0 +1,39 @@
+/**
+ * @file   buffer_pool.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Pooled buffer class structures
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_BUFFER_POOL_H_
+#define RINOO_MEMORY_BUFFER_POOL_H_
+
+#define RN_BUFFER_POOL_MINSHIFT		10
+#define RN_BUFFER_POOL_NB_CLASSES	8
+#define RN_BUFFER_POOL_MAXSIZE		(1UL << (RN_BUFFER_POOL_MINSHIFT + RN_BUFFER_POOL_NB_CLASSES - 1))
+#define RN_BUFFER_POOL_MAXFREE		64
+
+typedef struct rn_buffer_pool_block_s {
+	struct rn_buffer_pool_block_s *next;
+} rn_buffer_pool_block_t;
+
+typedef struct rn_buffer_pool_s {
+	size_t nbfree[RN_BUFFER_POOL_NB_CLASSES];
+	rn_buffer_pool_block_t *free[RN_BUFFER_POOL_NB_CLASSES];
+	/* Memory blocks currently held by buffers */
+	size_t nbused;
+	size_t nbbuffers;
+	rn_buffer_pool_block_t *buffers;
+	rn_buffer_class_t class;
+} rn_buffer_pool_t;
+
+int rn_buffer_pool(rn_buffer_pool_t *pool);
+void rn_buffer_pool_destroy(rn_buffer_pool_t *pool);
+rn_buffer_t *rn_buffer_pool_get(rn_buffer_pool_t *pool);
+void rn_buffer_pool_put(rn_buffer_t *buffer);
+void rn_buffer_pool_release(rn_buffer_t *buffer);
+
+#endif /* !RINOO_MEMORY_BUFFER_POOL_H_ */
@@ -0,0 +1,27 @@
+/**
+ * @file   buffer_shared.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Reference-counted immutable buffer structures
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_BUFFER_SHARED_H_
+#define RINOO_MEMORY_BUFFER_SHARED_H_
+
+typedef struct rn_buffer_shared_s {
+	unsigned int refcount;
+	size_t size;
+} rn_buffer_shared_t;
+
+#define rn_buffer_unref(buffer)		rn_buffer_destroy(buffer)
+
+rn_buffer_t *rn_buffer_shared(const void *data, size_t size);
+bool rn_buffer_isshared(rn_buffer_t *buffer);
+rn_buffer_t *rn_buffer_ref(rn_buffer_t *buffer);
+rn_buffer_t *rn_buffer_slice(rn_buffer_t *buffer, size_t offset, size_t size);
+unsigned int rn_buffer_refcount(rn_buffer_t *buffer);
+
+#endif /* !RINOO_MEMORY_BUFFER_SHARED_H_ */
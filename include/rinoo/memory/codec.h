@@ -0,0 +1,30 @@
+/**
+ * @file   codec.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for base64 and hex codecs
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_CODEC_H_
+#define RINOO_MEMORY_CODEC_H_
+
+/* Maximum output sizes */
+#define RN_B64_ENCLEN(size)	((((size) + 2) / 3) * 4)
+#define RN_B64_DECLEN(size)	((((size) + 3) / 4) * 3)
+#define RN_HEX_ENCLEN(size)	((size) * 2)
+#define RN_HEX_DECLEN(size)	((size) / 2)
+
+typedef enum rn_b64_mode_e {
+	RN_B64_STD = 0,
+	RN_B64_URL
+} rn_b64_mode_t;
+
+size_t rn_b64_encode(char *dst, const void *src, size_t size, rn_b64_mode_t mode);
+ssize_t rn_b64_decode(void *dst, const char *src, size_t size, rn_b64_mode_t mode);
+size_t rn_hex_encode(char *dst, const void *src, size_t size);
+ssize_t rn_hex_decode(void *dst, const char *src, size_t size);
+
+#endif /* !RINOO_MEMORY_CODEC_H_ */
@@ -0,0 +1,47 @@
+/**
+ * @file   iobuf.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Chained segment buffer structures
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_IOBUF_H_
+#define RINOO_MEMORY_IOBUF_H_
+
+#define RN_IOBUF_SEGSIZE	(64 * 1024)
+
+typedef struct rn_iobuf_seg_s {
+	struct rn_iobuf_seg_s *next;
+	size_t start;
+	size_t end;
+	size_t msize;
+} rn_iobuf_seg_t;
+
+typedef struct rn_iobuf_s {
+	size_t size;
+	size_t nbsegs;
+	rn_iobuf_seg_t *head;
+	rn_iobuf_seg_t *tail;
+	rn_iobuf_seg_t *spare;
+} rn_iobuf_t;
+
+#define rn_iobuf_size(iobuf)		((iobuf)->size)
+#define rn_iobuf_seg_data(seg)		((char *) (seg) + sizeof(rn_iobuf_seg_t))
+#define rn_iobuf_seg_ptr(seg)		(rn_iobuf_seg_data(seg) + (seg)->start)
+#define rn_iobuf_seg_size(seg)		((seg)->end - (seg)->start)
+
+int rn_iobuf(rn_iobuf_t *iobuf);
+void rn_iobuf_destroy(rn_iobuf_t *iobuf);
+rn_iobuf_seg_t *rn_iobuf_seg(rn_iobuf_t *iobuf);
+void rn_iobuf_append(rn_iobuf_t *iobuf, rn_iobuf_seg_t *seg);
+int rn_iobuf_add(rn_iobuf_t *iobuf, const char *data, size_t size);
+int rn_iobuf_addb(rn_iobuf_t *iobuf, rn_buffer_t *buffer);
+int rn_iobuf_erase(rn_iobuf_t *iobuf, size_t size);
+int rn_iobuf_truncate(rn_iobuf_t *iobuf, size_t size);
+int rn_iobuf_views(rn_iobuf_seg_t **from, rn_buffer_t *views, int count);
+int rn_iobuf_flatten(rn_iobuf_t *iobuf, rn_buffer_t *buffer);
+
+#endif /* !RINOO_MEMORY_IOBUF_H_ */
@@ -17,12 +17,25 @@
 #include <stdbool.h>
 #include <arpa/inet.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
 
 #include "rinoo/global/macros.h"
+#include "rinoo/global/allocator.h"
 
+#include "rinoo/memory/slab.h"
+#include "rinoo/memory/scan.h"
+#include "rinoo/memory/codec.h"
+#include "rinoo/memory/number.h"
 #include "rinoo/memory/buffer_class.h"
 #include "rinoo/memory/buffer.h"
 #include "rinoo/memory/buffer_helper.h"
 #include "rinoo/memory/buffer_iterator.h"
+#include "rinoo/memory/buffer_pool.h"
+#include "rinoo/memory/buffer_shared.h"
+#include "rinoo/memory/buffer_map.h"
+#include "rinoo/memory/arena.h"
+#include "rinoo/memory/iobuf.h"
 
 #endif /* !RINOO_MODULE_MEMORY_H_ */
@@ -0,0 +1,29 @@
+/**
+ * @file   number.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for number formatting and parsing
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_NUMBER_H_
+#define RINOO_MEMORY_NUMBER_H_
+
+/* Maximum output sizes */
+#define RN_U64TOA_MAX	20
+#define RN_I64TOA_MAX	21
+#define RN_DTOA_MAX	32
+
+size_t rn_u64toa(char *dst, uint64_t value);
+size_t rn_i64toa(char *dst, int64_t value);
+size_t rn_dtoa(char *dst, double value);
+size_t rn_atou64(const char *ptr, size_t size, uint64_t *value);
+size_t rn_atoi64(const char *ptr, size_t size, int64_t *value);
+size_t rn_strntol(const char *ptr, size_t size, int base, long int *value);
+size_t rn_strntoul(const char *ptr, size_t size, int base, unsigned long int *value);
+size_t rn_strntof(const char *ptr, size_t size, float *value);
+size_t rn_strntod(const char *ptr, size_t size, double *value);
+
+#endif /* !RINOO_MEMORY_NUMBER_H_ */
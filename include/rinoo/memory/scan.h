@@ -0,0 +1,32 @@
+/**
+ * @file   scan.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for byte scanning and comparison kernels
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_SCAN_H_
+#define RINOO_MEMORY_SCAN_H_
+
+#define RN_SCAN_SET_MAX	16
+
+typedef enum rn_scan_level_e {
+	RN_SCAN_SCALAR = 0,
+	RN_SCAN_SSE42,
+	RN_SCAN_AVX2,
+	RN_SCAN_AUTO
+} rn_scan_level_t;
+
+#define rn_scan_crlf(ptr, size)		rn_scan_mem(ptr, size, "\r\n", 2)
+#define rn_scan_crlfcrlf(ptr, size)	rn_scan_mem(ptr, size, "\r\n\r\n", 4)
+
+rn_scan_level_t rn_scan_level(void);
+rn_scan_level_t rn_scan_setlevel(rn_scan_level_t level);
+void *rn_scan_mem(const void *ptr, size_t size, const void *delim, size_t dlen);
+size_t rn_scan_set(const void *ptr, size_t size, const char *set);
+int rn_scan_casecmp(const void *ptr1, const void *ptr2, size_t size);
+
+#endif /* !RINOO_MEMORY_SCAN_H_ */
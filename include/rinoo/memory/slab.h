@@ -0,0 +1,60 @@
+/**
+ * @file   slab.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Slab allocator structures
+ *
+ *
+ */
+
+#ifndef RINOO_MEMORY_SLAB_H_
+#define RINOO_MEMORY_SLAB_H_
+
+#define RN_SLAB_MINSHIFT	5
+#define RN_SLAB_NB_CLASSES	8
+#define RN_SLAB_MAXSIZE		(1UL << (RN_SLAB_MINSHIFT + RN_SLAB_NB_CLASSES - 1))
+#define RN_SLAB_CHUNK_SIZE	(64 * 1024)
+#define RN_SLAB_HDRSIZE		offsetof(rn_slab_obj_t, next)
+
+struct rn_slab_s;
+
+typedef struct rn_slab_obj_s {
+	struct rn_slab_s *slab;
+	size_t class;
+	/* Only valid while the object sits in a free list */
+	struct rn_slab_obj_s *next;
+} rn_slab_obj_t;
+
+typedef struct rn_slab_chunk_s {
+	struct rn_slab_chunk_s *next;
+	size_t size;
+} rn_slab_chunk_t;
+
+typedef struct rn_slab_class_s {
+	size_t size;
+	size_t nbused;
+	rn_slab_obj_t *free;
+} rn_slab_class_t;
+
+typedef struct rn_slab_s {
+	pthread_t owner;
+	size_t nbchunks;
+	rn_slab_chunk_t *chunks;
+	rn_slab_obj_t *remote;
+	/* Live objects of a destroyed slab, released along with the last one */
+	size_t nborphans;
+	/* Classes served by the slab, other allocations fall back to rn_malloc */
+	size_t nbclasses;
+	rn_slab_class_t classes[RN_SLAB_NB_CLASSES];
+} rn_slab_t;
+
+int rn_slab(rn_slab_t *slab);
+void rn_slab_destroy(rn_slab_t *slab);
+void rn_slab_owner(rn_slab_t *slab);
+void rn_slab_reclaim(rn_slab_t *slab);
+void *rn_slab_alloc(rn_slab_t *slab, size_t size);
+void *rn_slab_calloc(rn_slab_t *slab, size_t size);
+void rn_slab_free(void *ptr);
+
+#endif /* !RINOO_MEMORY_SLAB_H_ */
@@ -23,11 +23,15 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/sendfile.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <openssl/ssl.h>
 #include <openssl/pem.h>
 #include <openssl/conf.h>
 #include <openssl/x509v3.h>
 #include <openssl/err.h>
+#include <openssl/rand.h>
+#include <openssl/core_names.h>
 
 #include "rinoo/global/module.h"
 #include "rinoo/memory/module.h"
@@ -42,5 +46,7 @@
 #include "rinoo/net/tcp.h"
 #include "rinoo/net/udp.h"
 #include "rinoo/net/ssl.h"
+#include "rinoo/net/ssl_cache.h"
+#include "rinoo/net/tcp_pool.h"
 
 #endif /* !RINOO_MODULE_NET_H_ */
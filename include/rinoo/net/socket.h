@@ -12,9 +12,17 @@
 #define RINOO_NET_SOCKET_H_
 
 #define MAX_IO_CALLS	10
+/* Segments per writev call for chained buffers, views live on the task stack */
+#define RN_SOCKET_WRITEIO_MAX	16
+/* Datagrams per recvmmsg/sendmmsg call, message headers live on the task stack */
+#define RN_SOCKET_MMSG_MAX	16
+
+/* Socket flags */
+#define RN_SOCKET_CORKED	0x01
 
 typedef struct rn_socket_s {
 	int io_calls;
+	unsigned int flags;
 	rn_sched_node_t node;
 	struct rn_socket_s *parent;
 	const rn_socket_class_t *class;
@@ -26,6 +34,33 @@ typedef union rn_addr_u {
 	struct sockaddr_in6 v6;
 } rn_addr_t;
 
+typedef struct rn_dgram_s {
+	void *buf;
+	size_t size;
+	size_t len;
+	uint16_t segment;
+	/* Datagram was larger than size, only size bytes were received */
+	bool truncated;
+	rn_addr_t addr;
+} rn_dgram_t;
+
+/* Socket options, zero means system default */
+typedef struct rn_socket_opts_s {
+	bool nodelay;
+	bool cork;
+	bool keepalive;
+	int keepidle;
+	int keepintvl;
+	int keepcnt;
+	/* Queue length on listening sockets, any positive value enables it on clients */
+	int fastopen;
+	/* Seconds, listening sockets only */
+	int defer_accept;
+	int notsent_lowat;
+	int sndbuf;
+	int rcvbuf;
+} rn_socket_opts_t;
+
 #define IS_IPV4(addr)			((addr)->sa.sa_family == AF_INET)
 #define IS_IPV6(addr)			((addr)->sa.sa_family == AF_INET6)
 #define rn_addr_getip(addr, dst, len)	(inet_ntop((addr)->sa.sa_family, (addr), (dst), (len)))
@@ -43,22 +78,31 @@ void rn_socket_destroy(rn_socket_t *socket);
 int rn_socket_resume(rn_socket_t *socket);
 int rn_socket_release(rn_socket_t *socket);
 int rn_socket_waitin(rn_socket_t *socket);
+int rn_socket_waitdata(rn_socket_t *socket);
 int rn_socket_waitout(rn_socket_t *socket);
 int rn_socket_waitio(rn_socket_t *socket);
 int rn_socket_timeout(rn_socket_t *socket, uint32_t ms);
+int rn_socket_setopt(rn_socket_t *socket, const rn_socket_opts_t *opts);
+int rn_socket_flush(rn_socket_t *socket);
 
 int rn_socket_connect(rn_socket_t *socket, const rn_addr_t *dst);
 int rn_socket_bind(rn_socket_t *socket, const rn_addr_t *dst, int backlog);
 rn_socket_t *rn_socket_accept(rn_socket_t *socket, rn_addr_t *from);
 ssize_t rn_socket_read(rn_socket_t *socket, void *buf, size_t count);
+ssize_t rn_socket_readv(rn_socket_t *socket, const struct iovec *iov, int count);
 ssize_t rn_socket_recvfrom(rn_socket_t *socket, void *buf, size_t count, rn_addr_t *from);
+int rn_socket_recvmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count);
 ssize_t rn_socket_write(rn_socket_t *socket, const void *buf, size_t count);
 ssize_t rn_socket_writev(rn_socket_t *socket, rn_buffer_t **buffers, int count);
 ssize_t rn_socket_sendto(rn_socket_t *socket, void *buf, size_t count, const rn_addr_t *dst);
+int rn_socket_sendmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count);
 ssize_t rn_socket_readb(rn_socket_t *socket, rn_buffer_t *buffer);
 ssize_t rn_socket_readline(rn_socket_t *socket, rn_buffer_t *buffer, const char *delim, size_t maxsize);
 ssize_t rn_socket_expect(rn_socket_t *socket, rn_buffer_t *buffer, const char *expected);
 ssize_t rn_socket_writeb(rn_socket_t *socket, rn_buffer_t *buffer);
 ssize_t rn_socket_sendfile(rn_socket_t *socket, int in_fd, off_t offset, size_t count);
+ssize_t rn_socket_sendfile_mmap(rn_socket_t *socket, int in_fd, off_t offset, size_t count);
+ssize_t rn_socket_readio(rn_socket_t *socket, rn_iobuf_t *iobuf);
+ssize_t rn_socket_writeio(rn_socket_t *socket, rn_iobuf_t *iobuf);
 
 #endif /* !RINOO_NET_SOCKET_H_ */
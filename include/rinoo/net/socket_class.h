@@ -12,6 +12,7 @@
 #define RINOO_NET_SOCKET_CLASS_H_
 
 struct rn_socket_s;
+struct rn_dgram_s;
 union rn_addr_u;
 
 typedef struct rn_socket_class_s {
@@ -23,10 +24,14 @@ typedef struct rn_socket_class_s {
 	struct rn_socket_s *(*dup)(rn_sched_t *destination, struct rn_socket_s *socket);
 	int (*close)(struct rn_socket_s *socket);
 	ssize_t (*read)(struct rn_socket_s *socket, void *buf, size_t count);
+	ssize_t (*readv)(struct rn_socket_s *socket, const struct iovec *iov, int count);
+	int (*pending)(struct rn_socket_s *socket);
 	ssize_t (*recvfrom)(struct rn_socket_s *socket, void *buf, size_t count, union rn_addr_u *from);
+	int (*recvmmsg)(struct rn_socket_s *socket, struct rn_dgram_s *dgrams, unsigned int count);
 	ssize_t (*write)(struct rn_socket_s *socket, const void *buf, size_t count);
 	ssize_t (*writev)(struct rn_socket_s *socket, rn_buffer_t **buffers, int count);
 	ssize_t (*sendto)(struct rn_socket_s *socket, void *buf, size_t count, const union rn_addr_u *dst);
+	int (*sendmmsg)(struct rn_socket_s *socket, struct rn_dgram_s *dgrams, unsigned int count);
 	ssize_t (*sendfile)(struct rn_socket_s *socket, int in_fd, off_t offset, size_t count);
 	int (*connect)(struct rn_socket_s *socket, const union rn_addr_u *dst);
 	int (*bind)(struct rn_socket_s *socket, const union rn_addr_u *dst, int backlog);
@@ -17,6 +17,7 @@ int rn_socket_class_tcp_open(rn_socket_t *sock);
 rn_socket_t *rn_socket_class_tcp_dup(rn_sched_t *destination, rn_socket_t *socket);
 int rn_socket_class_tcp_close(rn_socket_t *socket);
 ssize_t rn_socket_class_tcp_read(rn_socket_t *socket, void *buf, size_t count);
+ssize_t rn_socket_class_tcp_readv(rn_socket_t *socket, const struct iovec *iov, int count);
 ssize_t rn_socket_class_tcp_recvfrom(rn_socket_t *socket, void *buf, size_t count, rn_addr_t *from);
 ssize_t rn_socket_class_tcp_write(rn_socket_t *socket, const void *buf, size_t count);
 ssize_t rn_socket_class_tcp_writev(rn_socket_t *socket, rn_buffer_t **buffers, int count);
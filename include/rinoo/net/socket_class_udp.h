@@ -18,9 +18,11 @@ rn_socket_t *rn_socket_class_udp_dup(rn_sched_t *destination, rn_socket_t *socke
 int rn_socket_class_udp_close(rn_socket_t *socket);
 ssize_t rn_socket_class_udp_read(rn_socket_t *socket, void *buf, size_t count);
 ssize_t rn_socket_class_udp_recvfrom(rn_socket_t *socket, void *buf, size_t count, rn_addr_t *from);
+int rn_socket_class_udp_recvmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count);
 ssize_t rn_socket_class_udp_write(rn_socket_t *socket, const void *buf, size_t count);
 ssize_t rn_socket_class_udp_writev(rn_socket_t *socket, rn_buffer_t **buffers, int count);
 ssize_t rn_socket_class_udp_sendto(rn_socket_t *socket, void *buf, size_t count, const rn_addr_t *dst);
+int rn_socket_class_udp_sendmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count);
 ssize_t rn_socket_class_udp_sendfile(rn_socket_t *socket, int in_fd, off_t offset, size_t count);
 int rn_socket_class_udp_connect(rn_socket_t *socket, const rn_addr_t *dst);
 int rn_socket_class_udp_bind(rn_socket_t *socket, const rn_addr_t *dst, int backlog);
@@ -11,14 +11,47 @@
 #ifndef RINOO_NET_SSL_H_
 #define RINOO_NET_SSL_H_
 
+#define RN_SSL_HANDSHAKE_TIMEOUT	10000
+
+/*
+ * Dynamic record sizing: records gathered by writev fit in one TCP
+ * segment until RN_SSL_RECORD_BOOST bytes are sent, then grow to the
+ * TLS maximum. Plain writes only use small records for the first
+ * flight (initial congestion window of 10 segments).
+ * Small records come back once the connection has been idle.
+ */
+#define RN_SSL_RECORD_SMALL	1400
+#define RN_SSL_RECORD_MAX	16384
+#define RN_SSL_RECORD_BOOST	(1024 * 1024)
+#define RN_SSL_RECORD_FLIGHT	(10 * RN_SSL_RECORD_SMALL)
+#define RN_SSL_RECORD_IDLE	1000
+
+/* Kernel TLS offload, set once the handshake is done */
+#define RN_SSL_KTLS_TX		0x01
+#define RN_SSL_KTLS_RX		0x02
+/* Handshake not done yet, run at first I/O */
+#define RN_SSL_HANDSHAKE	0x04
+
+/* Defined in ssl_cache.h */
+struct rn_ssl_cache_s;
+
 typedef struct rn_ssl_ctx_s {
 	X509 *x509;
 	EVP_PKEY *pkey;
 	SSL_CTX *ctx;
+	/* Handshake time limit in milliseconds, 0 for none */
+	uint32_t handshake_timeout;
+	struct rn_ssl_cache_s *cache;
 } rn_ssl_ctx_t;
 
 typedef struct rn_ssl_s {
 	SSL *ssl;
+	unsigned int flags;
+	/* Bytes sent since the connection start or last idle period */
+	size_t sent;
+	struct timeval last;
+	/* Gathers small buffers into one record, only allocated during writev */
+	char *record;
 	rn_ssl_ctx_t *ctx;
 	rn_socket_t socket;
 } rn_ssl_t;
@@ -28,6 +61,7 @@ rn_ssl_ctx_t *rn_ssl_context(unsigned short keysize);
 rn_ssl_ctx_t *rn_ssl_context_load(const char *cert_file, const char *key_file);
 void rn_ssl_context_destroy(rn_ssl_ctx_t *ctx);
 rn_ssl_t *rn_ssl_get(rn_socket_t *socket);
+int rn_ssl_handshake(rn_socket_t *socket);
 rn_socket_t *rn_ssl_client(rn_sched_t *sched, rn_ssl_ctx_t *ctx, rn_addr_t *dst, uint32_t timeout);
 rn_socket_t *rn_ssl_server(rn_sched_t *sched, rn_ssl_ctx_t *ctx, rn_addr_t *dst);
 
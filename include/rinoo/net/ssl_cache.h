@@ -0,0 +1,70 @@
+/**
+ * @file   ssl_cache.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for TLS session cache shared between schedulers
+ *
+ *
+ */
+
+#ifndef RINOO_NET_SSL_CACHE_H_
+#define RINOO_NET_SSL_CACHE_H_
+
+#define RN_SSL_CACHE_SIZE	20480
+/* Session lifetime, in seconds */
+#define RN_SSL_CACHE_TIMEOUT	300
+/* Ticket key rotation period, in seconds */
+#define RN_SSL_TICKET_ROTATION	3600
+#define RN_SSL_TICKET_NAME	16
+#define RN_SSL_TICKET_KEY	32
+
+typedef struct rn_ssl_stats_s {
+	/* Completed handshakes */
+	uint64_t handshakes;
+	/* Handshakes which resumed a session */
+	uint64_t resumed;
+	/* Server session lookups */
+	uint64_t hits;
+	uint64_t misses;
+} rn_ssl_stats_t;
+
+typedef struct rn_ssl_ticket_key_s {
+	unsigned char name[RN_SSL_TICKET_NAME];
+	unsigned char aes[RN_SSL_TICKET_KEY];
+	unsigned char hmac[RN_SSL_TICKET_KEY];
+} rn_ssl_ticket_key_t;
+
+typedef struct rn_ssl_session_s {
+	unsigned int keylen;
+	unsigned char key[SSL_MAX_SSL_SESSION_ID_LENGTH];
+	SSL_SESSION *session;
+	rn_hmap_node_t node;
+	rn_list_node_t lnode;
+} rn_ssl_session_t;
+
+typedef struct rn_ssl_cache_s {
+	pthread_mutex_t mutex;
+	size_t size;
+	uint32_t timeout;
+	uint32_t rotation;
+	time_t rotated;
+	/* Current key first, then the previous one until next rotation */
+	unsigned int nbkeys;
+	rn_ssl_ticket_key_t keys[2];
+	/* Server sessions by id, client sessions by destination */
+	rn_hmap_t sessions;
+	rn_list_t sessions_lru;
+	rn_hmap_t peers;
+	rn_list_t peers_lru;
+	rn_ssl_stats_t stats;
+} rn_ssl_cache_t;
+
+rn_ssl_cache_t *rn_ssl_cache(size_t size, uint32_t timeout, uint32_t rotation);
+void rn_ssl_cache_destroy(rn_ssl_cache_t *cache);
+int rn_ssl_context_cache(rn_ssl_ctx_t *ctx, rn_ssl_cache_t *cache);
+void rn_ssl_cache_stats(rn_ssl_cache_t *cache, rn_ssl_stats_t *stats);
+void rn_ssl_cache_resume(rn_ssl_cache_t *cache, SSL *ssl, const rn_addr_t *dst);
+void rn_ssl_cache_account(rn_ssl_cache_t *cache, SSL *ssl);
+
+#endif /* !RINOO_NET_SSL_CACHE_H_ */
@@ -13,7 +13,7 @@
 
 #define RN_TCP_BACKLOG	128
 
-rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout);
-rn_socket_t *rn_tcp_server(rn_sched_t *sched, rn_addr_t *dst);
+rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout, const rn_socket_opts_t *opts);
+rn_socket_t *rn_tcp_server(rn_sched_t *sched, rn_addr_t *dst, const rn_socket_opts_t *opts);
 
 #endif /* !RINOO_NET_TCP_H_ */
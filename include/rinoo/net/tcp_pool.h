@@ -0,0 +1,60 @@
+/**
+ * @file   tcp_pool.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for TCP connection pool
+ *
+ *
+ */
+
+#ifndef RINOO_NET_TCP_POOL_H_
+#define RINOO_NET_TCP_POOL_H_
+
+#define RN_TCP_POOL_MAX_IDLE		8
+#define RN_TCP_POOL_MAX_TOTAL		64
+#define RN_TCP_POOL_IDLE_TIMEOUT	30000
+
+/* Defined below */
+struct rn_tcp_pool_s;
+
+typedef struct rn_tcp_pool_host_s {
+	rn_addr_t addr;
+	unsigned int nbtotal;
+	/* Waiters are served in ticket order */
+	uint64_t ticket;
+	rn_list_t idle;
+	rn_list_t waiters;
+	rn_hmap_node_t node;
+	struct rn_tcp_pool_s *pool;
+} rn_tcp_pool_host_t;
+
+typedef struct rn_tcp_conn_s {
+	rn_socket_t *socket;
+	struct timeval expire;
+	rn_list_node_t hnode;
+	rn_list_node_t pnode;
+	rn_tcp_pool_host_t *host;
+} rn_tcp_conn_t;
+
+typedef struct rn_tcp_pool_s {
+	rn_sched_t *sched;
+	/* Connect timeout in milliseconds, 0 for none */
+	uint32_t timeout;
+	uint32_t idle_timeout;
+	unsigned int max_idle;
+	unsigned int max_total;
+	const rn_socket_opts_t *opts;
+	/* Connections use TLS when set */
+	rn_ssl_ctx_t *ssl;
+	rn_hmap_t hosts;
+	rn_list_t idle;
+	rn_task_t *reaper;
+} rn_tcp_pool_t;
+
+rn_tcp_pool_t *rn_tcp_pool(rn_sched_t *sched, unsigned int max_idle, unsigned int max_total, uint32_t idle_timeout);
+void rn_tcp_pool_destroy(rn_tcp_pool_t *pool);
+rn_tcp_conn_t *rn_tcp_pool_get(rn_tcp_pool_t *pool, const rn_addr_t *dst);
+void rn_tcp_pool_put(rn_tcp_conn_t *conn, bool reuse);
+
+#endif /* !RINOO_NET_TCP_POOL_H_ */
@@ -11,6 +11,25 @@
 #ifndef RINOO_NET_UDP_H_
 #define RINOO_NET_UDP_H_
 
+/* Default receive buffer size per datagram, larger datagrams are truncated */
+#define RN_UDP_DGRAM_SIZE	2048
+
+typedef void (*rn_udp_handler_t)(rn_socket_t *socket, rn_dgram_t *dgram, void *arg);
+
+typedef struct rn_udp_context_s {
+	void *arg;
+	rn_socket_t *socket;
+	rn_udp_handler_t handler;
+	size_t size;
+	rn_dgram_t dgrams[RN_SOCKET_MMSG_MAX];
+	/* RN_SOCKET_MMSG_MAX receive buffers of size bytes */
+	char bufs[];
+} rn_udp_context_t;
+
 rn_socket_t *rn_udp_client(rn_sched_t *sched, rn_addr_t *dst);
+rn_socket_t *rn_udp_server(rn_sched_t *sched, rn_addr_t *dst);
+int rn_udp_server_start(rn_sched_t *sched, rn_addr_t *dst, size_t size, rn_udp_handler_t handler, void *arg);
+int rn_udp_server_spawn(rn_sched_t *sched, rn_addr_t *dst, size_t size, rn_udp_handler_t handler, void *arg);
+int rn_udp_gro(rn_socket_t *socket, bool enabled);
 
 #endif /* !RINOO_NET_UDP_H_ */
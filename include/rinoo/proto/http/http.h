@@ -24,10 +24,14 @@ typedef struct rn_http_s {
 	rn_http_version_t version;
 	rn_http_request_t request;
 	rn_http_response_t response;
+	/* Per request memory, released by rn_http_reset */
+	rn_arena_t arena;
 } rn_http_t;
 
 int rn_http_init(rn_socket_t *socket, rn_http_t *http);
 void rn_http_destroy(rn_http_t *http);
 void rn_http_reset(rn_http_t *http);
+int rn_http_body_get(rn_http_t *http, rn_buffer_t *buffer, size_t offset, size_t length, rn_iobuf_t *body);
+int rn_http_body_send(rn_http_t *http, rn_buffer_t *buffer, rn_iobuf_t *body);
 
 #endif /* !RINOO_PROTO_HTTP_H_ */
@@ -28,8 +28,11 @@ typedef enum rn_http_method_e {
 
 typedef struct rn_http_request_s {
 	rn_buffer_t uri;
+	/* URI without query string nor fragment */
+	rn_buffer_t path;
 	rn_buffer_t content;
 	rn_buffer_t *buffer;
+	rn_iobuf_t *body;
 	rn_http_method_t method;
 	rn_http_header_set_t headers;
 } rn_http_request_t;
@@ -38,5 +41,6 @@ int rn_http_request_parse(struct rn_http_s *http);
 bool rn_http_request_get(struct rn_http_s *http);
 void rn_http_request_setdefaultheaders(struct rn_http_s *http);
 int rn_http_request_send(struct rn_http_s *http, rn_http_method_t method, const char *uri, rn_buffer_t *body);
+int rn_http_request_send_iobuf(struct rn_http_s *http, rn_http_method_t method, const char *uri, rn_iobuf_t *body);
 
 #endif /* !RINOO_PROTO_HTTP_REQUEST_H_ */
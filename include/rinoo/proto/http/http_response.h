@@ -19,6 +19,7 @@ typedef struct rn_http_response_s {
 	rn_buffer_t msg;
 	rn_buffer_t content;
 	rn_buffer_t *buffer;
+	rn_iobuf_t *body;
 	rn_http_header_set_t headers;
 } rn_http_response_t;
 
@@ -29,5 +30,6 @@ void rn_http_response_setdefaultmsg(struct rn_http_s *http);
 void rn_http_response_setdefaultheaders(struct rn_http_s *http);
 int rn_http_response_prepare(struct rn_http_s *http, size_t body_length);
 int rn_http_response_send(struct rn_http_s *http, rn_buffer_t *body);
+int rn_http_response_send_iobuf(struct rn_http_s *http, rn_iobuf_t *body);
 
 #endif /* !RINOO_PROTO_HTTP_RESPONSE_H_ */
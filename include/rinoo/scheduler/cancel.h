@@ -0,0 +1,26 @@
+/**
+ * @file   cancel.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Header file for task cancellation tokens.
+ *
+ *
+ */
+
+#ifndef RINOO_SCHEDULER_CANCEL_H_
+#define RINOO_SCHEDULER_CANCEL_H_
+
+typedef struct rn_cancel_s {
+	bool cancelled;
+	rn_list_t tasks;
+} rn_cancel_t;
+
+int rn_cancel(rn_cancel_t *cancel);
+void rn_cancel_destroy(rn_cancel_t *cancel);
+int rn_cancel_attach(rn_cancel_t *cancel, rn_task_t *task);
+void rn_cancel_detach(rn_task_t *task);
+void rn_cancel_trigger(rn_cancel_t *cancel);
+bool rn_cancel_triggered(rn_cancel_t *cancel);
+
+#endif /* !RINOO_SCHEDULER_CANCEL_H_ */
@@ -21,9 +21,11 @@
 
 #include "rinoo/debug/module.h"
 #include "rinoo/global/module.h"
+#include "rinoo/memory/module.h"
 #include "rinoo/struct/module.h"
 
 #include "rinoo/scheduler/task.h"
+#include "rinoo/scheduler/cancel.h"
 #include "rinoo/scheduler/node.h"
 #include "rinoo/scheduler/epoll.h"
 #include "rinoo/scheduler/spawn.h"
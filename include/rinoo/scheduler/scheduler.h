@@ -20,6 +20,9 @@ typedef struct rn_sched_s {
 	rn_task_driver_t driver;
 	struct rn_epoll_s epoll;
 	rn_sched_spawns_t spawns;
+	rn_slab_t slab;
+	rn_buffer_pool_t bufpool;
+	rn_allocator_stats_t alloc;
 } rn_sched_t;
 
 rn_sched_t *rn_scheduler(void);
@@ -28,6 +31,7 @@ int rn_scheduler_spawn(rn_sched_t *sched, int count);
 rn_sched_t *rn_scheduler_spawn_get(rn_sched_t *sched, int id);
 rn_sched_t *rn_scheduler_self(void);
 void rn_scheduler_stop(rn_sched_t *sched);
+int rn_scheduler_watch(rn_sched_node_t *node, rn_sched_mode_t mode);
 int rn_scheduler_waitfor(rn_sched_node_t *node,  rn_sched_mode_t mode);
 int rn_scheduler_remove(rn_sched_node_t *node);
 void rn_scheduler_wakeup(rn_sched_node_t *node, rn_sched_mode_t mode, int error);
@@ -23,12 +23,21 @@
 
 /* Defined in scheduler.h */
 struct rn_sched_s;
+/* Defined in cancel.h */
+struct rn_cancel_s;
 
 typedef struct rn_task_s {
+	bool released;
 	bool scheduled;
+	/* Current wake up has been set by the deadline */
+	bool deadlined;
 	struct timeval tv;
+	struct timeval deadline;
 	struct rn_sched_s *sched;
+	struct rn_cancel_s *cancel;
+	rn_list_node_t cancel_node;
 	rn_rbtree_node_t proc_node;
+	rn_arena_t arena;
 
 #if defined(RINOO_JUMP_BOOST)
 	void (*start_func)(void *arg);
@@ -72,6 +81,9 @@ int rn_task_unschedule(rn_task_t *task);
 int rn_task_start(struct rn_sched_s *sched, void (*function)(void *arg), void *arg);
 int rn_task_wait(struct rn_sched_s *sched, uint32_t ms);
 int rn_task_pause(struct rn_sched_s *sched);
+int rn_task_deadline(struct rn_sched_s *sched, uint32_t ms);
+int rn_task_check(rn_task_t *task);
+rn_arena_t *rn_task_arena(struct rn_sched_s *sched);
 rn_task_t *rn_task_self(void);
 
 #endif /* RINOO_SCHEDULER_TASK_H_ */
@@ -0,0 +1,56 @@
+/**
+ * @file   btree.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  B+tree ordered map structure
+ *
+ *
+ */
+
+#ifndef RINOO_STRUCT_BTREE_H_
+#define RINOO_STRUCT_BTREE_H_
+
+/* Maximum number of keys per node */
+#define RN_BTREE_ORDER		32
+#define RN_BTREE_MIN		(RN_BTREE_ORDER / 2)
+
+typedef struct rn_btree_leaf_s {
+	unsigned int nbkeys;
+	struct rn_btree_leaf_s *next;
+	uint64_t keys[RN_BTREE_ORDER];
+	void *values[RN_BTREE_ORDER];
+} rn_btree_leaf_t;
+
+typedef struct rn_btree_inner_s {
+	unsigned int nbkeys;
+	uint64_t keys[RN_BTREE_ORDER];
+	void *children[RN_BTREE_ORDER + 1];
+} rn_btree_inner_t;
+
+typedef struct rn_btree_s {
+	size_t size;
+	unsigned int depth;
+	void *root;
+	rn_btree_leaf_t *head;
+} rn_btree_t;
+
+typedef struct rn_btree_iter_s {
+	rn_btree_leaf_t *leaf;
+	unsigned int pos;
+} rn_btree_iter_t;
+
+#define rn_btree_size(tree)		((tree)->size)
+#define rn_btree_iter_key(iter)		((iter)->leaf->keys[(iter)->pos])
+#define rn_btree_iter_value(iter)	((iter)->leaf->values[(iter)->pos])
+
+int rn_btree(rn_btree_t *tree);
+void rn_btree_flush(rn_btree_t *tree, void (*delete)(void *value));
+int rn_btree_put(rn_btree_t *tree, uint64_t key, void *value);
+int rn_btree_remove(rn_btree_t *tree, uint64_t key, void **value);
+void *rn_btree_find(rn_btree_t *tree, uint64_t key);
+int rn_btree_head(rn_btree_t *tree, rn_btree_iter_t *iter);
+int rn_btree_seek(rn_btree_t *tree, uint64_t key, rn_btree_iter_t *iter);
+int rn_btree_next(rn_btree_iter_t *iter);
+
+#endif /* !RINOO_STRUCT_BTREE_H_ */
@@ -0,0 +1,60 @@
+/**
+ * @file   cmap.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Concurrent hash map structure
+ *
+ *
+ */
+
+#ifndef RINOO_STRUCT_CMAP_H_
+#define RINOO_STRUCT_CMAP_H_
+
+/* Retired nodes per shard before trying to release them */
+#define RN_CMAP_RECLAIM		64
+
+typedef struct rn_cmap_node_s {
+	uint64_t hash;
+	uint64_t epoch;
+	struct rn_cmap_node_s *next;
+	struct rn_cmap_node_s *retired;
+} rn_cmap_node_t;
+
+typedef struct rn_cmap_slot_s {
+	uint64_t epoch;
+	unsigned int nesting;
+} __attribute__((aligned(64))) rn_cmap_slot_t;
+
+typedef struct rn_cmap_shard_s {
+	pthread_mutex_t lock;
+	size_t size;
+	size_t nbretired;
+	rn_cmap_node_t *retired;
+	rn_cmap_node_t **buckets;
+} __attribute__((aligned(64))) rn_cmap_shard_t;
+
+typedef struct rn_cmap_s {
+	uint64_t epoch;
+	size_t nbshards;
+	size_t nbbuckets;
+	size_t nbslots;
+	rn_cmap_shard_t *shards;
+	rn_cmap_slot_t *slots;
+	uint64_t (*hash)(rn_cmap_node_t *node);
+	int (*compare)(rn_cmap_node_t *node1, rn_cmap_node_t *node2);
+	void (*release)(rn_cmap_node_t *node);
+} rn_cmap_t;
+
+int rn_cmap(rn_cmap_t *cmap, size_t size, size_t nbslots, uint64_t (*hash)(rn_cmap_node_t *node), int (*compare)(rn_cmap_node_t *node1, rn_cmap_node_t *node2), void (*release)(rn_cmap_node_t *node));
+void rn_cmap_destroy(rn_cmap_t *cmap);
+void rn_cmap_flush(rn_cmap_t *cmap);
+size_t rn_cmap_size(rn_cmap_t *cmap);
+void rn_cmap_enter(rn_cmap_t *cmap, unsigned int slot);
+void rn_cmap_leave(rn_cmap_t *cmap, unsigned int slot);
+int rn_cmap_put(rn_cmap_t *cmap, rn_cmap_node_t *node);
+rn_cmap_node_t *rn_cmap_get(rn_cmap_t *cmap, rn_cmap_node_t *node);
+int rn_cmap_remove(rn_cmap_t *cmap, rn_cmap_node_t *node);
+void rn_cmap_reclaim(rn_cmap_t *cmap);
+
+#endif /* !RINOO_STRUCT_CMAP_H_ */
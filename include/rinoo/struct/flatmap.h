@@ -0,0 +1,118 @@
+/**
+ * @file   flatmap.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Sorted flat map structure, for small lookup tables.
+ *         RN_FLATMAP(name, ktype, vtype, inline_size, compare) declares
+ *         name_t, keeping key/value pairs sorted in a typed vector, and
+ *         its name_* functions. compare(const ktype *, const ktype *)
+ *         returns a negative, zero or positive value like strcmp.
+ *         Lookups are binary searches over contiguous entries.
+ *
+ *
+ */
+
+#ifndef RINOO_STRUCT_FLATMAP_H_
+#define RINOO_STRUCT_FLATMAP_H_
+
+#define RN_FLATMAP(name, ktype, vtype, inline_size, compare)	\
+typedef struct name##_entry_s { \
+	ktype key; \
+	vtype value; \
+} name##_entry_t; \
+\
+RN_SVECTOR(name##_vector, name##_entry_t, inline_size) \
+\
+typedef struct name##_s { \
+	name##_vector_t entries; \
+} name##_t; \
+\
+static inline void name##_init(name##_t *map) \
+{ \
+	name##_vector_init(&map->entries); \
+} \
+\
+static inline void name##_destroy(name##_t *map) \
+{ \
+	name##_vector_destroy(&map->entries); \
+} \
+\
+static inline size_t name##_size(name##_t *map) \
+{ \
+	return name##_vector_size(&map->entries); \
+} \
+\
+static inline void name##_clear(name##_t *map) \
+{ \
+	name##_vector_clear(&map->entries); \
+} \
+\
+static inline name##_entry_t *name##_at(name##_t *map, size_t i) \
+{ \
+	return name##_vector_get(&map->entries, i); \
+} \
+\
+static inline int name##_search(name##_t *map, const ktype *key, size_t *pos) \
+{ \
+	int res; \
+	size_t low; \
+	size_t mid; \
+	size_t high; \
+	name##_entry_t *data; \
+\
+	low = 0; \
+	high = name##_vector_size(&map->entries); \
+	data = name##_vector_data(&map->entries); \
+	while (low < high) { \
+		mid = low + (high - low) / 2; \
+		res = compare(&data[mid].key, key); \
+		if (res == 0) { \
+			*pos = mid; \
+			return 0; \
+		} \
+		if (res < 0) { \
+			low = mid + 1; \
+		} else { \
+			high = mid; \
+		} \
+	} \
+	*pos = low; \
+	return -1; \
+} \
+\
+static inline vtype *name##_get(name##_t *map, const ktype *key) \
+{ \
+	size_t pos; \
+\
+	if (name##_search(map, key, &pos) != 0) { \
+		return NULL; \
+	} \
+	return &name##_vector_data(&map->entries)[pos].value; \
+} \
+\
+static inline int name##_put(name##_t *map, ktype key, vtype value) \
+{ \
+	size_t pos; \
+	name##_entry_t entry; \
+\
+	if (name##_search(map, &key, &pos) == 0) { \
+		name##_vector_data(&map->entries)[pos].value = value; \
+		return 1; \
+	} \
+	entry.key = key; \
+	entry.value = value; \
+	return name##_vector_insert(&map->entries, pos, entry); \
+} \
+\
+static inline int name##_remove(name##_t *map, const ktype *key) \
+{ \
+	size_t pos; \
+\
+	if (name##_search(map, key, &pos) != 0) { \
+		return -1; \
+	} \
+	return name##_vector_remove(&map->entries, pos); \
+}
+
+#endif /* !RINOO_STRUCT_FLATMAP_H_ */
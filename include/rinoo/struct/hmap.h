@@ -0,0 +1,47 @@
+/**
+ * @file   hmap.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Open addressing hash table structure
+ *
+ *
+ */
+
+#ifndef RINOO_STRUCT_HMAP_H_
+#define RINOO_STRUCT_HMAP_H_
+
+/* Slots per probing group */
+#define RN_HMAP_GROUP		16
+/* Old table groups moved to the new table on each update while resizing */
+#define RN_HMAP_MIGRATE		8
+
+typedef struct rn_hmap_node_s {
+	uint64_t hash;
+} rn_hmap_node_t;
+
+typedef struct rn_hmap_table_s {
+	size_t used;
+	size_t capacity;
+	uint8_t *ctrl;
+	rn_hmap_node_t **slots;
+} rn_hmap_table_t;
+
+typedef struct rn_hmap_s {
+	size_t size;
+	size_t migrated;
+	rn_hmap_table_t table;
+	rn_hmap_table_t old;
+	uint64_t (*hash)(rn_hmap_node_t *node);
+	int (*compare)(rn_hmap_node_t *node1, rn_hmap_node_t *node2);
+} rn_hmap_t;
+
+int rn_hmap(rn_hmap_t *hmap, size_t size, uint64_t (*hash)(rn_hmap_node_t *node), int (*compare)(rn_hmap_node_t *node1, rn_hmap_node_t *node2));
+void rn_hmap_destroy(rn_hmap_t *hmap);
+void rn_hmap_flush(rn_hmap_t *hmap, void (*delete)(rn_hmap_node_t *node));
+size_t rn_hmap_size(rn_hmap_t *hmap);
+int rn_hmap_put(rn_hmap_t *hmap, rn_hmap_node_t *node);
+rn_hmap_node_t *rn_hmap_get(rn_hmap_t *hmap, rn_hmap_node_t *node);
+int rn_hmap_remove(rn_hmap_t *hmap, rn_hmap_node_t *node);
+
+#endif /* !RINOO_STRUCT_HMAP_H_ */
@@ -12,12 +12,19 @@
 #define RINOO_MODULE_STRUCT_H_
 
 #include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
 
 #include "rinoo/global/module.h"
 
 #include "rinoo/struct/rbtree.h"
+#include "rinoo/struct/btree.h"
 #include "rinoo/struct/list.h"
 #include "rinoo/struct/vector.h"
+#include "rinoo/struct/svector.h"
+#include "rinoo/struct/flatmap.h"
 #include "rinoo/struct/htable.h"
+#include "rinoo/struct/hmap.h"
+#include "rinoo/struct/cmap.h"
 
 #endif /* !RINOO_MODULE_STRUCT_H_ */
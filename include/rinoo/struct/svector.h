@@ -0,0 +1,161 @@
+/**
+ * @file   svector.h
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Typed vector structure. RN_SVECTOR(name, type, inline_size)
+ *         declares name_t, holding elements by value, and its name_*
+ *         functions. The first inline_size elements are stored in the
+ *         structure itself; the heap is only used past that. A zeroed
+ *         structure is an empty vector.
+ *
+ *
+ */
+
+#ifndef RINOO_STRUCT_SVECTOR_H_
+#define RINOO_STRUCT_SVECTOR_H_
+
+#define RN_SVECTOR_MIN_HEAP	8
+
+#define RN_SVECTOR(name, type, inline_size)	\
+typedef struct name##_s { \
+	size_t size; \
+	size_t msize; \
+	type *heap; \
+	type inl[inline_size]; \
+} name##_t; \
+\
+static inline void name##_init(name##_t *vector) \
+{ \
+	vector->size = 0; \
+	vector->msize = 0; \
+	vector->heap = NULL; \
+} \
+\
+static inline void name##_destroy(name##_t *vector) \
+{ \
+	rn_free(vector->heap); \
+	name##_init(vector); \
+} \
+\
+static inline type *name##_data(name##_t *vector) \
+{ \
+	return (vector->heap != NULL ? vector->heap : vector->inl); \
+} \
+\
+static inline size_t name##_size(name##_t *vector) \
+{ \
+	return vector->size; \
+} \
+\
+static inline size_t name##_capacity(name##_t *vector) \
+{ \
+	return (vector->heap != NULL ? vector->msize : (inline_size)); \
+} \
+\
+static inline void name##_clear(name##_t *vector) \
+{ \
+	vector->size = 0; \
+} \
+\
+static inline int name##_reserve(name##_t *vector, size_t msize) \
+{ \
+	type *ptr; \
+	size_t newsize; \
+\
+	if (msize <= name##_capacity(vector)) { \
+		return 0; \
+	} \
+	newsize = name##_capacity(vector) * 2; \
+	if (newsize < RN_SVECTOR_MIN_HEAP) { \
+		newsize = RN_SVECTOR_MIN_HEAP; \
+	} \
+	if (newsize < msize) { \
+		newsize = msize; \
+	} \
+	if (vector->heap != NULL) { \
+		ptr = rn_realloc(vector->heap, name##_capacity(vector) * sizeof(type), newsize * sizeof(type)); \
+	} else { \
+		ptr = rn_malloc(newsize * sizeof(type)); \
+		if (ptr != NULL && vector->size > 0) { \
+			memcpy(ptr, vector->inl, vector->size * sizeof(type)); \
+		} \
+	} \
+	if (ptr == NULL) { \
+		return -1; \
+	} \
+	vector->heap = ptr; \
+	vector->msize = newsize; \
+	return 0; \
+} \
+\
+static inline int name##_add(name##_t *vector, type item) \
+{ \
+	if (vector->size == name##_capacity(vector) && name##_reserve(vector, vector->size + 1) != 0) { \
+		return -1; \
+	} \
+	name##_data(vector)[vector->size++] = item; \
+	return 0; \
+} \
+\
+static inline int name##_append(name##_t *vector, const type *items, size_t count) \
+{ \
+	if (name##_reserve(vector, vector->size + count) != 0) { \
+		return -1; \
+	} \
+	memcpy(name##_data(vector) + vector->size, items, count * sizeof(type)); \
+	vector->size += count; \
+	return 0; \
+} \
+\
+static inline int name##_insert(name##_t *vector, size_t i, type item) \
+{ \
+	type *data; \
+\
+	if (i > vector->size) { \
+		return -1; \
+	} \
+	if (vector->size == name##_capacity(vector) && name##_reserve(vector, vector->size + 1) != 0) { \
+		return -1; \
+	} \
+	data = name##_data(vector); \
+	memmove(&data[i + 1], &data[i], (vector->size - i) * sizeof(type)); \
+	data[i] = item; \
+	vector->size++; \
+	return 0; \
+} \
+\
+static inline type *name##_get(name##_t *vector, size_t i) \
+{ \
+	if (i >= vector->size) { \
+		return NULL; \
+	} \
+	return &name##_data(vector)[i]; \
+} \
+\
+static inline int name##_remove(name##_t *vector, size_t i) \
+{ \
+	type *data; \
+\
+	if (i >= vector->size) { \
+		return -1; \
+	} \
+	data = name##_data(vector); \
+	memmove(&data[i], &data[i + 1], (vector->size - i - 1) * sizeof(type)); \
+	vector->size--; \
+	return 0; \
+} \
+\
+static inline int name##_swap_remove(name##_t *vector, size_t i) \
+{ \
+	type *data; \
+\
+	if (i >= vector->size) { \
+		return -1; \
+	} \
+	data = name##_data(vector); \
+	data[i] = data[--vector->size]; \
+	return 0; \
+}
+
+#endif /* !RINOO_STRUCT_SVECTOR_H_ */
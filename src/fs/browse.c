@@ -14,13 +14,13 @@ static int rn_fs_stack_push(rn_fs_entry_t *entry, DIR *dirfd, const char *path)
 {
 	rn_fs_directory_t *directory;
 
-	directory = calloc(1, sizeof(*directory));
+	directory = rn_calloc(1, sizeof(*directory));
 	if (directory == NULL) {
 		return -1;
 	}
-	directory->path = strdup(path);
+	directory->path = rn_strdup(path);
 	if (directory->path == NULL) {
-		free(directory);
+		rn_free(directory);
 		return -1;
 	}
 	directory->fd = dirfd;
@@ -38,8 +38,8 @@ static int rn_fs_stack_pop(rn_fs_entry_t *entry)
 		return -1;
 	}
 	directory = container_of(node, rn_fs_directory_t, stack_node);
-	free(directory->path);
-	free(directory);
+	rn_free(directory->path);
+	rn_free(directory);
 	return 0;
 }
 
@@ -62,8 +62,8 @@ static void rn_fs_stack_destroy_node(rn_list_node_t *node)
 
 	directory = container_of(node, rn_fs_directory_t, stack_node);
 	closedir(directory->fd);
-	free(directory->path);
-	free(directory);
+	rn_free(directory->path);
+	rn_free(directory);
 }
 
 static void rn_fs_entry_destroy(rn_fs_entry_t *entry)
@@ -72,13 +72,13 @@ static void rn_fs_entry_destroy(rn_fs_entry_t *entry)
 		return;
 	}
 	if (entry->entry != NULL) {
-		free(entry->entry);
+		rn_free(entry->entry);
 	}
 	if (entry->path != NULL) {
 		rn_buffer_destroy(entry->path);
 	}
 	rn_list_flush(&entry->stack, rn_fs_stack_destroy_node);
-	free(entry);
+	rn_free(entry);
 }
 
 static rn_fs_entry_t *rn_fs_entry(const char *path)
@@ -86,7 +86,7 @@ static rn_fs_entry_t *rn_fs_entry(const char *path)
 	long size;
 	rn_fs_entry_t *entry;
 
-	entry = calloc(1, sizeof(*entry));
+	entry = rn_calloc(1, sizeof(*entry));
 	if (entry == NULL) {
 		return NULL;
 	}
@@ -96,7 +96,7 @@ static rn_fs_entry_t *rn_fs_entry(const char *path)
 		size = 256;
 	}
 	size = offsetof(struct dirent, d_name) + size + 1;
-	entry->entry = calloc(1, size);
+	entry->entry = rn_calloc(1, size);
 	if (entry->entry == NULL) {
 		goto entry_error;
 	}
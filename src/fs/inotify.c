@@ -19,7 +19,7 @@ rn_inotify_t *rn_inotify(rn_sched_t *sched)
 	if (fd < 0) {
 		return NULL;
 	}
-	notify = calloc(1, sizeof(*notify));
+	notify = rn_calloc(1, sizeof(*notify));
 	if (notify == NULL) {
 		close(fd);
 		return NULL;
@@ -27,7 +27,7 @@ rn_inotify_t *rn_inotify(rn_sched_t *sched)
 	notify->event.path = rn_buffer_create(NULL);
 	if (notify->event.path == NULL) {
 		close(fd);
-		free(notify);
+		rn_free(notify);
 		return NULL;
 	}
 	notify->node.fd = fd;
@@ -47,13 +47,15 @@ void rn_inotify_destroy(rn_inotify_t *notify)
 	rn_scheduler_remove(&notify->node);
 	close(notify->node.fd);
 	rn_buffer_destroy(notify->event.path);
-	free(notify);
+	rn_free(notify);
 }
 
 rn_inotify_watch_t *rn_inotify_add_watch(rn_inotify_t *inotify, const char *path, rn_inotify_type_t type, bool recursive)
 {
 	int wd;
 	int nb;
+	size_t len;
+	rn_slab_t *slab;
 	rn_fs_entry_t *entry;
 	rn_inotify_watch_t *watch;
 
@@ -68,18 +70,21 @@ rn_inotify_watch_t *rn_inotify_add_watch(rn_inotify_t *inotify, const char *path
 		inotify_rm_watch(inotify->node.fd, wd);
 		return NULL;
 	}
-	watch = calloc(1, sizeof(*watch));
+	slab = &inotify->node.sched->slab;
+	watch = rn_slab_calloc(slab, sizeof(*watch));
 	if (watch == NULL) {
 		inotify_rm_watch(inotify->node.fd, wd);
 		return NULL;
 	}
 	watch->wd = wd;
-	watch->path = strdup(path);
+	len = strlen(path);
+	watch->path = rn_slab_alloc(slab, len + 1);
 	if (watch->path == NULL) {
 		inotify_rm_watch(inotify->node.fd, wd);
-		free(watch);
+		rn_slab_free(watch);
 		return NULL;
 	}
+	memcpy(watch->path, path, len + 1);
 	inotify->watches[wd] = watch;
 	inotify->nb_watches++;
 	if (recursive) {
@@ -104,8 +109,8 @@ int rn_inotify_rm_watch(rn_inotify_t *inotify, rn_inotify_watch_t *watch)
 	inotify_rm_watch(inotify->node.fd, watch->wd);
 	inotify->watches[watch->wd] = NULL;
 	inotify->nb_watches--;
-	free(watch->path);
-	free(watch);
+	rn_slab_free(watch->path);
+	rn_slab_free(watch);
 	return 0;
 }
 
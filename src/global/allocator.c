@@ -0,0 +1,184 @@
+/**
+ * @file   allocator.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Library allocator hooks
+ *
+ *
+ */
+
+#include "rinoo/global/module.h"
+
+static void *rn_allocator_libc_aligned_alloc(size_t alignment, size_t size)
+{
+	void *ptr;
+
+	if (posix_memalign(&ptr, alignment, size) != 0) {
+		return NULL;
+	}
+	return ptr;
+}
+
+static const rn_allocator_t rn_allocator_libc = {
+	.malloc = malloc,
+	.calloc = calloc,
+	.realloc = realloc,
+	.free = free,
+	.aligned_alloc = rn_allocator_libc_aligned_alloc
+};
+
+rn_allocator_t rn_allocator = {
+	.malloc = malloc,
+	.calloc = calloc,
+	.realloc = realloc,
+	.free = free,
+	.aligned_alloc = rn_allocator_libc_aligned_alloc
+};
+
+__thread rn_allocator_stats_t *rn_allocator_stats = NULL;
+
+/**
+ * Sets the allocator used by the whole library.
+ * This must be done before any library call, as memory
+ * allocated by an allocator has to be released by the same one.
+ *
+ * @param allocator Pointer to the allocator callbacks, or NULL to restore libc ones
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_allocator_set(const rn_allocator_t *allocator)
+{
+	if (allocator == NULL) {
+		rn_allocator = rn_allocator_libc;
+		return 0;
+	}
+	XASSERT(allocator->malloc != NULL, -1);
+	XASSERT(allocator->calloc != NULL, -1);
+	XASSERT(allocator->realloc != NULL, -1);
+	XASSERT(allocator->free != NULL, -1);
+	XASSERT(allocator->aligned_alloc != NULL, -1);
+
+	rn_allocator = *allocator;
+	return 0;
+}
+
+/**
+ * Sets the statistics updated by allocations made from the calling thread.
+ *
+ * @param stats Pointer to the statistics, or NULL to disable accounting
+ *
+ * @return Previous statistics pointer
+ */
+rn_allocator_stats_t *rn_allocator_stats_set(rn_allocator_stats_t *stats)
+{
+	rn_allocator_stats_t *prev;
+
+	prev = rn_allocator_stats;
+	rn_allocator_stats = stats;
+	return prev;
+}
+
+/**
+ * Allocates memory with the library allocator.
+ *
+ * @param size Allocation size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_malloc(size_t size)
+{
+	rn_allocator_account(size);
+	return rn_allocator.malloc(size);
+}
+
+/**
+ * Allocates zeroed memory with the library allocator.
+ * Fails with ENOMEM if the total size overflows.
+ *
+ * @param nmemb Number of elements
+ * @param size Element size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_calloc(size_t nmemb, size_t size)
+{
+	if (unlikely(size != 0 && nmemb > SIZE_MAX / size)) {
+		rn_error_set(ENOMEM);
+		return NULL;
+	}
+	rn_allocator_account(nmemb * size);
+	return rn_allocator.calloc(nmemb, size);
+}
+
+/**
+ * Resizes memory with the library allocator.
+ * Only the size difference is accounted, unless ptr is NULL
+ * in which case this is accounted as a new allocation.
+ *
+ * @param ptr Pointer to the memory to resize (can be NULL)
+ * @param oldsize Current size of the memory
+ * @param size New size
+ *
+ * @return Pointer to the resized memory or NULL if an error occurs
+ */
+void *rn_realloc(void *ptr, size_t oldsize, size_t size)
+{
+	void *new;
+
+	if (ptr == NULL) {
+		return rn_malloc(size);
+	}
+	new = rn_allocator.realloc(ptr, size);
+	if (likely(new != NULL)) {
+		rn_allocator_resize(oldsize, size);
+	}
+	return new;
+}
+
+/**
+ * Allocates aligned memory with the library allocator.
+ *
+ * @param alignment Alignment, must be a power of two multiple of sizeof(void *)
+ * @param size Allocation size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_aligned_alloc(size_t alignment, size_t size)
+{
+	rn_allocator_account(size);
+	return rn_allocator.aligned_alloc(alignment, size);
+}
+
+/**
+ * Releases memory allocated with the library allocator.
+ *
+ * @param ptr Pointer to the memory to release (can be NULL)
+ */
+void rn_free(void *ptr)
+{
+	if (ptr != NULL) {
+		rn_allocator_release();
+		rn_allocator.free(ptr);
+	}
+}
+
+/**
+ * Duplicates a string with the library allocator.
+ *
+ * @param str String to duplicate
+ *
+ * @return Pointer to the new string or NULL if an error occurs
+ */
+char *rn_strdup(const char *str)
+{
+	char *dup;
+	size_t len;
+
+	len = strlen(str) + 1;
+	dup = rn_malloc(len);
+	if (dup != NULL) {
+		memcpy(dup, str, len);
+	}
+	return dup;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file   rn_hash.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Hash functions benchmark, rn_hash against murmurhash3 across
+ *         key sizes.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define NB_KEYS		64
+#define MAX_KEY_SIZE	4096
+
+static size_t nb_loops = 1000000;
+static uint8_t keys[NB_KEYS][MAX_KEY_SIZE];
+static volatile uint64_t sink;
+
+static uint64_t hash_rn(const void *key, size_t len)
+{
+	return rn_hash(key, len, 0);
+}
+
+static uint64_t hash_rn_default(const void *key, size_t len)
+{
+	return rn_hash_default(key, len);
+}
+
+static uint64_t hash_murmur32(const void *key, size_t len)
+{
+	uint32_t out;
+
+	murmurhash3_x86_32(key, len, 0, &out);
+	return out;
+}
+
+static uint64_t hash_murmur128(const void *key, size_t len)
+{
+	uint64_t out[2];
+
+	murmurhash3_x64_128(key, len, 0, out);
+	return out[0];
+}
+
+static void bench(const char *name, uint64_t (*hash)(const void *key, size_t len), size_t len)
+{
+	size_t i;
+	size_t loops;
+	uint64_t sum;
+	long long start;
+	double ns;
+
+	loops = nb_loops / (1 + len / 64);
+	sum = 0;
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		sum += hash(keys[(i + sum) % NB_KEYS], len);
+	}
+	ns = (double) (clock_ns() - start) / loops;
+	sink = sum;
+	printf("%-15s %5zu bytes: %8.2f ns/hash %8.2f GB/s\n", name, len, ns, len / ns);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -l loops\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	size_t j;
+	static const size_t sizes[] = { 4, 8, 16, 24, 32, 64, 128, 256, 1024, 4096 };
+
+	while ((ch = getopt(argc, argv, "hl:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'l':
+			nb_loops = atol(optarg);
+			break;
+		default:
+			break;
+		}
+	}
+	for (i = 0; i < NB_KEYS; i++) {
+		for (j = 0; j < MAX_KEY_SIZE; j++) {
+			keys[i][j] = random();
+		}
+	}
+	for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+		bench("rn_hash", hash_rn, sizes[i]);
+		bench("rn_hash_default", hash_rn_default, sizes[i]);
+		bench("murmur3_x86_32", hash_murmur32, sizes[i]);
+		bench("murmur3_x64_128", hash_murmur128, sizes[i]);
+	}
+	XPASS();
+	return 0;
+}
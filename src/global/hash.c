@@ -0,0 +1,265 @@
+/**
+ * @file   hash.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Fast 64-bit hash functions, following the wyhash construction:
+ *         input words are xored with secrets and folded through 64x64
+ *         to 128 bits multiplications.
+ *
+ *         rn_hash_default() is keyed with a per process random key. It
+ *         should be used for keys coming from the network, so that
+ *         colliding keys cannot be computed offline.
+ *
+ *
+ */
+
+#include "rinoo/global/module.h"
+
+static const uint64_t rn_hash_secret[4] = {
+	0x2d358dccaa6c78a5ULL,
+	0x8bb84b93962eacc9ULL,
+	0x4b33a62ed433d4a3ULL,
+	0x4d5a2da51de1aa47ULL
+};
+
+static rn_hash_key_t rn_hash_process;
+static pthread_once_t rn_hash_once = PTHREAD_ONCE_INIT;
+
+static inline void rn_hash_mum(uint64_t *a, uint64_t *b)
+{
+	__uint128_t r;
+
+	r = (__uint128_t) *a * *b;
+	*a = (uint64_t) r;
+	*b = (uint64_t) (r >> 64);
+}
+
+static inline uint64_t rn_hash_mix(uint64_t a, uint64_t b)
+{
+	rn_hash_mum(&a, &b);
+	return a ^ b;
+}
+
+static inline uint64_t rn_hash_read8(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static inline uint64_t rn_hash_read4(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	v = __builtin_bswap32(v);
+#endif
+	return v;
+}
+
+static inline uint64_t rn_hash_read3(const uint8_t *p, size_t len)
+{
+	return ((uint64_t) p[0] << 16) | ((uint64_t) p[len >> 1] << 8) | p[len - 1];
+}
+
+/**
+ * Hashes a key with a seed and a set of secrets.
+ *
+ * @param key Pointer to the key
+ * @param len Key length
+ * @param seed Hash seed
+ * @param secret Hash secrets
+ *
+ * @return 64-bit hash
+ */
+static inline uint64_t rn_hash_core(const void *key, size_t len, uint64_t seed, const uint64_t *secret)
+{
+	size_t i;
+	uint64_t a;
+	uint64_t b;
+	uint64_t see1;
+	uint64_t see2;
+	const uint8_t *p = key;
+
+	seed ^= rn_hash_mix(seed ^ secret[0], secret[1]);
+	if (len <= 16) {
+		if (len >= 4) {
+			a = (rn_hash_read4(p) << 32) | rn_hash_read4(p + ((len >> 3) << 2));
+			b = (rn_hash_read4(p + len - 4) << 32) | rn_hash_read4(p + len - 4 - ((len >> 3) << 2));
+		} else if (len > 0) {
+			a = rn_hash_read3(p, len);
+			b = 0;
+		} else {
+			a = 0;
+			b = 0;
+		}
+	} else {
+		i = len;
+		if (i > 48) {
+			see1 = seed;
+			see2 = seed;
+			do {
+				seed = rn_hash_mix(rn_hash_read8(p) ^ secret[1], rn_hash_read8(p + 8) ^ seed);
+				see1 = rn_hash_mix(rn_hash_read8(p + 16) ^ secret[2], rn_hash_read8(p + 24) ^ see1);
+				see2 = rn_hash_mix(rn_hash_read8(p + 32) ^ secret[3], rn_hash_read8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16) {
+			seed = rn_hash_mix(rn_hash_read8(p) ^ secret[1], rn_hash_read8(p + 8) ^ seed);
+			p += 16;
+			i -= 16;
+		}
+		a = rn_hash_read8(p + i - 16);
+		b = rn_hash_read8(p + i - 8);
+	}
+	a ^= secret[1];
+	b ^= seed;
+	rn_hash_mum(&a, &b);
+	return rn_hash_mix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+/**
+ * Hashes a key. The result only depends on the key and the seed,
+ * so it must not be used for untrusted keys: see rn_hash_default().
+ *
+ * @param key Pointer to the key
+ * @param len Key length
+ * @param seed Hash seed
+ *
+ * @return 64-bit hash
+ */
+uint64_t rn_hash(const void *key, size_t len, uint64_t seed)
+{
+	return rn_hash_core(key, len, seed, rn_hash_secret);
+}
+
+/**
+ * Hashes a 64-bit integer.
+ *
+ * @param value Value to hash
+ * @param seed Hash seed
+ *
+ * @return 64-bit hash
+ */
+uint64_t rn_hash_u64(uint64_t value, uint64_t seed)
+{
+	return rn_hash_mix(rn_hash_mix(value ^ rn_hash_secret[0], seed ^ rn_hash_secret[1]), rn_hash_secret[2]);
+}
+
+/**
+ * Hashes a key with a secret key.
+ *
+ * @param key Pointer to the key
+ * @param len Key length
+ * @param hkey Secret key, see rn_hash_key()
+ *
+ * @return 64-bit hash
+ */
+uint64_t rn_hash_keyed(const void *key, size_t len, const rn_hash_key_t *hkey)
+{
+	return rn_hash_core(key, len, hkey->seed, hkey->secret);
+}
+
+/**
+ * Fills a buffer with random bytes. Falls back to a clock based
+ * generator if the kernel cannot provide them.
+ *
+ * @param buf Buffer to fill
+ * @param len Buffer length
+ */
+static void rn_hash_random(void *buf, size_t len)
+{
+	size_t i;
+	ssize_t res;
+	uint64_t state;
+	struct timespec now;
+	uint8_t *ptr = buf;
+
+	while (len > 0) {
+		res = getrandom(ptr, len, 0);
+		if (res < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		ptr += res;
+		len -= res;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	state = ((uint64_t) now.tv_sec << 32) ^ (uint64_t) now.tv_nsec ^ ((uint64_t) getpid() << 16);
+	for (i = 0; i < len; i++) {
+		state = rn_hash_u64(state, i);
+		ptr[i] = (uint8_t) state;
+	}
+}
+
+/**
+ * Generates a random secret key. Each secret is built from bytes with
+ * four bits set, is odd, and differs from the others by 32 bits, so that
+ * multiplications keep mixing well.
+ *
+ * @param hkey Key to initialize
+ *
+ * @return 0 on success otherwise -1
+ */
+int rn_hash_key(rn_hash_key_t *hkey)
+{
+	size_t i;
+	size_t j;
+	size_t k;
+	size_t nb;
+	int valid;
+	uint8_t random[8];
+	uint8_t bytes[70];
+
+	for (i = 0, nb = 0; i < 256; i++) {
+		if (__builtin_popcount(i) == 4) {
+			bytes[nb++] = i;
+		}
+	}
+	rn_hash_random(&hkey->seed, sizeof(hkey->seed));
+	for (i = 0; i < ARRAY_SIZE(hkey->secret); i++) {
+		do {
+			rn_hash_random(random, sizeof(random));
+			hkey->secret[i] = 0;
+			for (k = 0; k < sizeof(random); k++) {
+				hkey->secret[i] |= (uint64_t) bytes[random[k] % nb] << (k * 8);
+			}
+			valid = (hkey->secret[i] & 1);
+			for (j = 0; j < i && valid; j++) {
+				valid = (__builtin_popcountll(hkey->secret[i] ^ hkey->secret[j]) == 32);
+			}
+		} while (!valid);
+	}
+	return 0;
+}
+
+static void rn_hash_init(void)
+{
+	rn_hash_key(&rn_hash_process);
+}
+
+/**
+ * Hashes a key with the process secret key, randomly generated on
+ * first use. Hash values are therefore not stable across processes.
+ *
+ * @param key Pointer to the key
+ * @param len Key length
+ *
+ * @return 64-bit hash
+ */
+uint64_t rn_hash_default(const void *key, size_t len)
+{
+	pthread_once(&rn_hash_once, rn_hash_init);
+	return rn_hash_core(key, len, rn_hash_process.seed, rn_hash_process.secret);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file   rn_allocator.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_allocator unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+static int nbmalloc = 0;
+static int nbfree = 0;
+static int nbaligned = 0;
+
+static void *test_malloc(size_t size)
+{
+	nbmalloc++;
+	return malloc(size);
+}
+
+static void *test_calloc(size_t nmemb, size_t size)
+{
+	nbmalloc++;
+	return calloc(nmemb, size);
+}
+
+static void *test_realloc(void *ptr, size_t size)
+{
+	nbmalloc++;
+	return realloc(ptr, size);
+}
+
+static void test_free(void *ptr)
+{
+	nbfree++;
+	free(ptr);
+}
+
+static void *test_aligned_alloc(size_t alignment, size_t size)
+{
+	void *ptr;
+
+	nbaligned++;
+	if (posix_memalign(&ptr, alignment, size) != 0) {
+		return NULL;
+	}
+	return ptr;
+}
+
+static const rn_allocator_t test_allocator = {
+	.malloc = test_malloc,
+	.calloc = test_calloc,
+	.realloc = test_realloc,
+	.free = test_free,
+	.aligned_alloc = test_aligned_alloc
+};
+
+static uint64_t task_bytes = 0;
+
+void task_func(void *arg)
+{
+	uint64_t bytes;
+	rn_buffer_t *buffer;
+	rn_sched_t *sched = arg;
+
+	bytes = sched->alloc.bytes;
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(rn_buffer_add(buffer, "test", 4) == 4);
+	rn_buffer_destroy(buffer);
+	task_bytes = sched->alloc.bytes - bytes;
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	void *ptr;
+	rn_sched_t *sched;
+	rn_allocator_stats_t stats;
+	const rn_allocator_t incomplete = { .malloc = test_malloc };
+
+	XTEST(rn_allocator_set(&incomplete) == -1);
+	XTEST(rn_allocator_set(&test_allocator) == 0);
+	ptr = rn_malloc(42);
+	XTEST(ptr != NULL);
+	XTEST(nbmalloc == 1);
+	rn_free(ptr);
+	XTEST(nbfree == 1);
+	rn_free(NULL);
+	XTEST(nbfree == 1);
+	ptr = rn_aligned_alloc(64, 100);
+	XTEST(ptr != NULL);
+	XTEST(((uintptr_t) ptr & 63) == 0);
+	XTEST(nbaligned == 1);
+	rn_free(ptr);
+	/* Overflowing calloc is rejected before reaching the hooks */
+	XTEST(rn_calloc(SIZE_MAX / 2, 4) == NULL);
+	XTEST(rn_error == ENOMEM);
+	XTEST(nbmalloc == 1);
+	/* Library allocations go through the hooks */
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(nbmalloc > 1);
+	XTEST(rn_task_start(sched, task_func, sched) == 0);
+	XTEST(nbaligned == 2);
+	rn_scheduler_loop(sched);
+	XTEST(task_bytes >= sizeof(rn_buffer_t) + RN_BUFFER_HELPER_INISIZE);
+	XTEST(sched->alloc.nballoc >= 2);
+	XTEST(sched->alloc.nbfree >= 2);
+	XTEST(rn_allocator_stats == NULL);
+	rn_scheduler_destroy(sched);
+	XTEST(nbfree == nbmalloc + nbaligned);
+	XTEST(rn_allocator_set(NULL) == 0);
+	/* Resizing only accounts the size difference */
+	memset(&stats, 0, sizeof(stats));
+	XTEST(rn_allocator_stats_set(&stats) == NULL);
+	ptr = rn_realloc(NULL, 0, 100);
+	XTEST(ptr != NULL);
+	XTEST(stats.nballoc == 1 && stats.bytes == 100);
+	ptr = rn_realloc(ptr, 100, 300);
+	XTEST(ptr != NULL);
+	XTEST(stats.nballoc == 1 && stats.bytes == 300);
+	ptr = rn_realloc(ptr, 300, 200);
+	XTEST(ptr != NULL);
+	XTEST(stats.nballoc == 1 && stats.bytes == 200);
+	rn_free(ptr);
+	XTEST(stats.nbfree == 1);
+	XTEST(rn_allocator_stats_set(NULL) == &stats);
+	XPASS();
+}
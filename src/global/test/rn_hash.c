@@ -0,0 +1,127 @@
+/**
+ * @file   rn_hash.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_hash unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define RN_HASHTEST_MAX_LEN	256
+#define RN_HASHTEST_NB_KEYS	10000
+
+static uint8_t data[RN_HASHTEST_MAX_LEN + 8];
+
+static void check_consistency(void)
+{
+	size_t len;
+	size_t offset;
+	uint64_t hash;
+	uint64_t prev;
+	uint8_t copy[RN_HASHTEST_MAX_LEN + 8];
+
+	prev = 0;
+	for (len = 0; len <= RN_HASHTEST_MAX_LEN; len++) {
+		hash = rn_hash(data, len, 42);
+		XTEST(hash == rn_hash(data, len, 42));
+		XTEST(hash != rn_hash(data, len, 43));
+		XTEST(hash != prev);
+		XTEST(rn_hash_default(data, len) == rn_hash_default(data, len));
+		/* Unaligned keys hash the same */
+		for (offset = 1; offset < 8; offset++) {
+			memcpy(copy + offset, data, len);
+			XTEST(rn_hash(copy + offset, len, 42) == hash);
+		}
+		prev = hash;
+	}
+	XTEST(rn_hash_u64(42, 0) == rn_hash_u64(42, 0));
+	XTEST(rn_hash_u64(42, 0) != rn_hash_u64(43, 0));
+	XTEST(rn_hash_u64(42, 0) != rn_hash_u64(42, 1));
+}
+
+static void check_avalanche(void)
+{
+	size_t len;
+	size_t bit;
+	size_t total;
+	size_t count;
+	uint64_t hash;
+	uint8_t key[64];
+
+	for (len = 1; len <= sizeof(key); len *= 2) {
+		memcpy(key, data, len);
+		hash = rn_hash(key, len, 0);
+		total = 0;
+		count = 0;
+		for (bit = 0; bit < len * 8; bit++) {
+			key[bit / 8] ^= 1 << (bit % 8);
+			total += __builtin_popcountll(hash ^ rn_hash(key, len, 0));
+			key[bit / 8] ^= 1 << (bit % 8);
+			count++;
+		}
+		/* Flipping one input bit should flip about half the output bits */
+		XTEST(total > count * 24 && total < count * 40);
+	}
+}
+
+static void check_distribution(void)
+{
+	size_t i;
+	size_t len;
+	size_t max;
+	char key[32];
+	uint32_t buckets[1024];
+
+	memset(buckets, 0, sizeof(buckets));
+	for (i = 0; i < RN_HASHTEST_NB_KEYS; i++) {
+		len = snprintf(key, sizeof(key), "X-Header-%zu", i);
+		buckets[rn_hash_default(key, len) % ARRAY_SIZE(buckets)]++;
+	}
+	for (i = 0, max = 0; i < ARRAY_SIZE(buckets); i++) {
+		if (buckets[i] > max) {
+			max = buckets[i];
+		}
+	}
+	/* About 10 keys per bucket */
+	XTEST(max < 30);
+}
+
+static void check_keyed(void)
+{
+	size_t i;
+	rn_hash_key_t key1;
+	rn_hash_key_t key2;
+
+	XTEST(rn_hash_key(&key1) == 0);
+	XTEST(rn_hash_key(&key2) == 0);
+	for (i = 0; i < ARRAY_SIZE(key1.secret); i++) {
+		XTEST(key1.secret[i] & 1);
+		XTEST(key1.secret[i] != key2.secret[i]);
+	}
+	XTEST(rn_hash_keyed(data, 16, &key1) == rn_hash_keyed(data, 16, &key1));
+	XTEST(rn_hash_keyed(data, 16, &key1) != rn_hash_keyed(data, 16, &key2));
+	XTEST(rn_hash_keyed(data, 16, &key1) != rn_hash(data, 16, key1.seed));
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(data); i++) {
+		data[i] = random();
+	}
+	check_consistency();
+	check_avalanche();
+	check_distribution();
+	check_keyed();
+	XPASS();
+}
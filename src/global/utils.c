@@ -26,16 +26,16 @@ void rn_log(const char *format, ...)
 	struct tm tmp;
 	struct timeval tv;
 
-	logline = malloc(sizeof(*logline) * RN_LOG_MAXLENGTH);
+	logline = rn_malloc(sizeof(*logline) * RN_LOG_MAXLENGTH);
 	XASSERTN(logline != NULL);
-	esclogline = malloc(sizeof(*esclogline) * RN_LOG_MAXLENGTH);
+	esclogline = rn_malloc(sizeof(*esclogline) * RN_LOG_MAXLENGTH);
 	XASSERTN(esclogline != NULL);
 	XASSERTN(gettimeofday(&tv, NULL) == 0);
 	XASSERTN(localtime_r(&tv.tv_sec, &tmp) != NULL);
 	offset = strftime(logline, RN_LOG_MAXLENGTH, "[%Y/%m/%d %T.", &tmp);
 	if (offset == 0) {
-		free(logline);
-		free(esclogline);
+		rn_free(logline);
+		rn_free(esclogline);
 		XASSERTN(0);
 	}
 	offset += snprintf(logline + offset, RN_LOG_MAXLENGTH - offset, "%03d] ", (int) (tv.tv_usec / 1000));
@@ -103,6 +103,6 @@ void rn_log(const char *format, ...)
 	}
 	esclogline[offset++] = '\n';
 	printf("%.*s", offset, esclogline);
-	free(logline);
-	free(esclogline);
+	rn_free(logline);
+	rn_free(esclogline);
 }
@@ -0,0 +1,200 @@
+/**
+ * @file   arena.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Arena (bump) allocator
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+#define rn_arena_round(size)	(((size) + RN_ARENA_ALIGN - 1) & ~((size_t) RN_ARENA_ALIGN - 1))
+#define rn_arena_data(block)	((char *) (block) + sizeof(rn_arena_block_t))
+
+static void *rn_arena_buffer_malloc(rn_buffer_t *buffer, size_t size)
+{
+	rn_arena_t *arena = container_of(buffer->class, rn_arena_t, class);
+
+	return rn_arena_alloc(arena, size);
+}
+
+static void *rn_arena_buffer_realloc(rn_buffer_t *buffer, size_t newsize)
+{
+	rn_arena_t *arena = container_of(buffer->class, rn_arena_t, class);
+
+	return rn_arena_realloc(arena, buffer->ptr, buffer->msize, newsize);
+}
+
+static int rn_arena_buffer_free(rn_buffer_t *unused(buffer))
+{
+	/* Memory is released with the arena */
+	return 0;
+}
+
+/**
+ * Initializes an arena. No memory is allocated until first use.
+ *
+ * @param arena Pointer to the arena to initialize
+ * @param blksize Block size, or 0 to use RN_ARENA_BLKSIZE
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_arena(rn_arena_t *arena, size_t blksize)
+{
+	arena->blksize = (blksize > 0 ? rn_arena_round(blksize) : RN_ARENA_BLKSIZE);
+	arena->head = NULL;
+	arena->class.inisize = RN_ARENA_BUFFER_INISIZE;
+	arena->class.maxsize = RN_BUFFER_HELPER_MAXSIZE;
+	arena->class.init = NULL;
+	arena->class.growthsize = rn_buffer_helper_growthsize;
+	arena->class.malloc = rn_arena_buffer_malloc;
+	arena->class.realloc = rn_arena_buffer_realloc;
+	arena->class.free = rn_arena_buffer_free;
+	arena->class.reset = NULL;
+	return 0;
+}
+
+/**
+ * Releases all blocks of an arena.
+ *
+ * @param arena Pointer to the arena to destroy
+ */
+void rn_arena_destroy(rn_arena_t *arena)
+{
+	rn_arena_block_t *block;
+
+	while (arena->head != NULL) {
+		block = arena->head;
+		arena->head = block->next;
+		rn_free(block);
+	}
+}
+
+/**
+ * Releases all memory allocated from an arena at once.
+ * One block is kept to serve next allocations.
+ *
+ * @param arena Pointer to the arena to reset
+ */
+void rn_arena_reset(rn_arena_t *arena)
+{
+	rn_arena_block_t *keep;
+	rn_arena_block_t *block;
+
+	keep = NULL;
+	while (arena->head != NULL) {
+		block = arena->head;
+		arena->head = block->next;
+		if (keep == NULL && block->size == arena->blksize) {
+			keep = block;
+		} else {
+			rn_free(block);
+		}
+	}
+	if (keep != NULL) {
+		keep->used = 0;
+		keep->next = NULL;
+		arena->head = keep;
+	}
+}
+
+/**
+ * Allocates memory from an arena.
+ * Allocations bigger than a quarter of the block size get their own block.
+ *
+ * @param arena Pointer to the arena
+ * @param size Allocation size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_arena_alloc(rn_arena_t *arena, size_t size)
+{
+	void *ptr;
+	size_t blksize;
+	rn_arena_block_t *block;
+
+	size = rn_arena_round(size);
+	block = arena->head;
+	if (likely(block != NULL && block->used + size <= block->size)) {
+		ptr = rn_arena_data(block) + block->used;
+		block->used += size;
+		return ptr;
+	}
+	blksize = (size > arena->blksize / 4 ? size : arena->blksize);
+	block = rn_malloc(sizeof(*block) + blksize);
+	if (unlikely(block == NULL)) {
+		return NULL;
+	}
+	block->size = blksize;
+	block->used = size;
+	if (blksize != arena->blksize && arena->head != NULL) {
+		/* Keeps bumping into the current block */
+		block->next = arena->head->next;
+		arena->head->next = block;
+	} else {
+		block->next = arena->head;
+		arena->head = block;
+	}
+	return rn_arena_data(block);
+}
+
+/**
+ * Resizes memory allocated from an arena.
+ * The last allocation of the current block is extended in place when possible.
+ *
+ * @param arena Pointer to the arena
+ * @param ptr Pointer to the memory to resize (can be NULL)
+ * @param oldsize Current allocation size
+ * @param newsize New allocation size
+ *
+ * @return Pointer to the resized memory or NULL if an error occurs
+ */
+void *rn_arena_realloc(rn_arena_t *arena, void *ptr, size_t oldsize, size_t newsize)
+{
+	void *newptr;
+	rn_arena_block_t *block;
+
+	if (ptr == NULL) {
+		return rn_arena_alloc(arena, newsize);
+	}
+	if (newsize <= oldsize) {
+		return ptr;
+	}
+	block = arena->head;
+	oldsize = rn_arena_round(oldsize);
+	if (block != NULL && (char *) ptr + oldsize == rn_arena_data(block) + block->used &&
+	    block->used - oldsize + rn_arena_round(newsize) <= block->size) {
+		block->used = block->used - oldsize + rn_arena_round(newsize);
+		return ptr;
+	}
+	newptr = rn_arena_alloc(arena, newsize);
+	if (unlikely(newptr == NULL)) {
+		return NULL;
+	}
+	memcpy(newptr, ptr, oldsize);
+	return newptr;
+}
+
+/**
+ * Initializes a buffer allocating its memory from an arena.
+ * Such a buffer must not be destroyed, it is released with the arena.
+ *
+ * @param buffer Pointer to the buffer to initialize
+ * @param arena Pointer to the arena to use
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_buffer_arena(rn_buffer_t *buffer, rn_arena_t *arena)
+{
+	buffer->size = 0;
+	buffer->msize = arena->class.inisize;
+	buffer->offset = 0;
+	buffer->class = &arena->class;
+	buffer->ptr = rn_arena_alloc(arena, buffer->msize);
+	if (buffer->ptr == NULL) {
+		return -1;
+	}
+	return 0;
+}
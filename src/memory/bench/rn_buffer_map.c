@@ -0,0 +1,90 @@
+/**
+ * @file   rn_buffer_map.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Large buffer growth benchmark, realloc against mapped buffers.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define CHUNK_SIZE	(64 * 1024)
+
+static size_t size = 64 * 1024 * 1024;
+static long long loops = 20;
+
+static rn_buffer_class_t realloc_class = {
+	.inisize = RN_BUFFER_HELPER_INISIZE,
+	.maxsize = RN_BUFFER_HELPER_MAXSIZE,
+	.init = NULL,
+	.growthsize = rn_buffer_helper_growthsize,
+	.malloc = rn_buffer_helper_malloc,
+	.realloc = rn_buffer_helper_realloc,
+	.free = rn_buffer_helper_free,
+	.reset = NULL,
+};
+
+static void bench(const char *name, rn_buffer_class_t *class)
+{
+	size_t i;
+	long long j;
+	long long start;
+	long long duration;
+	rn_buffer_t *buffer;
+	static char chunk[CHUNK_SIZE];
+
+	memset(chunk, 'x', sizeof(chunk));
+	start = clock_ns();
+	for (j = 0; j < loops; j++) {
+		buffer = rn_buffer_create(class);
+		XTEST(buffer != NULL);
+		for (i = 0; i < size; i += CHUNK_SIZE) {
+			XTEST(rn_buffer_add(buffer, chunk, CHUNK_SIZE) == CHUNK_SIZE);
+		}
+		rn_buffer_destroy(buffer);
+	}
+	duration = clock_ns() - start;
+	printf("%-10s (%zu MB): %8.2f ms/buffer %6.2f GB/s\n", name, size >> 20, (double) duration / loops / 1000000, (double) size * loops / duration);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -s size -n loops\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+
+	while ((ch = getopt(argc, argv, "hs:n:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 's':
+			size = atol(optarg);
+			break;
+		case 'n':
+			loops = atoll(optarg);
+			if (loops < 1) {
+				loops = 1;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	bench("realloc", &realloc_class);
+	bench("default", NULL);
+	bench("mapped", rn_buffer_map_class());
+	rn_buffer_map_sethugepage(true);
+	bench("hugepage", rn_buffer_map_class());
+	rn_buffer_map_sethugepage(false);
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file   rn_codec.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Base64 and hex codecs benchmark, for each kernel level.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+static size_t size = 64 * 1024;
+static long long loops = 10000;
+
+static const char *level_name(rn_scan_level_t level)
+{
+	switch (level) {
+	case RN_SCAN_SCALAR:
+		return "scalar";
+	case RN_SCAN_SSE42:
+		return "sse4.2";
+	case RN_SCAN_AVX2:
+		return "avx2";
+	default:
+		return "auto";
+	}
+}
+
+static void bench(const char *name, rn_scan_level_t level, int (*func)(rn_buffer_t *dst, rn_buffer_t *src), rn_buffer_t *dst, rn_buffer_t *src, size_t datasize)
+{
+	long long i;
+	long long start;
+	long long duration;
+
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		rn_buffer_reset(dst);
+		XTEST(func(dst, src) == 0);
+	}
+	duration = clock_ns() - start;
+	printf("%-14s %-8s (%zu bytes): %6.2f GB/s\n", name, level_name(level), datasize, (double) datasize * loops / duration);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -s size -n loops\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	rn_buffer_t *data;
+	rn_buffer_t *b64;
+	rn_buffer_t *b64url;
+	rn_buffer_t *hex;
+	rn_buffer_t *out;
+	rn_scan_level_t level;
+
+	while ((ch = getopt(argc, argv, "hs:n:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 's':
+			size = atol(optarg);
+			break;
+		case 'n':
+			loops = atoll(optarg);
+			if (loops < 1) {
+				loops = 1;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	data = rn_buffer_create(NULL);
+	b64 = rn_buffer_create(NULL);
+	b64url = rn_buffer_create(NULL);
+	hex = rn_buffer_create(NULL);
+	out = rn_buffer_create(NULL);
+	for (i = 0; i < size; i++) {
+		XTEST(rn_buffer_add(data, (char *) &(unsigned char){ (i * 167 + 13) & 0xff }, 1) == 1);
+	}
+	XTEST(rn_buffer_b64encode(b64, data) == 0);
+	XTEST(rn_buffer_b64urlencode(b64url, data) == 0);
+	XTEST(rn_buffer_hexencode(hex, data) == 0);
+	for (level = RN_SCAN_SCALAR; level < RN_SCAN_AUTO; level++) {
+		if (rn_scan_setlevel(level) != level) {
+			continue;
+		}
+		bench("b64encode", level, rn_buffer_b64encode, out, data, size);
+		bench("b64decode", level, rn_buffer_b64decode, out, b64, rn_buffer_size(b64));
+		bench("b64urlencode", level, rn_buffer_b64urlencode, out, data, size);
+		bench("b64urldecode", level, rn_buffer_b64urldecode, out, b64url, rn_buffer_size(b64url));
+		bench("hexencode", level, rn_buffer_hexencode, out, data, size);
+		bench("hexdecode", level, rn_buffer_hexdecode, out, hex, rn_buffer_size(hex));
+	}
+	rn_scan_setlevel(RN_SCAN_AUTO);
+	rn_buffer_destroy(data);
+	rn_buffer_destroy(b64);
+	rn_buffer_destroy(b64url);
+	rn_buffer_destroy(hex);
+	rn_buffer_destroy(out);
+	XPASS();
+	return 0;
+}
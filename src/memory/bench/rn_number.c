@@ -0,0 +1,158 @@
+/**
+ * @file   rn_number.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Number formatting and parsing benchmark, against stdio and strto*.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define NB_VALUES	1024
+
+static long long loops = 10000;
+static uint64_t integers[NB_VALUES];
+static double doubles[NB_VALUES];
+
+static void report(const char *name, long long start)
+{
+	long long duration;
+
+	duration = clock_ns() - start;
+	printf("%-24s: %6.2f ns/op\n", name, (double) duration / (loops * NB_VALUES));
+}
+
+static void bench_format(rn_buffer_t *buffer)
+{
+	long long i;
+	long long start;
+	size_t j;
+
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		rn_buffer_reset(buffer);
+		for (j = 0; j < NB_VALUES; j++) {
+			rn_buffer_print(buffer, "%lu", (unsigned long) integers[j]);
+		}
+	}
+	report("rn_buffer_print %lu", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		rn_buffer_reset(buffer);
+		for (j = 0; j < NB_VALUES; j++) {
+			rn_buffer_addu64(buffer, integers[j]);
+		}
+	}
+	report("rn_buffer_addu64", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		rn_buffer_reset(buffer);
+		for (j = 0; j < NB_VALUES; j++) {
+			rn_buffer_print(buffer, "%.17g", doubles[j]);
+		}
+	}
+	report("rn_buffer_print %.17g", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		rn_buffer_reset(buffer);
+		for (j = 0; j < NB_VALUES; j++) {
+			rn_buffer_adddouble(buffer, doubles[j]);
+		}
+	}
+	report("rn_buffer_adddouble", start);
+}
+
+static void bench_parse(void)
+{
+	long long i;
+	long long start;
+	size_t j;
+	size_t len;
+	double dvalue;
+	uint64_t uvalue;
+	char *endptr;
+	char dstr[NB_VALUES][RN_DTOA_MAX + 1];
+	char ustr[NB_VALUES][RN_U64TOA_MAX + 1];
+
+	for (j = 0; j < NB_VALUES; j++) {
+		ustr[j][rn_u64toa(ustr[j], integers[j])] = 0;
+		dstr[j][rn_dtoa(dstr[j], doubles[j])] = 0;
+	}
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		for (j = 0; j < NB_VALUES; j++) {
+			uvalue = strtoull(ustr[j], &endptr, 10);
+			XTEST(uvalue == integers[j]);
+		}
+	}
+	report("strtoull", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		for (j = 0; j < NB_VALUES; j++) {
+			len = rn_atou64(ustr[j], RN_U64TOA_MAX, &uvalue);
+			XTEST(len > 0 && uvalue == integers[j]);
+		}
+	}
+	report("rn_atou64", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		for (j = 0; j < NB_VALUES; j++) {
+			dvalue = strtod(dstr[j], &endptr);
+			XTEST(dvalue == doubles[j]);
+		}
+	}
+	report("strtod", start);
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		for (j = 0; j < NB_VALUES; j++) {
+			len = rn_strntod(dstr[j], RN_DTOA_MAX, &dvalue);
+			XTEST(len > 0 && dvalue == doubles[j]);
+		}
+	}
+	report("rn_strntod", start);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -n loops\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	rn_buffer_t *buffer;
+
+	while ((ch = getopt(argc, argv, "hn:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'n':
+			loops = atoll(optarg);
+			if (loops < 1) {
+				loops = 1;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	/* Typical values: sizes, counters and prices */
+	for (i = 0; i < NB_VALUES; i++) {
+		integers[i] = ((uint64_t) random() * random()) >> (i % 48);
+		doubles[i] = (double) (random() % 10000000) / 100;
+	}
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	bench_format(buffer);
+	bench_parse();
+	rn_buffer_destroy(buffer);
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file   rn_scan.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Scanning kernels benchmark against libc, for each kernel level.
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+static size_t size = 4096;
+static long long loops = 100000;
+static volatile size_t sink;
+
+static const char *level_name(rn_scan_level_t level)
+{
+	switch (level) {
+	case RN_SCAN_SCALAR:
+		return "scalar";
+	case RN_SCAN_SSE42:
+		return "sse4.2";
+	case RN_SCAN_AVX2:
+		return "avx2";
+	default:
+		return "auto";
+	}
+}
+
+static void report(const char *kernel, const char *impl, long long duration)
+{
+	printf("%-14s %-8s (%zu bytes): %8.2f ns/call, %6.2f GB/s\n",
+		kernel, impl, size, (double) duration / loops, (double) size * loops / duration);
+}
+
+static void bench_mem(const char *kernel, const char *data, const char *delim, rn_scan_level_t level)
+{
+	long long i;
+	long long start;
+
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		if (level == RN_SCAN_AUTO) {
+			sink += (size_t) memmem(data, size, delim, strlen(delim));
+		} else {
+			sink += (size_t) rn_scan_mem(data, size, delim, strlen(delim));
+		}
+	}
+	report(kernel, (level == RN_SCAN_AUTO ? "libc" : level_name(level)), clock_ns() - start);
+}
+
+static void bench_set(const char *data, const char *set, rn_scan_level_t level)
+{
+	long long i;
+	long long start;
+
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		if (level == RN_SCAN_AUTO) {
+			sink += strcspn(data, set);
+		} else {
+			sink += rn_scan_set(data, size, set);
+		}
+	}
+	report("set", (level == RN_SCAN_AUTO ? "libc" : level_name(level)), clock_ns() - start);
+}
+
+static void bench_casecmp(const char *data1, const char *data2, rn_scan_level_t level)
+{
+	long long i;
+	long long start;
+
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		if (level == RN_SCAN_AUTO) {
+			sink += strncasecmp(data1, data2, size);
+		} else {
+			sink += rn_scan_casecmp(data1, data2, size);
+		}
+	}
+	report("casecmp", (level == RN_SCAN_AUTO ? "libc" : level_name(level)), clock_ns() - start);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -s size -n loops\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	char *data;
+	char *upper;
+	rn_scan_level_t level;
+	const char header[] = "Accept-Encoding: gzip, deflate; Cache-Control: no-cache x-forwarded-for 10.0.0.1 ";
+
+	while ((ch = getopt(argc, argv, "hs:n:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 's':
+			size = atol(optarg);
+			if (size < 4) {
+				size = 4;
+			}
+			break;
+		case 'n':
+			loops = atoll(optarg);
+			if (loops < 1) {
+				loops = 1;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	data = malloc(size + 1);
+	upper = malloc(size + 1);
+	XTEST(data != NULL);
+	XTEST(upper != NULL);
+	/* Delimiters only appear at the very end */
+	for (i = 0; i < size; i++) {
+		data[i] = header[i % (sizeof(header) - 1)];
+		upper[i] = toupper(data[i]);
+	}
+	memcpy(data + size - 4, "\r\n\r\n", 4);
+	memcpy(upper + size - 4, "\r\n\r\n", 4);
+	data[size] = 0;
+	upper[size] = 0;
+	printf("Best kernel level: %s\n", level_name(rn_scan_level()));
+	for (level = RN_SCAN_SCALAR; level <= RN_SCAN_AUTO; level++) {
+		if (level != RN_SCAN_AUTO && rn_scan_setlevel(level) != level) {
+			continue;
+		}
+		bench_mem("crlf", data, "\r\n", level);
+		bench_mem("crlfcrlf", data, "\r\n\r\n", level);
+		bench_set(data, "\r\n", level);
+		bench_casecmp(data, upper, level);
+	}
+	rn_scan_setlevel(RN_SCAN_AUTO);
+	free(data);
+	free(upper);
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file   rn_slab.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Slab allocator benchmark: loopback accept/request/close
+ *         throughput and small object churn against glibc malloc.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define BENCH_PORT	4243
+#define BENCH_BATCH	4096
+
+static long long connections = 10000;
+static long long remaining;
+static int nbclients = 32;
+
+static long rss_kb(void)
+{
+	long rss;
+	FILE *statm;
+
+	rss = 0;
+	statm = fopen("/proc/self/statm", "r");
+	if (statm != NULL) {
+		if (fscanf(statm, "%*s %ld", &rss) != 1) {
+			rss = 0;
+		}
+		fclose(statm);
+	}
+	return rss * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static void process_client(void *arg)
+{
+	char request[64];
+	rn_socket_t *socket = arg;
+
+	if (rn_socket_read(socket, request, sizeof(request)) > 0) {
+		rn_socket_write(socket, "OK\r\n", 4);
+	}
+	rn_socket_destroy(socket);
+}
+
+static void server_func(void *arg)
+{
+	long long i;
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	server = rn_tcp_server(sched, &addr, NULL);
+	XTEST(server != NULL);
+	for (i = 0; i < connections; i++) {
+		client = rn_socket_accept(server, NULL);
+		if (client == NULL) {
+			break;
+		}
+		rn_task_start(sched, process_client, client);
+	}
+	rn_socket_destroy(server);
+}
+
+static void client_func(void *arg)
+{
+	char reply[8];
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	while (remaining > 0) {
+		remaining--;
+		socket = rn_tcp_client(sched, &addr, 0, NULL);
+		if (socket == NULL) {
+			continue;
+		}
+		if (rn_socket_write(socket, "GET / HTTP/1.1\r\n\r\n", 18) == 18) {
+			rn_socket_read(socket, reply, sizeof(reply));
+		}
+		rn_socket_destroy(socket);
+	}
+}
+
+static void bench_accept(const char *name, bool slab)
+{
+	int i;
+	long rss;
+	rn_sched_t *sched;
+	long long start, duration;
+
+	remaining = connections;
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	if (!slab) {
+		/* Every scheduler allocation goes to rn_malloc */
+		sched->slab.nbclasses = 0;
+	}
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	for (i = 0; i < nbclients; i++) {
+		XTEST(rn_task_start(sched, client_func, sched) == 0);
+	}
+	rss = rss_kb();
+	start = clock_ns();
+	rn_scheduler_loop(sched);
+	duration = clock_ns() - start;
+	printf("%-12s accept+request+close (%lld connections, %d clients): %.0f conn/s, rss +%ld kB, %zu slab chunks\n",
+		name, connections, nbclients, 1000000000.0 * connections / duration, rss_kb() - rss, sched->slab.nbchunks);
+	rn_scheduler_destroy(sched);
+}
+
+static void bench_churn(const char *name, rn_slab_t *slab, long long loops)
+{
+	long rss;
+	long long i, j;
+	void *objects[BENCH_BATCH];
+	long long start, duration;
+
+	rss = rss_kb();
+	start = clock_ns();
+	for (i = 0; i < loops; i++) {
+		for (j = 0; j < BENCH_BATCH; j++) {
+			objects[j] = (slab != NULL ? rn_slab_alloc(slab, sizeof(rn_socket_t)) : malloc(sizeof(rn_socket_t)));
+		}
+		for (j = 0; j < BENCH_BATCH; j++) {
+			if (slab != NULL) {
+				rn_slab_free(objects[j]);
+			} else {
+				free(objects[j]);
+			}
+		}
+	}
+	duration = clock_ns() - start;
+	printf("%-12s (%lld x %d objects of %zu bytes): %.2f ns/op, rss +%ld kB\n",
+		name, loops, BENCH_BATCH, sizeof(rn_socket_t), (double) duration / (loops * BENCH_BATCH * 2), rss_kb() - rss);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -n connections -c clients\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	rn_slab_t slab;
+
+	while ((ch = getopt(argc, argv, "hn:c:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'n':
+			connections = atoll(optarg);
+			if (connections < 1) {
+				connections = 1;
+			}
+			break;
+		case 'c':
+			nbclients = atoi(optarg);
+			if (nbclients < 1) {
+				nbclients = 1;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	bench_accept("rn_slab", true);
+	bench_accept("glibc malloc", false);
+	XTEST(rn_slab(&slab) == 0);
+	bench_churn("rn_slab", &slab, 2000);
+	rn_slab_destroy(&slab);
+	bench_churn("glibc malloc", NULL, 2000);
+	XPASS();
+	return 0;
+}
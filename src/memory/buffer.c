@@ -10,14 +10,17 @@
 
 #include "rinoo/memory/module.h"
 
+static void *rn_buffer_default_realloc(rn_buffer_t *buffer, size_t newsize);
+
 static rn_buffer_class_t default_class = {
 	.inisize = RN_BUFFER_HELPER_INISIZE,
 	.maxsize = RN_BUFFER_HELPER_MAXSIZE,
 	.init = NULL,
 	.growthsize = rn_buffer_helper_growthsize,
 	.malloc = rn_buffer_helper_malloc,
-	.realloc = rn_buffer_helper_realloc,
+	.realloc = rn_buffer_default_realloc,
 	.free = rn_buffer_helper_free,
+	.reset = NULL,
 };
 
 static rn_buffer_class_t static_class = {
@@ -28,8 +31,26 @@ static rn_buffer_class_t static_class = {
 	.malloc = NULL,
 	.realloc = NULL,
 	.free = NULL,
+	.reset = NULL,
 };
 
+/**
+ * Default buffer class realloc function. Buffers growing past
+ * RN_BUFFER_MAP_THRESHOLD move to mapped memory.
+ *
+ * @param buffer Pointer to the buffer
+ * @param newsize New memory size
+ *
+ * @return Pointer to the new memory or NULL if an error occurs
+ */
+static void *rn_buffer_default_realloc(rn_buffer_t *buffer, size_t newsize)
+{
+	if (newsize >= RN_BUFFER_MAP_THRESHOLD) {
+		return rn_buffer_map_migrate(buffer, newsize);
+	}
+	return rn_buffer_helper_realloc(buffer, newsize);
+}
+
 /**
  * Creates a new buffer. It uses the buffer class for memory allocation.
  * If class is NULL, then default buffer class is used.
@@ -42,7 +63,7 @@ rn_buffer_t *rn_buffer_create(rn_buffer_class_t *class)
 {
 	rn_buffer_t *buffer;
 
-	buffer = calloc(1, sizeof(*buffer));
+	buffer = rn_calloc(1, sizeof(*buffer));
 	if (buffer == NULL) {
 		return NULL;
 	}
@@ -52,13 +73,13 @@ rn_buffer_t *rn_buffer_create(rn_buffer_class_t *class)
 	buffer->class = class;
 	buffer->msize = class->inisize;
 	if (class->init != NULL && class->init(buffer) != 0) {
-		free(buffer);
+		rn_free(buffer);
 		return NULL;
 	}
 	if (class->malloc != NULL) {
 		buffer->ptr = class->malloc(buffer, class->inisize);
 		if (buffer->ptr == NULL) {
-			free(buffer);
+			rn_free(buffer);
 			return NULL;
 		}
 	}
@@ -77,6 +98,7 @@ void rn_buffer_static(rn_buffer_t *buffer, void *ptr, size_t size)
 	buffer->ptr = ptr;
 	buffer->size = size;
 	buffer->msize = 0;
+	buffer->offset = 0;
 	buffer->class = &static_class;
 }
 
@@ -94,6 +116,7 @@ void rn_buffer_init(rn_buffer_t *buffer, void *ptr, size_t msize)
 	buffer->ptr = ptr;
 	buffer->size = 0;
 	buffer->msize = msize;
+	buffer->offset = 0;
 	buffer->class = &static_class;
 }
 
@@ -107,12 +130,13 @@ void rn_buffer_init(rn_buffer_t *buffer, void *ptr, size_t msize)
 int rn_buffer_destroy(rn_buffer_t *buffer)
 {
 	if (buffer->ptr != NULL && buffer->class->free != NULL) {
+		rn_buffer_rewind(buffer);
 		if (buffer->class->free(buffer) != 0) {
 			return -1;
 		}
 		buffer->ptr = NULL;
 	}
-	free(buffer);
+	rn_free(buffer);
 	return 0;
 }
 
@@ -132,6 +156,13 @@ int rn_buffer_extend(rn_buffer_t *buffer, size_t size)
 	if (buffer->class->growthsize == NULL || buffer->class->realloc == NULL) {
 		return -1;
 	}
+	if (buffer->offset > 0) {
+		/* Reclaims space erased from the front before growing */
+		rn_buffer_compact(buffer);
+		if (buffer->msize >= size) {
+			return 0;
+		}
+	}
 	msize = buffer->class->growthsize(buffer, size);
 	if (msize < size) {
 		return -1;
@@ -196,6 +227,22 @@ int rn_buffer_print(rn_buffer_t *buffer, const char *format, ...)
 	return res;
 }
 
+/**
+ * Makes sure a buffer has room for more data.
+ *
+ * @param buffer Pointer to the buffer
+ * @param size Size of the data to be added
+ *
+ * @return 0 on success, or -1 if an error occurs
+ */
+static int rn_buffer_reserve(rn_buffer_t *buffer, size_t size)
+{
+	if (size + buffer->size > buffer->msize && rn_buffer_extend(buffer, size + buffer->size) < 0) {
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * Adds data to a buffer. If the buffer is to small, this function
  * will try to extend it.
@@ -230,6 +277,67 @@ int rn_buffer_addstr(rn_buffer_t *buffer, const char *str)
 	return rn_buffer_add(buffer, str, strlen(str));
 }
 
+/**
+ * Adds an unsigned integer in decimal to a buffer.
+ *
+ * @param buffer Buffer where the number will be added
+ * @param value Number to add
+ *
+ * @return Number of bytes added on success, or -1 if an error occurs
+ */
+int rn_buffer_addu64(rn_buffer_t *buffer, uint64_t value)
+{
+	size_t len;
+
+	if (rn_buffer_reserve(buffer, RN_U64TOA_MAX) != 0) {
+		return -1;
+	}
+	len = rn_u64toa(buffer->ptr + buffer->size, value);
+	buffer->size += len;
+	return len;
+}
+
+/**
+ * Adds a signed integer in decimal to a buffer.
+ *
+ * @param buffer Buffer where the number will be added
+ * @param value Number to add
+ *
+ * @return Number of bytes added on success, or -1 if an error occurs
+ */
+int rn_buffer_addi64(rn_buffer_t *buffer, int64_t value)
+{
+	size_t len;
+
+	if (rn_buffer_reserve(buffer, RN_I64TOA_MAX) != 0) {
+		return -1;
+	}
+	len = rn_i64toa(buffer->ptr + buffer->size, value);
+	buffer->size += len;
+	return len;
+}
+
+/**
+ * Adds a double to a buffer, using the shortest representation
+ * which reads back to the same value.
+ *
+ * @param buffer Buffer where the number will be added
+ * @param value Number to add
+ *
+ * @return Number of bytes added on success, or -1 if an error occurs
+ */
+int rn_buffer_adddouble(rn_buffer_t *buffer, double value)
+{
+	size_t len;
+
+	if (rn_buffer_reserve(buffer, RN_DTOA_MAX) != 0) {
+		return -1;
+	}
+	len = rn_dtoa(buffer->ptr + buffer->size, value);
+	buffer->size += len;
+	return len;
+}
+
 /**
  * Adds a null byte to the end of a buffer.
  *
@@ -246,8 +354,9 @@ int rn_buffer_addnull(rn_buffer_t *buffer)
 }
 
 /**
- * Erases beginning data in the buffer and moves the rest
- * to the beginning. This function does -not- reduce the buffer.
+ * Erases beginning data in the buffer. Data is not moved: the buffer
+ * start is advanced, and erased space is reclaimed when the buffer
+ * gets empty or needs to be extended. This function does -not- reduce the buffer.
  *
  * @param buffer Buffer where data will be erased.
  * @param size Size to erase. If 0, the whole buffer is erased.
@@ -260,14 +369,36 @@ int rn_buffer_erase(rn_buffer_t *buffer, size_t size)
 		return -1;
 	}
 	if (size == 0 || size >= buffer->size) {
-		buffer->size = 0;
+		rn_buffer_reset(buffer);
 	} else {
-		memmove(buffer->ptr, buffer->ptr + size, buffer->size - size);
+		buffer->ptr += size;
 		buffer->size -= size;
+		buffer->offset += size;
+		if (buffer->msize != 0) {
+			buffer->msize -= size;
+		}
 	}
 	return 0;
 }
 
+/**
+ * Moves buffer data back to the allocation start,
+ * reclaiming space erased with rn_buffer_erase.
+ *
+ * @param buffer Pointer to the buffer to compact.
+ */
+void rn_buffer_compact(rn_buffer_t *buffer)
+{
+	if (buffer->offset == 0 || rn_buffer_isshared(buffer)) {
+		/* Shared buffers are immutable */
+		return;
+	}
+	if (buffer->size > 0) {
+		memmove(buffer->ptr - buffer->offset, buffer->ptr, buffer->size);
+	}
+	rn_buffer_rewind(buffer);
+}
+
 /**
  * Duplicates a buffer.
  *
@@ -283,22 +414,23 @@ rn_buffer_t *rn_buffer_dup_class(rn_buffer_t *buffer, rn_buffer_class_t *class)
 	if (class->malloc == NULL) {
 		return NULL;
 	}
-	newbuffer = malloc(sizeof(*newbuffer));
+	newbuffer = rn_malloc(sizeof(*newbuffer));
 	if (unlikely(newbuffer == NULL)) {
 		return NULL;
 	}
 	*newbuffer = *buffer;
+	newbuffer->offset = 0;
 	if (newbuffer->msize == 0) {
 		newbuffer->msize = buffer->size;
 	}
 	newbuffer->class = class;
 	if (class->init != NULL && class->init(newbuffer) != 0) {
-		free(newbuffer);
+		rn_free(newbuffer);
 		return NULL;
 	}
 	newbuffer->ptr = class->malloc(newbuffer, newbuffer->msize);
 	if (unlikely(newbuffer->ptr == NULL)) {
-		free(newbuffer);
+		rn_free(newbuffer);
 		return NULL;
 	}
 	memcpy(newbuffer->ptr, buffer->ptr, buffer->size);
@@ -307,6 +439,7 @@ rn_buffer_t *rn_buffer_dup_class(rn_buffer_t *buffer, rn_buffer_class_t *class)
 
 /**
  * Duplicates a buffer.
+ * Shared buffers are not copied, a new reference is returned instead.
  *
  * @param buffer Pointer to the buffer to duplicate.
  *
@@ -314,6 +447,9 @@ rn_buffer_t *rn_buffer_dup_class(rn_buffer_t *buffer, rn_buffer_class_t *class)
  */
 rn_buffer_t *rn_buffer_dup(rn_buffer_t *buffer)
 {
+	if (rn_buffer_isshared(buffer)) {
+		return rn_buffer_ref(buffer);
+	}
 	return rn_buffer_dup_class(buffer, buffer->class);
 }
 
@@ -347,32 +483,15 @@ int rn_buffer_cmp(rn_buffer_t *buffer1, rn_buffer_t *buffer2)
  */
 int rn_buffer_casecmp(rn_buffer_t *buffer1, rn_buffer_t *buffer2)
 {
-	char c1;
-	char c2;
-	size_t i;
+	int ret;
 	size_t min;
 
 	min = (rn_buffer_size(buffer1) < rn_buffer_size(buffer2) ? rn_buffer_size(buffer1) : rn_buffer_size(buffer2));
-	for (i = 0; i < min; i++) {
-		c1 = ((const char *) rn_buffer_ptr(buffer1))[i];
-		c2 = ((const char *) rn_buffer_ptr(buffer2))[i];
-		switch (c1) {
-			case 'a' ... 'z':
-				if (c2 >= 'A' && c2 <= 'Z') {
-					c2 += 'a' - 'A';
-				}
-				break;
-			case 'A' ... 'Z':
-				if (c2 >= 'a' && c2 <= 'z') {
-					c1 += 'a' - 'A';
-				}
-				break;
-		}
-		if (c1 != c2) {
-			return c1 - c2;
-		}
+	ret = rn_scan_casecmp(rn_buffer_ptr(buffer1), rn_buffer_ptr(buffer2), min);
+	if (ret == 0) {
+		ret = rn_buffer_size(buffer1) - rn_buffer_size(buffer2);
 	}
-	return rn_buffer_size(buffer1) - rn_buffer_size(buffer2);
+	return ret;
 }
 
 /**
@@ -436,7 +555,7 @@ int rn_buffer_strcasecmp(rn_buffer_t *buffer, const char *str)
 
 	len = strlen(str);
 	min = (rn_buffer_size(buffer) < len ? rn_buffer_size(buffer) : len);
-	ret = strncasecmp(rn_buffer_ptr(buffer), str, min);
+	ret = rn_scan_casecmp(rn_buffer_ptr(buffer), str, min);
 	if (ret == 0) {
 		ret = rn_buffer_size(buffer) - len;
 	}
@@ -458,7 +577,7 @@ int rn_buffer_strncasecmp(rn_buffer_t *buffer, const char *str, size_t len)
 	size_t min;
 
 	min = (rn_buffer_size(buffer) < len ? rn_buffer_size(buffer) : len);
-	ret = strncasecmp(rn_buffer_ptr(buffer), str, min);
+	ret = rn_scan_casecmp(rn_buffer_ptr(buffer), str, min);
 	if (ret == 0 && rn_buffer_size(buffer) < len) {
 		ret = rn_buffer_size(buffer) - len;
 	}
@@ -467,6 +586,7 @@ int rn_buffer_strncasecmp(rn_buffer_t *buffer, const char *str, size_t len)
 
 /**
  * Converts a buffer to a long int accordingly to strtol.
+ * The buffer does not need to be null-terminated.
  *
  * @param buffer Pointer to a buffer to convert.
  * @param len If not NULL, it stores the buffer length processed for conversion.
@@ -476,37 +596,19 @@ int rn_buffer_strncasecmp(rn_buffer_t *buffer, const char *str, size_t len)
  */
 long int rn_buffer_tolong(rn_buffer_t *buffer, size_t *len, int base)
 {
+	size_t size;
 	long int result;
-	char *endptr;
-	rn_buffer_t *workbuf;
-
-	workbuf = buffer;
-	if (buffer->msize == 0) {
-		/* Considering buffer->ptr has not been allocated */
-		workbuf = rn_buffer_dup_class(buffer, &default_class);
-		if (workbuf == NULL) {
-			return 0;
-		}
-	}
-	result = 0;
-	endptr = workbuf->ptr;
-	if (rn_buffer_addnull(workbuf) == 0) {
-		result = strtol(workbuf->ptr, &endptr, base);
-	}
+
+	size = rn_strntol(buffer->ptr, buffer->size, base, &result);
 	if (len != NULL) {
-		*len = endptr - (char *) workbuf->ptr;
-	}
-	if (workbuf != buffer) {
-		rn_buffer_destroy(workbuf);
-	} else {
-		/* Removing null byte */
-		buffer->size--;
+		*len = size;
 	}
 	return result;
 }
 
 /**
  * Converts a buffer to an unsigned long int accordingly to strtoul.
+ * The buffer does not need to be null-terminated.
  *
  * @param buffer Pointer to a buffer to convert.
  * @param len If not NULL, it stores the buffer length processed for conversion.
@@ -516,37 +618,19 @@ long int rn_buffer_tolong(rn_buffer_t *buffer, size_t *len, int base)
  */
 unsigned long int rn_buffer_toulong(rn_buffer_t *buffer, size_t *len, int base)
 {
-	char *endptr;
-	rn_buffer_t *workbuf;
+	size_t size;
 	unsigned long int result;
 
-	workbuf = buffer;
-	if (buffer->msize == 0) {
-		/* Considering buffer->ptr has not been allocated */
-		workbuf = rn_buffer_dup_class(buffer, &default_class);
-		if (workbuf == NULL) {
-			return 0;
-		}
-	}
-	result = 0;
-	endptr = workbuf->ptr;
-	if (rn_buffer_addnull(workbuf) == 0) {
-		result = strtoul(workbuf->ptr, &endptr, base);
-	}
+	size = rn_strntoul(buffer->ptr, buffer->size, base, &result);
 	if (len != NULL) {
-		*len = endptr - (char *) workbuf->ptr;
-	}
-	if (workbuf != buffer) {
-		rn_buffer_destroy(workbuf);
-	} else {
-		/* Removing null byte */
-		buffer->size--;
+		*len = size;
 	}
 	return result;
 }
 
 /**
  * Converts a buffer to a float accordingly to strtof.
+ * The buffer does not need to be null-terminated.
  *
  * @param buffer Pointer to a buffer to convert.
  * @param len If not NULL, it stores the buffer length processed for conversion.
@@ -555,37 +639,20 @@ unsigned long int rn_buffer_toulong(rn_buffer_t *buffer, size_t *len, int base)
  */
 float rn_buffer_tofloat(rn_buffer_t *buffer, size_t *len)
 {
+	size_t size;
 	float result;
-	char *endptr;
-	rn_buffer_t *workbuf;
-
-	workbuf = buffer;
-	if (buffer->msize == 0) {
-		/* Considering buffer->ptr has not been allocated */
-		workbuf = rn_buffer_dup_class(buffer, &default_class);
-		if (workbuf == NULL) {
-			return 0;
-		}
-	}
+
 	result = 0;
-	endptr = workbuf->ptr;
-	if (rn_buffer_addnull(workbuf) == 0) {
-		result = strtof(workbuf->ptr, &endptr);
-	}
+	size = rn_strntof(buffer->ptr, buffer->size, &result);
 	if (len != NULL) {
-		*len = endptr - (char *) workbuf->ptr;
-	}
-	if (workbuf != buffer) {
-		rn_buffer_destroy(workbuf);
-	} else {
-		/* Removing null byte */
-		buffer->size--;
+		*len = size;
 	}
 	return result;
 }
 
 /**
  * Converts a buffer to a double accordingly to strtod.
+ * The buffer does not need to be null-terminated.
  *
  * @param buffer Pointer to a buffer to convert.
  * @param len If not NULL, it stores the buffer length processed for conversion.
@@ -594,31 +661,55 @@ float rn_buffer_tofloat(rn_buffer_t *buffer, size_t *len)
  */
 double rn_buffer_todouble(rn_buffer_t *buffer, size_t *len)
 {
+	size_t size;
 	double result;
-	char *endptr;
-	rn_buffer_t *workbuf;
-
-	workbuf = buffer;
-	if (buffer->msize == 0) {
-		/* Considering buffer->ptr has not been allocated */
-		workbuf = rn_buffer_dup_class(buffer, &default_class);
-		if (workbuf == NULL) {
-			return 0;
-		}
-	}
+
 	result = 0;
-	endptr = workbuf->ptr;
-	if (rn_buffer_addnull(workbuf) == 0) {
-		result = strtod(workbuf->ptr, &endptr);
+	size = rn_strntod(buffer->ptr, buffer->size, &result);
+	if (len != NULL) {
+		*len = size;
 	}
+	return result;
+}
+
+/**
+ * Converts a buffer to an unsigned 64 bits integer. Only decimal
+ * digits are accepted: no space, sign or base prefix.
+ *
+ * @param buffer Pointer to a buffer to convert.
+ * @param len If not NULL, it stores the buffer length processed for conversion, 0 on overflow.
+ *
+ * @return Result of conversion.
+ */
+uint64_t rn_buffer_tou64(rn_buffer_t *buffer, size_t *len)
+{
+	size_t size;
+	uint64_t result;
+
+	size = rn_atou64(buffer->ptr, buffer->size, &result);
 	if (len != NULL) {
-		*len = endptr - (char *) workbuf->ptr;
+		*len = size;
 	}
-	if (workbuf != buffer) {
-		rn_buffer_destroy(workbuf);
-	} else {
-		/* Removing null byte */
-		buffer->size--;
+	return result;
+}
+
+/**
+ * Converts a buffer to a signed 64 bits integer. Only an optional
+ * sign followed by decimal digits is accepted.
+ *
+ * @param buffer Pointer to a buffer to convert.
+ * @param len If not NULL, it stores the buffer length processed for conversion, 0 on overflow.
+ *
+ * @return Result of conversion.
+ */
+int64_t rn_buffer_toi64(rn_buffer_t *buffer, size_t *len)
+{
+	size_t size;
+	int64_t result;
+
+	size = rn_atoi64(buffer->ptr, buffer->size, &result);
+	if (len != NULL) {
+		*len = size;
 	}
 	return result;
 }
@@ -650,27 +741,112 @@ char *rn_buffer_tostr(rn_buffer_t *buffer)
  */
 int rn_buffer_b64encode(rn_buffer_t *dst, rn_buffer_t *src)
 {
-	static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-	size_t i;
-	char cur;
-	int shift;
-	unsigned int bits;
-
-	bits = 0;
-	shift = 0;
-	for (i = 0; i < rn_buffer_size(src); i++)
-	{
-		bits = (bits << 8) + ((unsigned char *) rn_buffer_ptr(src))[i];
-		shift += 8;
-		do {
-			cur = b64[(bits << 6 >> shift) & 0x3f];
-			rn_buffer_add(dst, &cur, 1);
-			shift -= 6;
-		}
-		while (shift > 6 || (i == rn_buffer_size(src) - 1 && shift > 0));
+	if (rn_buffer_reserve(dst, RN_B64_ENCLEN(rn_buffer_size(src))) != 0) {
+		return -1;
+	}
+	dst->size += rn_b64_encode(dst->ptr + dst->size, src->ptr, src->size, RN_B64_STD);
+	return 0;
+}
+
+/**
+ * Encodes a buffer to URL-safe base64, without padding.
+ *
+ * @param dst Pointer to the buffer to store the encoded string.
+ * @param src Pointer to the buffer to encode.
+ *
+ * @return 0 on success, or -1 if an error occurs
+ */
+int rn_buffer_b64urlencode(rn_buffer_t *dst, rn_buffer_t *src)
+{
+	if (rn_buffer_reserve(dst, RN_B64_ENCLEN(rn_buffer_size(src))) != 0) {
+		return -1;
 	}
-	while (rn_buffer_size(dst) & 3) {
-		rn_buffer_add(dst, "=", 1);
+	dst->size += rn_b64_encode(dst->ptr + dst->size, src->ptr, src->size, RN_B64_URL);
+	return 0;
+}
+
+/**
+ * Decodes a base64 buffer.
+ *
+ * @param dst Pointer to the buffer to store decoded data.
+ * @param src Pointer to the buffer to decode.
+ *
+ * @return 0 on success, or -1 if an error occurs or src is not valid base64
+ */
+int rn_buffer_b64decode(rn_buffer_t *dst, rn_buffer_t *src)
+{
+	ssize_t res;
+
+	if (rn_buffer_reserve(dst, RN_B64_DECLEN(rn_buffer_size(src))) != 0) {
+		return -1;
+	}
+	res = rn_b64_decode(dst->ptr + dst->size, src->ptr, src->size, RN_B64_STD);
+	if (res < 0) {
+		return -1;
+	}
+	dst->size += res;
+	return 0;
+}
+
+/**
+ * Decodes a URL-safe base64 buffer.
+ *
+ * @param dst Pointer to the buffer to store decoded data.
+ * @param src Pointer to the buffer to decode.
+ *
+ * @return 0 on success, or -1 if an error occurs or src is not valid base64
+ */
+int rn_buffer_b64urldecode(rn_buffer_t *dst, rn_buffer_t *src)
+{
+	ssize_t res;
+
+	if (rn_buffer_reserve(dst, RN_B64_DECLEN(rn_buffer_size(src))) != 0) {
+		return -1;
+	}
+	res = rn_b64_decode(dst->ptr + dst->size, src->ptr, src->size, RN_B64_URL);
+	if (res < 0) {
+		return -1;
+	}
+	dst->size += res;
+	return 0;
+}
+
+/**
+ * Encodes a buffer to lowercase hex.
+ *
+ * @param dst Pointer to the buffer to store the encoded string.
+ * @param src Pointer to the buffer to encode.
+ *
+ * @return 0 on success, or -1 if an error occurs
+ */
+int rn_buffer_hexencode(rn_buffer_t *dst, rn_buffer_t *src)
+{
+	if (rn_buffer_reserve(dst, RN_HEX_ENCLEN(rn_buffer_size(src))) != 0) {
+		return -1;
+	}
+	dst->size += rn_hex_encode(dst->ptr + dst->size, src->ptr, src->size);
+	return 0;
+}
+
+/**
+ * Decodes a hex buffer.
+ *
+ * @param dst Pointer to the buffer to store decoded data.
+ * @param src Pointer to the buffer to decode.
+ *
+ * @return 0 on success, or -1 if an error occurs or src is not valid hex
+ */
+int rn_buffer_hexdecode(rn_buffer_t *dst, rn_buffer_t *src)
+{
+	ssize_t res;
+
+	if (rn_buffer_reserve(dst, RN_HEX_DECLEN(rn_buffer_size(src))) != 0) {
+		return -1;
+	}
+	res = rn_hex_decode(dst->ptr + dst->size, src->ptr, src->size);
+	if (res < 0) {
+		return -1;
 	}
+	dst->size += res;
 	return 0;
 }
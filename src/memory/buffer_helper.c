@@ -23,17 +23,17 @@ size_t rn_buffer_helper_growthsize(rn_buffer_t *buffer, size_t newsize)
 
 void *rn_buffer_helper_malloc(rn_buffer_t *unused(buffer), size_t size)
 {
-	return malloc(size);
+	return rn_malloc(size);
 }
 
 void *rn_buffer_helper_realloc(rn_buffer_t *buffer, size_t newsize)
 {
-	return realloc(buffer->ptr, newsize);
+	return rn_realloc(buffer->ptr, buffer->msize, newsize);
 }
 
 int rn_buffer_helper_free(rn_buffer_t *buffer)
 {
-	free(buffer->ptr);
+	rn_free(buffer->ptr);
 	buffer->ptr = NULL;
 	return 0;
 }
@@ -0,0 +1,212 @@
+/**
+ * @file   buffer_map.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Mapped buffer class. Buffer memory is an anonymous mapping
+ *         which grows with mremap, so large buffers are never copied
+ *         when extended. Pages past RN_BUFFER_MAP_KEEP are given back
+ *         to the system when the buffer is reset.
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "rinoo/memory/module.h"
+
+static bool rn_buffer_map_hugepages = false;
+
+static void *rn_buffer_map_class_malloc(rn_buffer_t *buffer, size_t size);
+static void *rn_buffer_map_class_realloc(rn_buffer_t *buffer, size_t newsize);
+static int rn_buffer_map_class_free(rn_buffer_t *buffer);
+static void rn_buffer_map_class_reset(rn_buffer_t *buffer);
+
+static rn_buffer_class_t map_class = {
+	.inisize = RN_BUFFER_MAP_THRESHOLD,
+	.maxsize = RN_BUFFER_HELPER_MAXSIZE,
+	.init = NULL,
+	.growthsize = rn_buffer_helper_growthsize,
+	.malloc = rn_buffer_map_class_malloc,
+	.realloc = rn_buffer_map_class_realloc,
+	.free = rn_buffer_map_class_free,
+	.reset = rn_buffer_map_class_reset,
+};
+
+/**
+ * Gets the mapping length of a buffer memory size.
+ *
+ * @param size Buffer memory size
+ *
+ * @return Size rounded up to the page size
+ */
+static inline size_t rn_buffer_map_length(size_t size)
+{
+	static size_t pagesize = 0;
+
+	if (pagesize == 0) {
+		pagesize = sysconf(_SC_PAGESIZE);
+	}
+	return (size + pagesize - 1) & ~(pagesize - 1);
+}
+
+/**
+ * Asks for transparent huge pages on a mapping, if enabled.
+ *
+ * @param ptr Mapping start
+ * @param length Mapping length
+ */
+static void rn_buffer_map_advise(void *ptr, size_t length)
+{
+#ifdef MADV_HUGEPAGE
+	if (rn_buffer_map_hugepages && length >= RN_BUFFER_MAP_HUGEPAGE) {
+		madvise(ptr, length, MADV_HUGEPAGE);
+	}
+#else
+	(void) ptr;
+	(void) length;
+#endif
+}
+
+/**
+ * Mapped buffer class malloc function.
+ *
+ * @param buffer Unused
+ * @param size Memory size
+ *
+ * @return Pointer to the mapping or NULL if an error occurs
+ */
+static void *rn_buffer_map_class_malloc(rn_buffer_t *unused(buffer), size_t size)
+{
+	void *ptr;
+	size_t length;
+
+	length = rn_buffer_map_length(size);
+	ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) {
+		return NULL;
+	}
+	rn_buffer_map_advise(ptr, length);
+	return ptr;
+}
+
+/**
+ * Mapped buffer class realloc function. The mapping is grown in place
+ * or moved by the kernel, data is never copied.
+ *
+ * @param buffer Pointer to the buffer
+ * @param newsize New memory size
+ *
+ * @return Pointer to the new mapping or NULL if an error occurs
+ */
+static void *rn_buffer_map_class_realloc(rn_buffer_t *buffer, size_t newsize)
+{
+	void *ptr;
+	size_t length;
+
+	length = rn_buffer_map_length(newsize);
+	ptr = mremap(buffer->ptr, rn_buffer_map_length(buffer->msize), length, MREMAP_MAYMOVE);
+	if (ptr == MAP_FAILED) {
+		return NULL;
+	}
+	rn_buffer_map_advise(ptr, length);
+	return ptr;
+}
+
+/**
+ * Mapped buffer class free function.
+ *
+ * @param buffer Pointer to the buffer
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_buffer_map_class_free(rn_buffer_t *buffer)
+{
+	if (munmap(buffer->ptr, rn_buffer_map_length(buffer->msize)) != 0) {
+		return -1;
+	}
+	buffer->ptr = NULL;
+	return 0;
+}
+
+/**
+ * Mapped buffer class reset function. Pages used past RN_BUFFER_MAP_KEEP
+ * are released, the mapping itself is kept.
+ *
+ * @param buffer Pointer to the buffer, before it is emptied
+ */
+static void rn_buffer_map_class_reset(rn_buffer_t *buffer)
+{
+	size_t used;
+	size_t keep;
+	char *start;
+
+	start = (char *) buffer->ptr - buffer->offset;
+	used = rn_buffer_map_length(buffer->offset + buffer->size);
+	keep = rn_buffer_map_length(RN_BUFFER_MAP_KEEP);
+	if (used > keep) {
+		madvise(start + keep, used - keep, MADV_DONTNEED);
+	}
+}
+
+/**
+ * Gets the mapped buffer class.
+ *
+ * @return Pointer to the mapped buffer class
+ */
+rn_buffer_class_t *rn_buffer_map_class(void)
+{
+	return &map_class;
+}
+
+/**
+ * Checks if a buffer uses mapped memory.
+ *
+ * @param buffer Pointer to the buffer to check
+ *
+ * @return true if the buffer is mapped, otherwise false
+ */
+bool rn_buffer_ismapped(rn_buffer_t *buffer)
+{
+	return (buffer->class == &map_class);
+}
+
+/**
+ * Moves a buffer to mapped memory. Buffer data is copied once to a new
+ * mapping, the previous memory is released through the buffer class
+ * and the buffer switches to the mapped buffer class.
+ * This is meant to be called from a buffer class realloc function.
+ *
+ * @param buffer Pointer to the buffer
+ * @param newsize New memory size
+ *
+ * @return Pointer to the new mapping or NULL if an error occurs
+ */
+void *rn_buffer_map_migrate(rn_buffer_t *buffer, size_t newsize)
+{
+	void *ptr;
+
+	ptr = rn_buffer_map_class_malloc(buffer, newsize);
+	if (ptr == NULL) {
+		return NULL;
+	}
+	memcpy(ptr, buffer->ptr, buffer->size);
+	if (buffer->class->free != NULL && buffer->class->free(buffer) != 0) {
+		munmap(ptr, rn_buffer_map_length(newsize));
+		return NULL;
+	}
+	buffer->class = &map_class;
+	return ptr;
+}
+
+/**
+ * Enables or disables transparent huge pages for new mappings.
+ *
+ * @param enabled Whether to ask for huge pages
+ */
+void rn_buffer_map_sethugepage(bool enabled)
+{
+	rn_buffer_map_hugepages = enabled;
+}
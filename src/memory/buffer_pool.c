@@ -0,0 +1,269 @@
+/**
+ * @file   buffer_pool.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Pooled buffer class. Buffer memory comes from power-of-two
+ *         size classes kept in per-pool free lists.
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+#define rn_buffer_pool_get_pool(buffer)	container_of((buffer)->class, rn_buffer_pool_t, class)
+
+/**
+ * Gets the size class index matching a size.
+ *
+ * @param size Memory size
+ *
+ * @return Class index or RN_BUFFER_POOL_NB_CLASSES if size is too big to be pooled
+ */
+static inline size_t rn_buffer_pool_index(size_t size)
+{
+	if (size <= (1UL << RN_BUFFER_POOL_MINSHIFT)) {
+		return 0;
+	}
+	if (size > RN_BUFFER_POOL_MAXSIZE) {
+		return RN_BUFFER_POOL_NB_CLASSES;
+	}
+	return (size_t)(64 - __builtin_clzl(size - 1)) - RN_BUFFER_POOL_MINSHIFT;
+}
+
+/**
+ * Gets memory from a pool.
+ *
+ * @param pool Pointer to the pool
+ * @param size Memory size, must be a class size when pooled
+ *
+ * @return Pointer to the memory or NULL if an error occurs
+ */
+static void *rn_buffer_pool_alloc(rn_buffer_pool_t *pool, size_t size)
+{
+	size_t index;
+	rn_buffer_pool_block_t *block;
+
+	index = rn_buffer_pool_index(size);
+	if (index >= RN_BUFFER_POOL_NB_CLASSES) {
+		block = rn_malloc(size);
+	} else if (pool->free[index] != NULL) {
+		block = pool->free[index];
+		pool->free[index] = block->next;
+		pool->nbfree[index]--;
+	} else {
+		block = rn_malloc(1UL << (RN_BUFFER_POOL_MINSHIFT + index));
+	}
+	if (likely(block != NULL)) {
+		pool->nbused++;
+	}
+	return block;
+}
+
+/**
+ * Gives memory back to a pool.
+ *
+ * @param pool Pointer to the pool
+ * @param ptr Pointer to the memory
+ * @param size Memory size
+ */
+static void rn_buffer_pool_free(rn_buffer_pool_t *pool, void *ptr, size_t size)
+{
+	size_t index;
+	rn_buffer_pool_block_t *block;
+
+	pool->nbused--;
+	index = rn_buffer_pool_index(size);
+	if (index >= RN_BUFFER_POOL_NB_CLASSES ||
+	    size != (1UL << (RN_BUFFER_POOL_MINSHIFT + index)) ||
+	    pool->nbfree[index] >= RN_BUFFER_POOL_MAXFREE) {
+		rn_free(ptr);
+		return;
+	}
+	block = ptr;
+	block->next = pool->free[index];
+	pool->free[index] = block;
+	pool->nbfree[index]++;
+}
+
+static size_t rn_buffer_pool_class_growthsize(rn_buffer_t *buffer, size_t newsize)
+{
+	size_t msize;
+
+	if (newsize >= buffer->class->maxsize) {
+		return buffer->class->maxsize;
+	}
+	if (newsize < buffer->msize) {
+		return buffer->msize;
+	}
+	msize = buffer->class->inisize;
+	while (msize <= newsize) {
+		msize <<= 1;
+	}
+	return msize;
+}
+
+static void *rn_buffer_pool_class_malloc(rn_buffer_t *buffer, size_t size)
+{
+	return rn_buffer_pool_alloc(rn_buffer_pool_get_pool(buffer), size);
+}
+
+static void *rn_buffer_pool_class_realloc(rn_buffer_t *buffer, size_t newsize)
+{
+	void *ptr;
+	rn_buffer_pool_t *pool = rn_buffer_pool_get_pool(buffer);
+
+	if (buffer->ptr == NULL) {
+		return rn_buffer_pool_alloc(pool, newsize);
+	}
+	if (buffer->msize > RN_BUFFER_POOL_MAXSIZE && newsize > RN_BUFFER_POOL_MAXSIZE) {
+		return rn_realloc(buffer->ptr, buffer->msize, newsize);
+	}
+	ptr = rn_buffer_pool_alloc(pool, newsize);
+	if (ptr == NULL) {
+		return NULL;
+	}
+	memcpy(ptr, buffer->ptr, buffer->size);
+	rn_buffer_pool_free(pool, buffer->ptr, buffer->msize);
+	return ptr;
+}
+
+static int rn_buffer_pool_class_free(rn_buffer_t *buffer)
+{
+	rn_buffer_pool_free(rn_buffer_pool_get_pool(buffer), buffer->ptr, buffer->msize);
+	buffer->ptr = NULL;
+	return 0;
+}
+
+/**
+ * Initializes a buffer pool.
+ *
+ * @param pool Pointer to the pool to initialize
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_buffer_pool(rn_buffer_pool_t *pool)
+{
+	memset(pool, 0, sizeof(*pool));
+	pool->class.inisize = RN_BUFFER_HELPER_INISIZE;
+	pool->class.maxsize = RN_BUFFER_HELPER_MAXSIZE;
+	pool->class.init = NULL;
+	pool->class.growthsize = rn_buffer_pool_class_growthsize;
+	pool->class.malloc = rn_buffer_pool_class_malloc;
+	pool->class.realloc = rn_buffer_pool_class_realloc;
+	pool->class.free = rn_buffer_pool_class_free;
+	pool->class.reset = NULL;
+	return 0;
+}
+
+/**
+ * Releases all memory kept by a buffer pool.
+ * Every buffer must have been given back to the pool:
+ * buffers still in use are reported and must not be used afterwards.
+ *
+ * @param pool Pointer to the pool to destroy
+ */
+void rn_buffer_pool_destroy(rn_buffer_pool_t *pool)
+{
+	size_t i;
+	rn_buffer_pool_block_t *block;
+
+	if (unlikely(pool->nbused != 0)) {
+		fprintf(stderr, "rn_buffer_pool_destroy: %zu buffers still in use\n", pool->nbused);
+	}
+
+	for (i = 0; i < RN_BUFFER_POOL_NB_CLASSES; i++) {
+		while (pool->free[i] != NULL) {
+			block = pool->free[i];
+			pool->free[i] = block->next;
+			rn_free(block);
+		}
+		pool->nbfree[i] = 0;
+	}
+	while (pool->buffers != NULL) {
+		block = pool->buffers;
+		pool->buffers = block->next;
+		rn_free(block);
+	}
+	pool->nbbuffers = 0;
+}
+
+/**
+ * Gets a buffer from a pool.
+ * The buffer can be released with rn_buffer_pool_put or rn_buffer_destroy.
+ *
+ * @param pool Pointer to the pool
+ *
+ * @return Pointer to the buffer or NULL if an error occurs
+ */
+rn_buffer_t *rn_buffer_pool_get(rn_buffer_pool_t *pool)
+{
+	rn_buffer_t *buffer;
+
+	if (pool->buffers != NULL) {
+		buffer = (rn_buffer_t *) pool->buffers;
+		pool->buffers = pool->buffers->next;
+		pool->nbbuffers--;
+	} else {
+		buffer = rn_malloc(sizeof(*buffer));
+		if (buffer == NULL) {
+			return NULL;
+		}
+	}
+	buffer->size = 0;
+	buffer->msize = pool->class.inisize;
+	buffer->offset = 0;
+	buffer->class = &pool->class;
+	buffer->ptr = rn_buffer_pool_alloc(pool, buffer->msize);
+	if (buffer->ptr == NULL) {
+		rn_free(buffer);
+		return NULL;
+	}
+	return buffer;
+}
+
+/**
+ * Gives a buffer back to its pool so that it can be reused by another user.
+ * Buffers which do not come from a pool are destroyed.
+ *
+ * @param buffer Pointer to the buffer
+ */
+void rn_buffer_pool_put(rn_buffer_t *buffer)
+{
+	rn_buffer_pool_t *pool;
+	rn_buffer_pool_block_t *block;
+
+	if (buffer->class->free != rn_buffer_pool_class_free) {
+		rn_buffer_destroy(buffer);
+		return;
+	}
+	pool = rn_buffer_pool_get_pool(buffer);
+	rn_buffer_pool_release(buffer);
+	if (pool->nbbuffers >= RN_BUFFER_POOL_MAXFREE) {
+		rn_free(buffer);
+		return;
+	}
+	block = (rn_buffer_pool_block_t *) buffer;
+	block->next = pool->buffers;
+	pool->buffers = block;
+	pool->nbbuffers++;
+}
+
+/**
+ * Gives the memory of a pooled buffer back to its pool and empties the buffer.
+ * The buffer stays usable: memory is taken again from the pool when data is added.
+ *
+ * @param buffer Pointer to the buffer
+ */
+void rn_buffer_pool_release(rn_buffer_t *buffer)
+{
+	if (buffer->class->free != rn_buffer_pool_class_free) {
+		return;
+	}
+	if (buffer->ptr != NULL) {
+		rn_buffer_rewind(buffer);
+		rn_buffer_pool_class_free(buffer);
+	}
+	buffer->size = 0;
+	buffer->msize = 0;
+}
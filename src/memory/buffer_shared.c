@@ -0,0 +1,183 @@
+/**
+ * @file   buffer_shared.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Reference-counted immutable buffers. Data is allocated once
+ *         and shared by every buffer referencing it, the memory is
+ *         released along with the last reference.
+ *
+ *         Shared buffers keep the distance to their memory block in the
+ *         buffer offset, so that rn_buffer_destroy rewinds them to the
+ *         block header before calling the class free function.
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+static int rn_buffer_shared_class_free(rn_buffer_t *buffer);
+
+static rn_buffer_class_t shared_class = {
+	.inisize = 0,
+	.maxsize = 0,
+	.init = NULL,
+	.growthsize = NULL,
+	.malloc = NULL,
+	.realloc = NULL,
+	.free = rn_buffer_shared_class_free,
+	.reset = NULL,
+};
+
+/**
+ * Gets the memory block a shared buffer is pointing to.
+ *
+ * @param buffer Pointer to the shared buffer
+ *
+ * @return Pointer to the memory block
+ */
+static inline rn_buffer_shared_t *rn_buffer_shared_block(rn_buffer_t *buffer)
+{
+	return (rn_buffer_shared_t *)(buffer->ptr - buffer->offset);
+}
+
+/**
+ * Shared buffer class free function. It drops one reference and
+ * releases the memory block when it was the last one.
+ *
+ * @param buffer Pointer to the shared buffer, rewinded to its block
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_buffer_shared_class_free(rn_buffer_t *buffer)
+{
+	rn_buffer_shared_t *block;
+
+	block = buffer->ptr;
+	if (__atomic_sub_fetch(&block->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+		rn_free(block);
+	}
+	return 0;
+}
+
+/**
+ * Creates a buffer pointing to a memory block.
+ *
+ * @param block Pointer to the memory block
+ * @param offset Data offset from the memory block start
+ * @param size Data size
+ *
+ * @return Pointer to the new buffer or NULL if an error occurs
+ */
+static rn_buffer_t *rn_buffer_shared_create(rn_buffer_shared_t *block, size_t offset, size_t size)
+{
+	rn_buffer_t *buffer;
+
+	buffer = rn_malloc(sizeof(*buffer));
+	if (buffer == NULL) {
+		return NULL;
+	}
+	buffer->offset = offset;
+	buffer->ptr = (char *) block + buffer->offset;
+	buffer->size = size;
+	buffer->msize = 0;
+	buffer->class = &shared_class;
+	return buffer;
+}
+
+/**
+ * Creates a shared buffer from a copy of data.
+ * The returned buffer holds the first reference and must be destroyed
+ * with rn_buffer_unref. Shared buffers cannot be modified.
+ *
+ * @param data Pointer to the data to share
+ * @param size Data size
+ *
+ * @return Pointer to the shared buffer or NULL if an error occurs
+ */
+rn_buffer_t *rn_buffer_shared(const void *data, size_t size)
+{
+	rn_buffer_t *buffer;
+	rn_buffer_shared_t *block;
+
+	block = rn_malloc(sizeof(*block) + size);
+	if (block == NULL) {
+		return NULL;
+	}
+	block->refcount = 1;
+	block->size = size;
+	memcpy((char *) block + sizeof(*block), data, size);
+	buffer = rn_buffer_shared_create(block, sizeof(*block), size);
+	if (buffer == NULL) {
+		rn_free(block);
+		return NULL;
+	}
+	return buffer;
+}
+
+/**
+ * Checks if a buffer is a shared buffer.
+ *
+ * @param buffer Pointer to the buffer to check
+ *
+ * @return true if the buffer is shared, otherwise false
+ */
+bool rn_buffer_isshared(rn_buffer_t *buffer)
+{
+	return (buffer->class == &shared_class);
+}
+
+/**
+ * Gets a new reference to a shared buffer.
+ * The new buffer points to the same data, nothing is copied.
+ *
+ * @param buffer Pointer to the shared buffer
+ *
+ * @return Pointer to the new reference or NULL if an error occurs
+ */
+rn_buffer_t *rn_buffer_ref(rn_buffer_t *buffer)
+{
+	return rn_buffer_slice(buffer, 0, buffer->size);
+}
+
+/**
+ * Gets a new reference to a part of a shared buffer.
+ *
+ * @param buffer Pointer to the shared buffer
+ * @param offset Slice start, relative to the buffer data
+ * @param size Slice size
+ *
+ * @return Pointer to the new reference or NULL if an error occurs
+ */
+rn_buffer_t *rn_buffer_slice(rn_buffer_t *buffer, size_t offset, size_t size)
+{
+	rn_buffer_t *slice;
+	rn_buffer_shared_t *block;
+
+	if (!rn_buffer_isshared(buffer) || offset > buffer->size || size > buffer->size - offset) {
+		return NULL;
+	}
+	block = rn_buffer_shared_block(buffer);
+	__atomic_add_fetch(&block->refcount, 1, __ATOMIC_RELAXED);
+	slice = rn_buffer_shared_create(block, buffer->offset + offset, size);
+	if (slice == NULL) {
+		__atomic_sub_fetch(&block->refcount, 1, __ATOMIC_RELAXED);
+		return NULL;
+	}
+	return slice;
+}
+
+/**
+ * Gets the number of references to shared buffer data.
+ *
+ * @param buffer Pointer to the shared buffer
+ *
+ * @return Number of references, 0 if the buffer is not shared
+ */
+unsigned int rn_buffer_refcount(rn_buffer_t *buffer)
+{
+	if (!rn_buffer_isshared(buffer)) {
+		return 0;
+	}
+	return __atomic_load_n(&rn_buffer_shared_block(buffer)->refcount, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,616 @@
+/**
+ * @file   codec.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Base64 (standard and URL-safe) and hex codecs. Vector versions
+ *         follow the scanning kernels level (see rn_scan_level), the
+ *         scalar versions handle remaining bytes and padding.
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+# define RN_CODEC_X86
+#endif
+
+static const char rn_b64_alphabet[2][64] = {
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+};
+
+static const char rn_hex_alphabet[16] = "0123456789abcdef";
+
+/**
+ * Gets base64 value of a character.
+ *
+ * @param c Character to decode
+ * @param mode Base64 alphabet
+ *
+ * @return Character value or -1 if the character is not part of the alphabet
+ */
+static inline int rn_b64_value(unsigned char c, rn_b64_mode_t mode)
+{
+	switch (c) {
+	case 'A' ... 'Z':
+		return c - 'A';
+	case 'a' ... 'z':
+		return c - 'a' + 26;
+	case '0' ... '9':
+		return c - '0' + 52;
+	case '+':
+		return (mode == RN_B64_STD ? 62 : -1);
+	case '/':
+		return (mode == RN_B64_STD ? 63 : -1);
+	case '-':
+		return (mode == RN_B64_URL ? 62 : -1);
+	case '_':
+		return (mode == RN_B64_URL ? 63 : -1);
+	}
+	return -1;
+}
+
+/**
+ * Gets hex value of a character.
+ *
+ * @param c Character to decode
+ *
+ * @return Character value or -1 if the character is not an hex digit
+ */
+static inline int rn_hex_value(unsigned char c)
+{
+	switch (c) {
+	case '0' ... '9':
+		return c - '0';
+	case 'a' ... 'f':
+		return c - 'a' + 10;
+	case 'A' ... 'F':
+		return c - 'A' + 10;
+	}
+	return -1;
+}
+
+static size_t rn_b64_encode_scalar(char *dst, const unsigned char *src, size_t size, rn_b64_mode_t mode)
+{
+	size_t i;
+	char *out;
+	unsigned int bits;
+	const char *alphabet = rn_b64_alphabet[mode];
+
+	out = dst;
+	for (i = 0; i + 3 <= size; i += 3) {
+		bits = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+		*out++ = alphabet[bits >> 18];
+		*out++ = alphabet[(bits >> 12) & 0x3f];
+		*out++ = alphabet[(bits >> 6) & 0x3f];
+		*out++ = alphabet[bits & 0x3f];
+	}
+	if (i < size) {
+		bits = src[i] << 16;
+		if (i + 1 < size) {
+			bits |= src[i + 1] << 8;
+		}
+		*out++ = alphabet[bits >> 18];
+		*out++ = alphabet[(bits >> 12) & 0x3f];
+		if (i + 1 < size) {
+			*out++ = alphabet[(bits >> 6) & 0x3f];
+		} else if (mode == RN_B64_STD) {
+			*out++ = '=';
+		}
+		if (mode == RN_B64_STD) {
+			*out++ = '=';
+		}
+	}
+	return out - dst;
+}
+
+static ssize_t rn_b64_decode_scalar(unsigned char *dst, const char *src, size_t size, rn_b64_mode_t mode)
+{
+	int v;
+	size_t i;
+	size_t n;
+	unsigned char *out;
+	unsigned int bits;
+
+	out = dst;
+	for (i = 0, n = 0, bits = 0; i < size; i++) {
+		v = rn_b64_value(src[i], mode);
+		if (v < 0) {
+			return -1;
+		}
+		bits = (bits << 6) | v;
+		if (++n == 4) {
+			*out++ = bits >> 16;
+			*out++ = bits >> 8;
+			*out++ = bits;
+			bits = 0;
+			n = 0;
+		}
+	}
+	switch (n) {
+	case 1:
+		return -1;
+	case 2:
+		*out++ = bits >> 4;
+		break;
+	case 3:
+		*out++ = bits >> 10;
+		*out++ = bits >> 2;
+		break;
+	}
+	return out - dst;
+}
+
+static size_t rn_hex_encode_scalar(char *dst, const unsigned char *src, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		dst[i * 2] = rn_hex_alphabet[src[i] >> 4];
+		dst[i * 2 + 1] = rn_hex_alphabet[src[i] & 0x0f];
+	}
+	return size * 2;
+}
+
+static ssize_t rn_hex_decode_scalar(unsigned char *dst, const char *src, size_t size)
+{
+	int hi;
+	int lo;
+	size_t i;
+
+	for (i = 0; i < size / 2; i++) {
+		hi = rn_hex_value(src[i * 2]);
+		lo = rn_hex_value(src[i * 2 + 1]);
+		if (hi < 0 || lo < 0) {
+			return -1;
+		}
+		dst[i] = (hi << 4) | lo;
+	}
+	return size / 2;
+}
+
+#ifdef RN_CODEC_X86
+
+/*
+ * Base64 vector kernels use the pshufb based lookups described by
+ * Wojciech Mula and Daniel Lemire: 12 bytes (24 with AVX2) are split
+ * in 6-bit indices which are translated to ASCII with a 16 entries
+ * offset table. Decoding validates characters with two nibble tables.
+ */
+
+__attribute__((target("sse4.2")))
+static inline __m128i rn_b64_enc_translate_sse42(__m128i in, rn_b64_mode_t mode)
+{
+	__m128i t0, t1, t2, t3;
+	__m128i indices, result, less, lut;
+
+	in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+	t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+	t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+	t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+	t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+	indices = _mm_or_si128(t1, t3);
+	result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+	less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+	result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+	if (mode == RN_B64_STD) {
+		lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				    '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	} else {
+		lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				    '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+	}
+	return _mm_add_epi8(_mm_shuffle_epi8(lut, result), indices);
+}
+
+__attribute__((target("sse4.2")))
+static size_t rn_b64_encode_sse42(char *dst, const unsigned char *src, size_t size, rn_b64_mode_t mode)
+{
+	size_t i;
+	char *out;
+
+	out = dst;
+	/* 16 bytes are loaded, 12 are consumed */
+	for (i = 0; i + 16 <= size; i += 12) {
+		_mm_storeu_si128((__m128i *) out, rn_b64_enc_translate_sse42(_mm_loadu_si128((const __m128i *)(src + i)), mode));
+		out += 16;
+	}
+	return (out - dst) + rn_b64_encode_scalar(out, src + i, size - i, mode);
+}
+
+/**
+ * Translates 16 base64 characters to their 6-bit values.
+ *
+ * @param in Characters
+ * @param mode Base64 alphabet
+ * @param values Pointer to store values
+ *
+ * @return 0 if all characters are valid, otherwise -1
+ */
+__attribute__((target("sse4.2")))
+static inline int rn_b64_dec_translate_sse42(__m128i in, rn_b64_mode_t mode, __m128i *values)
+{
+	__m128i lo, hi, eq_2f, roll;
+	__m128i hi_nibbles, lo_nibbles;
+	const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+					     0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+					     0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i mask_2f = _mm_set1_epi8(0x2f);
+
+	if (mode == RN_B64_URL) {
+		/* '+' and '/' are not part of the URL-safe alphabet */
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('+')), _mm_cmpeq_epi8(in, mask_2f))) != 0) {
+			return -1;
+		}
+		in = _mm_blendv_epi8(in, _mm_set1_epi8('+'), _mm_cmpeq_epi8(in, _mm_set1_epi8('-')));
+		in = _mm_blendv_epi8(in, mask_2f, _mm_cmpeq_epi8(in, _mm_set1_epi8('_')));
+	}
+	hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2f);
+	lo_nibbles = _mm_and_si128(in, mask_2f);
+	lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+	hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+	if (!_mm_testz_si128(lo, hi)) {
+		return -1;
+	}
+	eq_2f = _mm_cmpeq_epi8(in, mask_2f);
+	roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2f, hi_nibbles));
+	*values = _mm_add_epi8(in, roll);
+	return 0;
+}
+
+__attribute__((target("sse4.2")))
+static ssize_t rn_b64_decode_sse42(unsigned char *dst, const char *src, size_t size, rn_b64_mode_t mode)
+{
+	size_t i;
+	ssize_t res;
+	__m128i values;
+	unsigned char *out;
+	unsigned char tmp[16];
+
+	out = dst;
+	for (i = 0; i + 16 <= size; i += 16) {
+		if (rn_b64_dec_translate_sse42(_mm_loadu_si128((const __m128i *)(src + i)), mode, &values) != 0) {
+			return -1;
+		}
+		values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+		values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+		values = _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		/* Only 12 bytes are produced, never write past them */
+		_mm_storeu_si128((__m128i *) tmp, values);
+		memcpy(out, tmp, 12);
+		out += 12;
+	}
+	res = rn_b64_decode_scalar(out, src + i, size - i, mode);
+	if (res < 0) {
+		return -1;
+	}
+	return (out - dst) + res;
+}
+
+__attribute__((target("sse4.2")))
+static size_t rn_hex_encode_sse42(char *dst, const unsigned char *src, size_t size)
+{
+	size_t i;
+	__m128i in, hi, lo;
+	const __m128i lut = _mm_loadu_si128((const __m128i *) rn_hex_alphabet);
+	const __m128i mask = _mm_set1_epi8(0x0f);
+
+	for (i = 0; i + 16 <= size; i += 16) {
+		in = _mm_loadu_si128((const __m128i *)(src + i));
+		hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+		lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, mask));
+		_mm_storeu_si128((__m128i *)(dst + i * 2), _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128((__m128i *)(dst + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+	}
+	return i * 2 + rn_hex_encode_scalar(dst + i * 2, src + i, size - i);
+}
+
+/**
+ * Translates 16 hex characters to their 4-bit values.
+ *
+ * @param in Characters
+ * @param values Pointer to store values
+ *
+ * @return 0 if all characters are valid, otherwise -1
+ */
+__attribute__((target("sse4.2")))
+static inline int rn_hex_dec_translate_sse42(__m128i in, __m128i *values)
+{
+	__m128i lower, digit, letter;
+
+	lower = _mm_or_si128(in, _mm_set1_epi8(0x20));
+	digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+	letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+	if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xffff) {
+		return -1;
+	}
+	*values = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0'))),
+			       _mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+	return 0;
+}
+
+__attribute__((target("sse4.2")))
+static ssize_t rn_hex_decode_sse42(unsigned char *dst, const char *src, size_t size)
+{
+	size_t i;
+	ssize_t res;
+	__m128i values;
+
+	for (i = 0; i + 16 <= size; i += 16) {
+		if (rn_hex_dec_translate_sse42(_mm_loadu_si128((const __m128i *)(src + i)), &values) != 0) {
+			return -1;
+		}
+		values = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+		_mm_storel_epi64((__m128i *)(dst + i / 2), _mm_packus_epi16(values, values));
+	}
+	res = rn_hex_decode_scalar(dst + i / 2, src + i, size - i);
+	if (res < 0) {
+		return -1;
+	}
+	return i / 2 + res;
+}
+
+__attribute__((target("avx2")))
+static size_t rn_b64_encode_avx2(char *dst, const unsigned char *src, size_t size, rn_b64_mode_t mode)
+{
+	size_t i;
+	char *out;
+	__m256i in, t0, t1, t2, t3;
+	__m256i indices, result, less, lut;
+
+	if (mode == RN_B64_STD) {
+		lut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				       '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+				       'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				       '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	} else {
+		lut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				       '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0,
+				       'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				       '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0);
+	}
+	out = dst;
+	/* Each lane loads 16 bytes and consumes 12 */
+	for (i = 0; i + 28 <= size; i += 24) {
+		in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(src + i))),
+					     _mm_loadu_si128((const __m128i *)(src + i + 12)), 1);
+		in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+							      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+		t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+		t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+		t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+		t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+		indices = _mm256_or_si256(t1, t3);
+		result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+		less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+		result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+		result = _mm256_add_epi8(_mm256_shuffle_epi8(lut, result), indices);
+		_mm256_storeu_si256((__m256i *) out, result);
+		out += 32;
+	}
+	return (out - dst) + rn_b64_encode_sse42(out, src + i, size - i, mode);
+}
+
+__attribute__((target("avx2")))
+static ssize_t rn_b64_decode_avx2(unsigned char *dst, const char *src, size_t size, rn_b64_mode_t mode)
+{
+	size_t i;
+	ssize_t res;
+	unsigned char *out;
+	unsigned char tmp[32];
+	__m256i in, lo, hi, eq_2f, roll, values;
+	__m256i hi_nibbles, lo_nibbles;
+	const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+						0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+						0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+						0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+						0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+						0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+						0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+						  0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+
+	out = dst;
+	for (i = 0; i + 32 <= size; i += 32) {
+		in = _mm256_loadu_si256((const __m256i *)(src + i));
+		if (mode == RN_B64_URL) {
+			if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('+')),
+								 _mm256_cmpeq_epi8(in, mask_2f))) != 0) {
+				return -1;
+			}
+			in = _mm256_blendv_epi8(in, _mm256_set1_epi8('+'), _mm256_cmpeq_epi8(in, _mm256_set1_epi8('-')));
+			in = _mm256_blendv_epi8(in, mask_2f, _mm256_cmpeq_epi8(in, _mm256_set1_epi8('_')));
+		}
+		hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+		lo_nibbles = _mm256_and_si256(in, mask_2f);
+		lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+		hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+		if (!_mm256_testz_si256(lo, hi)) {
+			return -1;
+		}
+		eq_2f = _mm256_cmpeq_epi8(in, mask_2f);
+		roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nibbles));
+		values = _mm256_add_epi8(in, roll);
+		values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+		values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+		values = _mm256_shuffle_epi8(values, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+								      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		values = _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		_mm256_storeu_si256((__m256i *) tmp, values);
+		memcpy(out, tmp, 24);
+		out += 24;
+	}
+	res = rn_b64_decode_sse42(out, src + i, size - i, mode);
+	if (res < 0) {
+		return -1;
+	}
+	return (out - dst) + res;
+}
+
+__attribute__((target("avx2")))
+static size_t rn_hex_encode_avx2(char *dst, const unsigned char *src, size_t size)
+{
+	size_t i;
+	__m256i in, hi, lo, a, b;
+	const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) rn_hex_alphabet));
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+
+	for (i = 0; i + 32 <= size; i += 32) {
+		in = _mm256_loadu_si256((const __m256i *)(src + i));
+		hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+		lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, mask));
+		a = _mm256_unpacklo_epi8(hi, lo);
+		b = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i *)(dst + i * 2), _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + i * 2 + 32), _mm256_permute2x128_si256(a, b, 0x31));
+	}
+	return i * 2 + rn_hex_encode_sse42(dst + i * 2, src + i, size - i);
+}
+
+__attribute__((target("avx2")))
+static ssize_t rn_hex_decode_avx2(unsigned char *dst, const char *src, size_t size)
+{
+	size_t i;
+	ssize_t res;
+	__m256i in, lower, digit, letter, values;
+
+	for (i = 0; i + 32 <= size; i += 32) {
+		in = _mm256_loadu_si256((const __m256i *)(src + i));
+		lower = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+		digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+		letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+		if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1) {
+			return -1;
+		}
+		values = _mm256_or_si256(_mm256_and_si256(digit, _mm256_sub_epi8(in, _mm256_set1_epi8('0'))),
+					 _mm256_and_si256(letter, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+		values = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+		values = _mm256_permute4x64_epi64(_mm256_packus_epi16(values, values), 0x08);
+		_mm_storeu_si128((__m128i *)(dst + i / 2), _mm256_castsi256_si128(values));
+	}
+	res = rn_hex_decode_sse42(dst + i / 2, src + i, size - i);
+	if (res < 0) {
+		return -1;
+	}
+	return i / 2 + res;
+}
+
+#endif /* !RN_CODEC_X86 */
+
+/**
+ * Encodes data in base64.
+ * Standard encoding is padded with '=', URL-safe encoding is not padded.
+ *
+ * @param dst Destination, must be at least RN_B64_ENCLEN(size) bytes long
+ * @param src Data to encode
+ * @param size Data size
+ * @param mode Base64 alphabet to use
+ *
+ * @return Number of characters written
+ */
+size_t rn_b64_encode(char *dst, const void *src, size_t size, rn_b64_mode_t mode)
+{
+#ifdef RN_CODEC_X86
+	switch (rn_scan_level()) {
+	case RN_SCAN_AVX2:
+		return rn_b64_encode_avx2(dst, src, size, mode);
+	case RN_SCAN_SSE42:
+		return rn_b64_encode_sse42(dst, src, size, mode);
+	default:
+		break;
+	}
+#endif
+	return rn_b64_encode_scalar(dst, src, size, mode);
+}
+
+/**
+ * Decodes base64 data. Trailing padding is optional.
+ *
+ * @param dst Destination, must be at least RN_B64_DECLEN(size) bytes long
+ * @param src Base64 characters
+ * @param size Number of characters
+ * @param mode Base64 alphabet to use
+ *
+ * @return Number of bytes written, or -1 if src is not valid base64
+ */
+ssize_t rn_b64_decode(void *dst, const char *src, size_t size, rn_b64_mode_t mode)
+{
+	if (size > 0 && src[size - 1] == '=') {
+		if (size % 4 != 0) {
+			return -1;
+		}
+		size--;
+		if (src[size - 1] == '=') {
+			size--;
+		}
+	}
+#ifdef RN_CODEC_X86
+	switch (rn_scan_level()) {
+	case RN_SCAN_AVX2:
+		return rn_b64_decode_avx2(dst, src, size, mode);
+	case RN_SCAN_SSE42:
+		return rn_b64_decode_sse42(dst, src, size, mode);
+	default:
+		break;
+	}
+#endif
+	return rn_b64_decode_scalar(dst, src, size, mode);
+}
+
+/**
+ * Encodes data in lowercase hex.
+ *
+ * @param dst Destination, must be at least RN_HEX_ENCLEN(size) bytes long
+ * @param src Data to encode
+ * @param size Data size
+ *
+ * @return Number of characters written
+ */
+size_t rn_hex_encode(char *dst, const void *src, size_t size)
+{
+#ifdef RN_CODEC_X86
+	switch (rn_scan_level()) {
+	case RN_SCAN_AVX2:
+		return rn_hex_encode_avx2(dst, src, size);
+	case RN_SCAN_SSE42:
+		return rn_hex_encode_sse42(dst, src, size);
+	default:
+		break;
+	}
+#endif
+	return rn_hex_encode_scalar(dst, src, size);
+}
+
+/**
+ * Decodes hex data, both cases are accepted.
+ *
+ * @param dst Destination, must be at least RN_HEX_DECLEN(size) bytes long
+ * @param src Hex characters
+ * @param size Number of characters
+ *
+ * @return Number of bytes written, or -1 if src is not valid hex
+ */
+ssize_t rn_hex_decode(void *dst, const char *src, size_t size)
+{
+	if (size % 2 != 0) {
+		return -1;
+	}
+#ifdef RN_CODEC_X86
+	switch (rn_scan_level()) {
+	case RN_SCAN_AVX2:
+		return rn_hex_decode_avx2(dst, src, size);
+	case RN_SCAN_SSE42:
+		return rn_hex_decode_sse42(dst, src, size);
+	default:
+		break;
+	}
+#endif
+	return rn_hex_decode_scalar(dst, src, size);
+}
@@ -0,0 +1,274 @@
+/**
+ * @file   iobuf.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Chained segment buffer. Data is stored in fixed-size segments
+ *         so that it never gets reallocated nor needs to be contiguous.
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+/**
+ * Initializes a chained buffer.
+ *
+ * @param iobuf Pointer to the chained buffer to initialize
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf(rn_iobuf_t *iobuf)
+{
+	memset(iobuf, 0, sizeof(*iobuf));
+	return 0;
+}
+
+/**
+ * Releases all segments of a chained buffer.
+ *
+ * @param iobuf Pointer to the chained buffer to destroy
+ */
+void rn_iobuf_destroy(rn_iobuf_t *iobuf)
+{
+	rn_iobuf_seg_t *seg;
+
+	while (iobuf->head != NULL) {
+		seg = iobuf->head;
+		iobuf->head = seg->next;
+		rn_free(seg);
+	}
+	rn_free(iobuf->spare);
+	memset(iobuf, 0, sizeof(*iobuf));
+}
+
+/**
+ * Gets an empty segment. The segment is not part of the chained buffer
+ * until it is given to rn_iobuf_append.
+ *
+ * @param iobuf Pointer to the chained buffer
+ *
+ * @return Pointer to the segment or NULL if an error occurs
+ */
+rn_iobuf_seg_t *rn_iobuf_seg(rn_iobuf_t *iobuf)
+{
+	rn_iobuf_seg_t *seg;
+
+	if (iobuf->spare != NULL) {
+		seg = iobuf->spare;
+		iobuf->spare = NULL;
+	} else {
+		seg = rn_malloc(RN_IOBUF_SEGSIZE);
+		if (seg == NULL) {
+			return NULL;
+		}
+		seg->msize = RN_IOBUF_SEGSIZE - sizeof(*seg);
+	}
+	seg->next = NULL;
+	seg->start = 0;
+	seg->end = 0;
+	return seg;
+}
+
+/**
+ * Appends a segment to a chained buffer. Segments without data are kept aside.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param seg Pointer to the segment to append
+ */
+void rn_iobuf_append(rn_iobuf_t *iobuf, rn_iobuf_seg_t *seg)
+{
+	if (rn_iobuf_seg_size(seg) == 0) {
+		if (iobuf->spare == NULL) {
+			iobuf->spare = seg;
+		} else {
+			rn_free(seg);
+		}
+		return;
+	}
+	seg->next = NULL;
+	if (iobuf->tail == NULL) {
+		iobuf->head = seg;
+	} else {
+		iobuf->tail->next = seg;
+	}
+	iobuf->tail = seg;
+	iobuf->size += rn_iobuf_seg_size(seg);
+	iobuf->nbsegs++;
+}
+
+/**
+ * Adds data at the end of a chained buffer.
+ * Existing data is never moved, new segments are chained when needed.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param data Pointer to the data to add
+ * @param size Data size
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf_add(rn_iobuf_t *iobuf, const char *data, size_t size)
+{
+	size_t len;
+	rn_iobuf_seg_t *seg;
+
+	seg = iobuf->tail;
+	if (seg != NULL && seg->end < seg->msize) {
+		len = seg->msize - seg->end;
+		if (len > size) {
+			len = size;
+		}
+		memcpy(rn_iobuf_seg_data(seg) + seg->end, data, len);
+		seg->end += len;
+		iobuf->size += len;
+		data += len;
+		size -= len;
+	}
+	while (size > 0) {
+		seg = rn_iobuf_seg(iobuf);
+		if (seg == NULL) {
+			return -1;
+		}
+		len = (size < seg->msize ? size : seg->msize);
+		memcpy(rn_iobuf_seg_data(seg), data, len);
+		seg->end = len;
+		rn_iobuf_append(iobuf, seg);
+		data += len;
+		size -= len;
+	}
+	return 0;
+}
+
+/**
+ * Adds buffer content at the end of a chained buffer.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param buffer Pointer to the buffer to add
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf_addb(rn_iobuf_t *iobuf, rn_buffer_t *buffer)
+{
+	return rn_iobuf_add(iobuf, rn_buffer_ptr(buffer), rn_buffer_size(buffer));
+}
+
+/**
+ * Erases data from the beginning of a chained buffer.
+ * Fully consumed segments are released.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param size Size to erase. If 0, the whole buffer is erased.
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf_erase(rn_iobuf_t *iobuf, size_t size)
+{
+	size_t len;
+	rn_iobuf_seg_t *seg;
+
+	if (size == 0 || size > iobuf->size) {
+		size = iobuf->size;
+	}
+	while (size > 0 && (seg = iobuf->head) != NULL) {
+		len = rn_iobuf_seg_size(seg);
+		if (size < len) {
+			seg->start += size;
+			iobuf->size -= size;
+			break;
+		}
+		size -= len;
+		iobuf->size -= len;
+		iobuf->head = seg->next;
+		if (iobuf->head == NULL) {
+			iobuf->tail = NULL;
+		}
+		iobuf->nbsegs--;
+		seg->start = seg->end = 0;
+		rn_iobuf_append(iobuf, seg);
+	}
+	return 0;
+}
+
+/**
+ * Truncates a chained buffer, only the first bytes are kept.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param size Number of bytes to keep
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf_truncate(rn_iobuf_t *iobuf, size_t size)
+{
+	rn_iobuf_seg_t *seg;
+	rn_iobuf_seg_t *next;
+
+	if (size >= iobuf->size) {
+		return 0;
+	}
+	if (size == 0) {
+		return rn_iobuf_erase(iobuf, 0);
+	}
+	iobuf->size = size;
+	for (seg = iobuf->head; size > rn_iobuf_seg_size(seg); seg = seg->next) {
+		size -= rn_iobuf_seg_size(seg);
+	}
+	seg->end = seg->start + size;
+	next = seg->next;
+	seg->next = NULL;
+	iobuf->tail = seg;
+	while (next != NULL) {
+		seg = next;
+		next = seg->next;
+		iobuf->nbsegs--;
+		seg->start = seg->end = 0;
+		rn_iobuf_append(iobuf, seg);
+	}
+	return 0;
+}
+
+/**
+ * Fills static buffers pointing to chained buffer segments.
+ * These views can be given to rn_socket_writev.
+ *
+ * @param from Pointer to the first segment to use, updated to the next segment to use (NULL when done)
+ * @param views Array of buffers to fill
+ * @param count Array size
+ *
+ * @return Number of views filled
+ */
+int rn_iobuf_views(rn_iobuf_seg_t **from, rn_buffer_t *views, int count)
+{
+	int i;
+	rn_iobuf_seg_t *seg;
+
+	for (i = 0, seg = *from; i < count && seg != NULL; i++, seg = seg->next) {
+		rn_buffer_static(&views[i], rn_iobuf_seg_ptr(seg), rn_iobuf_seg_size(seg));
+	}
+	*from = seg;
+	return i;
+}
+
+/**
+ * Copies all chained buffer data to a contiguous buffer.
+ * Data is added to the destination buffer, the chained buffer is left untouched.
+ *
+ * @param iobuf Pointer to the chained buffer
+ * @param buffer Pointer to the destination buffer
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_iobuf_flatten(rn_iobuf_t *iobuf, rn_buffer_t *buffer)
+{
+	rn_iobuf_seg_t *seg;
+
+	if (rn_buffer_size(buffer) + iobuf->size > rn_buffer_msize(buffer) &&
+	    rn_buffer_extend(buffer, rn_buffer_size(buffer) + iobuf->size) != 0) {
+		return -1;
+	}
+	for (seg = iobuf->head; seg != NULL; seg = seg->next) {
+		if (rn_buffer_add(buffer, rn_iobuf_seg_ptr(seg), rn_iobuf_seg_size(seg)) < 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
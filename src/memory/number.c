@@ -0,0 +1,601 @@
+/**
+ * @file   number.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Number formatting and parsing. Writers use a digit-pair table
+ *         and never allocate, parsers are bounded by a length and never
+ *         need a null-terminated string.
+ *
+ *
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include "rinoo/memory/module.h"
+
+#define RN_NUMBER_DMANTISSA_MAX	(1ULL << 53)
+#define RN_NUMBER_FMANTISSA_MAX	(1ULL << 24)
+#define RN_NUMBER_SCAN_MAX	64
+
+static const char rn_number_digits[200] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static const uint64_t rn_number_pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/* Powers of ten exactly representable as double and float */
+static const double rn_number_dpow10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float rn_number_fpow10[11] = {
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+/**
+ * Gets the number of decimal digits of an integer.
+ *
+ * @param value Integer value
+ *
+ * @return Number of digits
+ */
+static inline size_t rn_number_ndigits(uint64_t value)
+{
+	size_t n;
+
+	for (n = 1; n < 20 && value >= rn_number_pow10[n]; n++);
+	return n;
+}
+
+/**
+ * Checks if a character is a space, as isspace does in C locale.
+ *
+ * @param c Character to check
+ *
+ * @return true if the character is a space, otherwise false
+ */
+static inline bool rn_number_isspace(char c)
+{
+	return (c == ' ' || (c >= '\t' && c <= '\r'));
+}
+
+/**
+ * Gets the value of a digit in a given base.
+ *
+ * @param c Character to decode
+ * @param base Numeric base
+ *
+ * @return Digit value or -1 if the character is not a digit of the base
+ */
+static inline int rn_number_digit(char c, int base)
+{
+	int digit;
+
+	if (c >= '0' && c <= '9') {
+		digit = c - '0';
+	} else if (c >= 'a' && c <= 'z') {
+		digit = c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'Z') {
+		digit = c - 'A' + 10;
+	} else {
+		return -1;
+	}
+	return (digit < base ? digit : -1);
+}
+
+/**
+ * Writes an unsigned integer in decimal. The destination must hold at
+ * least RN_U64TOA_MAX bytes. No null byte is added.
+ *
+ * @param dst Destination pointer
+ * @param value Value to write
+ *
+ * @return Number of bytes written
+ */
+size_t rn_u64toa(char *dst, uint64_t value)
+{
+	char *ptr;
+	size_t len;
+	unsigned int idx;
+
+	len = rn_number_ndigits(value);
+	ptr = dst + len;
+	while (value >= 100) {
+		idx = (value % 100) * 2;
+		value /= 100;
+		ptr -= 2;
+		ptr[0] = rn_number_digits[idx];
+		ptr[1] = rn_number_digits[idx + 1];
+	}
+	if (value >= 10) {
+		idx = value * 2;
+		ptr[-2] = rn_number_digits[idx];
+		ptr[-1] = rn_number_digits[idx + 1];
+	} else {
+		ptr[-1] = '0' + value;
+	}
+	return len;
+}
+
+/**
+ * Writes a signed integer in decimal. The destination must hold at
+ * least RN_I64TOA_MAX bytes. No null byte is added.
+ *
+ * @param dst Destination pointer
+ * @param value Value to write
+ *
+ * @return Number of bytes written
+ */
+size_t rn_i64toa(char *dst, int64_t value)
+{
+	if (value < 0) {
+		*dst = '-';
+		return rn_u64toa(dst + 1, -(uint64_t) value) + 1;
+	}
+	return rn_u64toa(dst, value);
+}
+
+/**
+ * Writes a double using the shortest representation which reads back
+ * to the same value. Values with up to 15 significant digits and a
+ * small exponent are written in plain decimal notation without using
+ * stdio, other values fall back to the shortest %g precision which
+ * round-trips. The destination must hold at least RN_DTOA_MAX bytes.
+ * No null byte is added.
+ *
+ * @param dst Destination pointer
+ * @param value Value to write
+ *
+ * @return Number of bytes written
+ */
+size_t rn_dtoa(char *dst, double value)
+{
+	int len;
+	char *ptr;
+	size_t i;
+	size_t ndigits;
+	double scaled;
+	uint64_t mantissa;
+	uint64_t fraction;
+
+	ptr = dst;
+	if (__builtin_isnan(value)) {
+		memcpy(dst, "nan", 3);
+		return 3;
+	}
+	if (__builtin_signbit(value)) {
+		*ptr++ = '-';
+		value = -value;
+	}
+	if (__builtin_isinf(value)) {
+		memcpy(ptr, "inf", 3);
+		return ptr - dst + 3;
+	}
+	for (i = 0; i < 18; i++) {
+		scaled = value * rn_number_dpow10[i];
+		if (scaled >= RN_NUMBER_DMANTISSA_MAX) {
+			break;
+		}
+		mantissa = (uint64_t) (scaled + 0.5);
+		/* Both operands are exact, the division is correctly rounded */
+		if ((double) mantissa / rn_number_dpow10[i] != value) {
+			continue;
+		}
+		ptr += rn_u64toa(ptr, mantissa / rn_number_pow10[i]);
+		fraction = mantissa % rn_number_pow10[i];
+		if (fraction != 0) {
+			*ptr++ = '.';
+			ndigits = rn_number_ndigits(fraction);
+			memset(ptr, '0', i - ndigits);
+			ptr += i - ndigits;
+			ptr += rn_u64toa(ptr, fraction);
+			while (ptr[-1] == '0') {
+				ptr--;
+			}
+		}
+		return ptr - dst;
+	}
+	for (i = 15; i < 17; i++) {
+		len = snprintf(ptr, RN_DTOA_MAX - (ptr - dst), "%.*g", (int) i, value);
+		if (strtod(ptr, NULL) == value) {
+			return ptr - dst + len;
+		}
+	}
+	len = snprintf(ptr, RN_DTOA_MAX - (ptr - dst), "%.17g", value);
+	return ptr - dst + len;
+}
+
+/**
+ * Parses a decimal unsigned integer. No sign, space or base prefix
+ * is accepted.
+ *
+ * @param ptr Pointer to the digits
+ * @param size Maximum number of bytes to read
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no digit or the value overflows
+ */
+size_t rn_atou64(const char *ptr, size_t size, uint64_t *value)
+{
+	size_t i;
+	uint64_t result;
+	unsigned int digit;
+
+	result = 0;
+	for (i = 0; i < size; i++) {
+		digit = (unsigned char) ptr[i] - '0';
+		if (digit > 9) {
+			break;
+		}
+		if (result > (UINT64_MAX - digit) / 10) {
+			*value = UINT64_MAX;
+			errno = ERANGE;
+			return 0;
+		}
+		result = result * 10 + digit;
+	}
+	*value = result;
+	return i;
+}
+
+/**
+ * Parses a decimal signed integer with an optional sign. No space or
+ * base prefix is accepted.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no digit or the value overflows
+ */
+size_t rn_atoi64(const char *ptr, size_t size, int64_t *value)
+{
+	size_t len;
+	size_t sign;
+	bool negative;
+	uint64_t result;
+
+	sign = 0;
+	negative = false;
+	if (size > 0 && (ptr[0] == '-' || ptr[0] == '+')) {
+		negative = (ptr[0] == '-');
+		sign = 1;
+	}
+	*value = 0;
+	len = rn_atou64(ptr + sign, size - sign, &result);
+	if (len == 0) {
+		if (result == UINT64_MAX) {
+			*value = (negative ? INT64_MIN : INT64_MAX);
+		}
+		return 0;
+	}
+	if (result > (uint64_t) INT64_MAX + negative) {
+		*value = (negative ? INT64_MIN : INT64_MAX);
+		errno = ERANGE;
+		return 0;
+	}
+	*value = (negative ? (int64_t) (0 - result) : (int64_t) result);
+	return sign + len;
+}
+
+/**
+ * Parses an integer magnitude the way strtoul does: leading spaces,
+ * optional sign and base prefix.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param base Numeric base, 0 to guess it from the prefix
+ * @param negative Pointer where to store the sign
+ * @param value Pointer where to store the magnitude
+ * @param overflow Pointer where to store the overflow flag
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+static size_t rn_number_parse(const char *ptr, size_t size, int base, bool *negative, unsigned long int *value, bool *overflow)
+{
+	int digit;
+	size_t i;
+	size_t start;
+	unsigned long int result;
+
+	*value = 0;
+	*negative = false;
+	*overflow = false;
+	if (base < 0 || base == 1 || base > 36) {
+		errno = EINVAL;
+		return 0;
+	}
+	for (i = 0; i < size && rn_number_isspace(ptr[i]); i++);
+	if (i < size && (ptr[i] == '-' || ptr[i] == '+')) {
+		*negative = (ptr[i] == '-');
+		i++;
+	}
+	if ((base == 0 || base == 16) && i + 2 < size &&
+	    ptr[i] == '0' && (ptr[i + 1] | 0x20) == 'x' &&
+	    rn_number_digit(ptr[i + 2], 16) >= 0) {
+		i += 2;
+		base = 16;
+	} else if (base == 0) {
+		base = (i < size && ptr[i] == '0' ? 8 : 10);
+	}
+	result = 0;
+	for (start = i; i < size && (digit = rn_number_digit(ptr[i], base)) >= 0; i++) {
+		if (result > (ULONG_MAX - digit) / base) {
+			*overflow = true;
+		} else {
+			result = result * base + digit;
+		}
+	}
+	if (i == start) {
+		*negative = false;
+		return 0;
+	}
+	*value = result;
+	return i;
+}
+
+/**
+ * Converts a string to a long int accordingly to strtol, reading at
+ * most size bytes.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param base Conversion base
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+size_t rn_strntol(const char *ptr, size_t size, int base, long int *value)
+{
+	size_t len;
+	bool overflow;
+	bool negative;
+	unsigned long int result;
+
+	len = rn_number_parse(ptr, size, base, &negative, &result, &overflow);
+	if (!negative && (overflow || result > LONG_MAX)) {
+		*value = LONG_MAX;
+		errno = ERANGE;
+	} else if (negative && (overflow || result > (unsigned long int) LONG_MAX + 1)) {
+		*value = LONG_MIN;
+		errno = ERANGE;
+	} else if (negative && result > 0) {
+		*value = -(long int) (result - 1) - 1;
+	} else {
+		*value = result;
+	}
+	return len;
+}
+
+/**
+ * Converts a string to an unsigned long int accordingly to strtoul,
+ * reading at most size bytes.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param base Conversion base
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+size_t rn_strntoul(const char *ptr, size_t size, int base, unsigned long int *value)
+{
+	size_t len;
+	bool overflow;
+	bool negative;
+	unsigned long int result;
+
+	len = rn_number_parse(ptr, size, base, &negative, &result, &overflow);
+	if (overflow) {
+		*value = ULONG_MAX;
+		errno = ERANGE;
+	} else {
+		*value = (negative ? 0 - result : result);
+	}
+	return len;
+}
+
+/**
+ * Scans a decimal floating point number the way strtod does. Up to 19
+ * significant digits are kept in the mantissa.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param negative Pointer where to store the sign
+ * @param mantissa Pointer where to store the significant digits
+ * @param exponent Pointer where to store the decimal exponent
+ * @param exact Pointer where to store whether mantissa and exponent are exact
+ *
+ * @return Number of bytes scanned, or 0 if this is not a decimal number
+ */
+static size_t rn_number_scanfloat(const char *ptr, size_t size, bool *negative, uint64_t *mantissa, int *exponent, bool *exact)
+{
+	int exp;
+	int eexp;
+	int ndigits;
+	size_t i;
+	size_t end;
+	bool digits;
+	bool eneg;
+	unsigned int digit;
+	uint64_t result;
+
+	exp = 0;
+	ndigits = 0;
+	result = 0;
+	digits = false;
+	*exact = true;
+	*negative = false;
+	for (i = 0; i < size && rn_number_isspace(ptr[i]); i++);
+	if (i < size && (ptr[i] == '-' || ptr[i] == '+')) {
+		*negative = (ptr[i] == '-');
+		i++;
+	}
+	if (i + 1 < size && ptr[i] == '0' && (ptr[i + 1] | 0x20) == 'x') {
+		/* Hexadecimal float */
+		return 0;
+	}
+	for (; i < size && (digit = (unsigned char) ptr[i] - '0') <= 9; i++) {
+		digits = true;
+		if (result == 0 && digit == 0) {
+			continue;
+		}
+		if (ndigits < 19) {
+			result = result * 10 + digit;
+			ndigits++;
+		} else {
+			exp++;
+			*exact = (*exact && digit == 0);
+		}
+	}
+	if (i < size && ptr[i] == '.') {
+		for (i++; i < size && (digit = (unsigned char) ptr[i] - '0') <= 9; i++) {
+			digits = true;
+			if (result == 0 && digit == 0) {
+				exp--;
+			} else if (ndigits < 19) {
+				result = result * 10 + digit;
+				ndigits++;
+				exp--;
+			} else {
+				*exact = (*exact && digit == 0);
+			}
+		}
+	}
+	if (!digits) {
+		return 0;
+	}
+	end = i;
+	if (i < size && (ptr[i] | 0x20) == 'e') {
+		eneg = false;
+		if (++i < size && (ptr[i] == '-' || ptr[i] == '+')) {
+			eneg = (ptr[i] == '-');
+			i++;
+		}
+		if (i < size && (unsigned char) ptr[i] - '0' <= 9) {
+			for (eexp = 0; i < size && (digit = (unsigned char) ptr[i] - '0') <= 9; i++) {
+				if (eexp < 100000) {
+					eexp = eexp * 10 + digit;
+				}
+			}
+			exp += (eneg ? -eexp : eexp);
+			end = i;
+		}
+	}
+	*mantissa = result;
+	*exponent = exp;
+	return end;
+}
+
+/**
+ * Converts a number with strtod or strtof. The number is copied to
+ * the stack to be null-terminated, except for unusually long numbers.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param len Number of bytes to convert, 0 if unknown
+ * @param dvalue Pointer where to store a double result, or NULL
+ * @param fvalue Pointer where to store a float result, or NULL
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+static size_t rn_number_strtod(const char *ptr, size_t size, size_t len, double *dvalue, float *fvalue)
+{
+	char *str;
+	char *endptr;
+	char tmp[RN_NUMBER_SCAN_MAX * 2];
+
+	if (len == 0) {
+		len = (size < RN_NUMBER_SCAN_MAX ? size : RN_NUMBER_SCAN_MAX);
+	}
+	str = tmp;
+	if (len >= sizeof(tmp)) {
+		str = rn_malloc(len + 1);
+		if (str == NULL) {
+			return 0;
+		}
+	}
+	memcpy(str, ptr, len);
+	str[len] = 0;
+	if (dvalue != NULL) {
+		*dvalue = strtod(str, &endptr);
+	} else {
+		*fvalue = strtof(str, &endptr);
+	}
+	if (str != tmp) {
+		rn_free(str);
+	}
+	return endptr - str;
+}
+
+/**
+ * Converts a string to a double accordingly to strtod, reading at
+ * most size bytes. Decimal numbers with up to 15 significant digits
+ * and a small exponent are converted exactly without any copy.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+size_t rn_strntod(const char *ptr, size_t size, double *value)
+{
+	int exp;
+	size_t len;
+	bool exact;
+	bool negative;
+	double result;
+	uint64_t mantissa;
+
+	len = rn_number_scanfloat(ptr, size, &negative, &mantissa, &exp, &exact);
+	if (len > 0 && exact && mantissa <= RN_NUMBER_DMANTISSA_MAX && exp >= -22 && exp <= 22) {
+		result = (double) mantissa;
+		result = (exp < 0 ? result / rn_number_dpow10[-exp] : result * rn_number_dpow10[exp]);
+		*value = (negative ? -result : result);
+		return len;
+	}
+	return rn_number_strtod(ptr, size, len, value, NULL);
+}
+
+/**
+ * Converts a string to a float accordingly to strtof, reading at
+ * most size bytes. Decimal numbers with up to 7 significant digits
+ * and a small exponent are converted exactly without any copy.
+ *
+ * @param ptr Pointer to the number
+ * @param size Maximum number of bytes to read
+ * @param value Pointer where to store the result
+ *
+ * @return Number of bytes parsed, or 0 if there is no conversion
+ */
+size_t rn_strntof(const char *ptr, size_t size, float *value)
+{
+	int exp;
+	size_t len;
+	bool exact;
+	float result;
+	bool negative;
+	uint64_t mantissa;
+
+	len = rn_number_scanfloat(ptr, size, &negative, &mantissa, &exp, &exact);
+	if (len > 0 && exact && mantissa <= RN_NUMBER_FMANTISSA_MAX && exp >= -10 && exp <= 10) {
+		result = (float) mantissa;
+		result = (exp < 0 ? result / rn_number_fpow10[-exp] : result * rn_number_fpow10[exp]);
+		*value = (negative ? -result : result);
+		return len;
+	}
+	return rn_number_strtod(ptr, size, len, NULL, value);
+}
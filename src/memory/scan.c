@@ -0,0 +1,426 @@
+/**
+ * @file   scan.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Byte scanning and comparison kernels. Vector versions are
+ *         selected at runtime depending on CPU features, the scalar
+ *         versions are used everywhere else.
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include "rinoo/memory/module.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+# define RN_SCAN_X86
+#endif
+
+typedef struct rn_scan_ops_s {
+	rn_scan_level_t level;
+	void *(*mem)(const void *ptr, size_t size, const void *delim, size_t dlen);
+	size_t (*set)(const void *ptr, size_t size, const char *set, size_t setlen);
+	int (*casecmp)(const void *ptr1, const void *ptr2, size_t size);
+} rn_scan_ops_t;
+
+static const rn_scan_ops_t *rn_scan_ops = NULL;
+
+#define rn_scan_lower(c)	((c) >= 'A' && (c) <= 'Z' ? (c) + ('a' - 'A') : (c))
+
+static void *rn_scan_mem_scalar(const void *ptr, size_t size, const void *delim, size_t dlen)
+{
+	return memmem(ptr, size, delim, dlen);
+}
+
+static size_t rn_scan_set_scalar(const void *ptr, size_t size, const char *set, size_t setlen)
+{
+	size_t i;
+	uint64_t map[4] = { 0 };
+	const unsigned char *data = ptr;
+
+	for (i = 0; i < setlen; i++) {
+		map[(unsigned char) set[i] >> 6] |= 1ULL << ((unsigned char) set[i] & 63);
+	}
+	for (i = 0; i < size; i++) {
+		if (map[data[i] >> 6] & (1ULL << (data[i] & 63))) {
+			return i;
+		}
+	}
+	return size;
+}
+
+static int rn_scan_casecmp_scalar(const void *ptr1, const void *ptr2, size_t size)
+{
+	size_t i;
+	unsigned char c1;
+	unsigned char c2;
+
+	for (i = 0; i < size; i++) {
+		c1 = ((const unsigned char *) ptr1)[i];
+		c2 = ((const unsigned char *) ptr2)[i];
+		c1 = rn_scan_lower(c1);
+		c2 = rn_scan_lower(c2);
+		if (c1 != c2) {
+			return c1 - c2;
+		}
+	}
+	return 0;
+}
+
+static const rn_scan_ops_t rn_scan_ops_scalar = {
+	.level = RN_SCAN_SCALAR,
+	.mem = rn_scan_mem_scalar,
+	.set = rn_scan_set_scalar,
+	.casecmp = rn_scan_casecmp_scalar,
+};
+
+#ifdef RN_SCAN_X86
+
+/*
+ * Substring search compares the first and the last delimiter bytes
+ * against a whole vector of candidates, only positions where both
+ * match are verified with memcmp.
+ */
+
+__attribute__((target("sse4.2")))
+static void *rn_scan_mem_sse42(const void *ptr, size_t size, const void *delim, size_t dlen)
+{
+	size_t i;
+	unsigned int mask;
+	__m128i first, last, b1, b2;
+	const char *data = ptr;
+	const char *d = delim;
+
+	if (dlen < 2 || size < dlen + 15) {
+		return memmem(ptr, size, delim, dlen);
+	}
+	first = _mm_set1_epi8(d[0]);
+	last = _mm_set1_epi8(d[dlen - 1]);
+	for (i = 0; i + dlen + 15 <= size; i += 16) {
+		b1 = _mm_loadu_si128((const __m128i *)(data + i));
+		b2 = _mm_loadu_si128((const __m128i *)(data + i + dlen - 1));
+		mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(b1, first), _mm_cmpeq_epi8(b2, last)));
+		while (mask != 0) {
+			if (memcmp(data + i + __builtin_ctz(mask) + 1, d + 1, dlen - 2) == 0) {
+				return (void *)(data + i + __builtin_ctz(mask));
+			}
+			mask &= mask - 1;
+		}
+	}
+	return memmem(data + i, size - i, delim, dlen);
+}
+
+__attribute__((target("sse4.2")))
+static size_t rn_scan_set_sse42(const void *ptr, size_t size, const char *set, size_t setlen)
+{
+	int idx;
+	size_t i;
+	__m128i vset;
+	char tmp[16];
+	const char *data = ptr;
+
+	memset(tmp, 0, sizeof(tmp));
+	memcpy(tmp, set, setlen);
+	vset = _mm_loadu_si128((const __m128i *) tmp);
+	for (i = 0; i + 16 <= size; i += 16) {
+		idx = _mm_cmpestri(vset, setlen, _mm_loadu_si128((const __m128i *)(data + i)), 16,
+				   _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+		if (idx < 16) {
+			return i + idx;
+		}
+	}
+	if (i < size) {
+		/* Never reads past the end of data */
+		memcpy(tmp, data + i, size - i);
+		idx = _mm_cmpestri(vset, setlen, _mm_loadu_si128((const __m128i *) tmp), size - i,
+				   _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+		if ((size_t) idx < size - i) {
+			return i + idx;
+		}
+	}
+	return size;
+}
+
+__attribute__((target("sse4.2")))
+static inline __m128i rn_scan_lower_sse42(__m128i v)
+{
+	__m128i upper;
+
+	upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+	return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+__attribute__((target("sse4.2")))
+static int rn_scan_casecmp_sse42(const void *ptr1, const void *ptr2, size_t size)
+{
+	size_t i;
+	unsigned int mask;
+	__m128i v1, v2;
+	const char *data1 = ptr1;
+	const char *data2 = ptr2;
+
+	for (i = 0; i + 16 <= size; i += 16) {
+		v1 = _mm_loadu_si128((const __m128i *)(data1 + i));
+		v2 = _mm_loadu_si128((const __m128i *)(data2 + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)) == 0xffff) {
+			continue;
+		}
+		v1 = rn_scan_lower_sse42(v1);
+		v2 = rn_scan_lower_sse42(v2);
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)) ^ 0xffff;
+		if (mask != 0) {
+			i += __builtin_ctz(mask);
+			return rn_scan_casecmp_scalar(data1 + i, data2 + i, 1);
+		}
+	}
+	return rn_scan_casecmp_scalar(data1 + i, data2 + i, size - i);
+}
+
+static const rn_scan_ops_t rn_scan_ops_sse42 = {
+	.level = RN_SCAN_SSE42,
+	.mem = rn_scan_mem_sse42,
+	.set = rn_scan_set_sse42,
+	.casecmp = rn_scan_casecmp_sse42,
+};
+
+__attribute__((target("avx2")))
+static void *rn_scan_mem_avx2(const void *ptr, size_t size, const void *delim, size_t dlen)
+{
+	size_t i;
+	unsigned int mask;
+	__m256i first, last, b1, b2;
+	const char *data = ptr;
+	const char *d = delim;
+
+	if (dlen < 2 || size < dlen + 31) {
+		return rn_scan_mem_sse42(ptr, size, delim, dlen);
+	}
+	first = _mm256_set1_epi8(d[0]);
+	last = _mm256_set1_epi8(d[dlen - 1]);
+	for (i = 0; i + dlen + 31 <= size; i += 32) {
+		b1 = _mm256_loadu_si256((const __m256i *)(data + i));
+		b2 = _mm256_loadu_si256((const __m256i *)(data + i + dlen - 1));
+		mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(b1, first), _mm256_cmpeq_epi8(b2, last)));
+		while (mask != 0) {
+			if (memcmp(data + i + __builtin_ctz(mask) + 1, d + 1, dlen - 2) == 0) {
+				return (void *)(data + i + __builtin_ctz(mask));
+			}
+			mask &= mask - 1;
+		}
+	}
+	return rn_scan_mem_sse42(data + i, size - i, delim, dlen);
+}
+
+__attribute__((target("avx2")))
+static size_t rn_scan_set_avx2(const void *ptr, size_t size, const char *set, size_t setlen)
+{
+	size_t i;
+	size_t j;
+	unsigned int mask;
+	__m256i v, match;
+	__m256i vset[RN_SCAN_SET_MAX];
+	const char *data = ptr;
+
+	if (setlen > 4) {
+		/* Equal-any string instruction is faster for large sets */
+		return rn_scan_set_sse42(ptr, size, set, setlen);
+	}
+	for (j = 0; j < setlen; j++) {
+		vset[j] = _mm256_set1_epi8(set[j]);
+	}
+	for (i = 0; i + 32 <= size; i += 32) {
+		v = _mm256_loadu_si256((const __m256i *)(data + i));
+		match = _mm256_cmpeq_epi8(v, vset[0]);
+		for (j = 1; j < setlen; j++) {
+			match = _mm256_or_si256(match, _mm256_cmpeq_epi8(v, vset[j]));
+		}
+		mask = _mm256_movemask_epi8(match);
+		if (mask != 0) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+	return i + rn_scan_set_sse42(data + i, size - i, set, setlen);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i rn_scan_lower_avx2(__m256i v)
+{
+	__m256i upper;
+
+	upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v));
+	return _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+static int rn_scan_casecmp_avx2(const void *ptr1, const void *ptr2, size_t size)
+{
+	size_t i;
+	unsigned int mask;
+	__m256i v1, v2;
+	const char *data1 = ptr1;
+	const char *data2 = ptr2;
+
+	for (i = 0; i + 32 <= size; i += 32) {
+		v1 = _mm256_loadu_si256((const __m256i *)(data1 + i));
+		v2 = _mm256_loadu_si256((const __m256i *)(data2 + i));
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, v2)) == -1) {
+			/* Same case, no need to fold */
+			continue;
+		}
+		v1 = rn_scan_lower_avx2(v1);
+		v2 = rn_scan_lower_avx2(v2);
+		mask = ~((unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, v2)));
+		if (mask != 0) {
+			i += __builtin_ctz(mask);
+			return rn_scan_casecmp_scalar(data1 + i, data2 + i, 1);
+		}
+	}
+	return rn_scan_casecmp_sse42(data1 + i, data2 + i, size - i);
+}
+
+static const rn_scan_ops_t rn_scan_ops_avx2 = {
+	.level = RN_SCAN_AVX2,
+	.mem = rn_scan_mem_avx2,
+	.set = rn_scan_set_avx2,
+	.casecmp = rn_scan_casecmp_avx2,
+};
+
+#endif /* !RN_SCAN_X86 */
+
+/**
+ * Gets the best kernel set supported by the CPU.
+ *
+ * @return Pointer to the kernel set
+ */
+static const rn_scan_ops_t *rn_scan_resolve(void)
+{
+#ifdef RN_SCAN_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return &rn_scan_ops_avx2;
+	}
+	if (__builtin_cpu_supports("sse4.2")) {
+		return &rn_scan_ops_sse42;
+	}
+#endif
+	return &rn_scan_ops_scalar;
+}
+
+/**
+ * Gets current kernel set. It is resolved on first use.
+ *
+ * @return Pointer to the kernel set
+ */
+static inline const rn_scan_ops_t *rn_scan_get(void)
+{
+	const rn_scan_ops_t *ops;
+
+	ops = __atomic_load_n(&rn_scan_ops, __ATOMIC_RELAXED);
+	if (unlikely(ops == NULL)) {
+		ops = rn_scan_resolve();
+		__atomic_store_n(&rn_scan_ops, ops, __ATOMIC_RELAXED);
+	}
+	return ops;
+}
+
+/**
+ * Gets the kernel set level in use.
+ *
+ * @return Kernel set level
+ */
+rn_scan_level_t rn_scan_level(void)
+{
+	return rn_scan_get()->level;
+}
+
+/**
+ * Forces the kernel set level. A level not supported by the CPU
+ * falls back to the best supported one below it.
+ * RN_SCAN_AUTO selects the best level supported by the CPU.
+ *
+ * @param level Kernel set level
+ *
+ * @return Kernel set level in use
+ */
+rn_scan_level_t rn_scan_setlevel(rn_scan_level_t level)
+{
+	const rn_scan_ops_t *ops;
+
+	ops = rn_scan_resolve();
+	if (level < ops->level) {
+		switch (level) {
+#ifdef RN_SCAN_X86
+		case RN_SCAN_SSE42:
+			ops = &rn_scan_ops_sse42;
+			break;
+#endif
+		default:
+			ops = &rn_scan_ops_scalar;
+			break;
+		}
+	}
+	__atomic_store_n(&rn_scan_ops, ops, __ATOMIC_RELAXED);
+	return ops->level;
+}
+
+/**
+ * Finds the first occurrence of a delimiter in memory, like memmem.
+ * This is mostly used to look for CRLF and CRLFCRLF.
+ *
+ * @param ptr Pointer to the memory to scan
+ * @param size Memory size
+ * @param delim Pointer to the delimiter
+ * @param dlen Delimiter size
+ *
+ * @return Pointer to the first delimiter occurrence or NULL if not found
+ */
+void *rn_scan_mem(const void *ptr, size_t size, const void *delim, size_t dlen)
+{
+	if (dlen > size) {
+		return NULL;
+	}
+	if (dlen == 1) {
+		return memchr(ptr, *(const char *) delim, size);
+	}
+	return rn_scan_get()->mem(ptr, size, delim, dlen);
+}
+
+/**
+ * Finds the first byte in memory which belongs to a character set, like strcspn.
+ *
+ * @param ptr Pointer to the memory to scan
+ * @param size Memory size
+ * @param set Nul-terminated character set
+ *
+ * @return Offset of the first matching byte, or size if none matches
+ */
+size_t rn_scan_set(const void *ptr, size_t size, const char *set)
+{
+	size_t setlen;
+
+	setlen = strlen(set);
+	if (setlen == 0) {
+		return size;
+	}
+	if (setlen > RN_SCAN_SET_MAX) {
+		return rn_scan_set_scalar(ptr, size, set, setlen);
+	}
+	return rn_scan_get()->set(ptr, size, set, setlen);
+}
+
+/**
+ * Compares memory ignoring ASCII case.
+ *
+ * @param ptr1 Pointer to the first memory area
+ * @param ptr2 Pointer to the second memory area
+ * @param size Number of bytes to compare
+ *
+ * @return An integer less than, equal to, or greater than zero if ptr1 is found, respectively, to be less than, to match, or be greater than ptr2
+ */
+int rn_scan_casecmp(const void *ptr1, const void *ptr2, size_t size)
+{
+	return rn_scan_get()->casecmp(ptr1, ptr2, size);
+}
@@ -0,0 +1,311 @@
+/**
+ * @file   slab.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Slab allocator
+ *
+ *
+ */
+
+#include "rinoo/memory/module.h"
+
+/**
+ * Gets the size class index matching an allocation size.
+ *
+ * @param size Allocation size
+ *
+ * @return Class index or RN_SLAB_NB_CLASSES if size is too big for the slab
+ */
+static inline size_t rn_slab_class(size_t size)
+{
+	if (size <= (1UL << RN_SLAB_MINSHIFT)) {
+		return 0;
+	}
+	if (unlikely(size > RN_SLAB_MAXSIZE)) {
+		return RN_SLAB_NB_CLASSES;
+	}
+	return (size_t)(64 - __builtin_clzl(size - 1)) - RN_SLAB_MINSHIFT;
+}
+
+/**
+ * Initializes a slab allocator.
+ * The calling thread becomes the slab owner.
+ *
+ * @param slab Pointer to the slab to initialize
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_slab(rn_slab_t *slab)
+{
+	size_t i;
+
+	memset(slab, 0, sizeof(*slab));
+	for (i = 0; i < RN_SLAB_NB_CLASSES; i++) {
+		slab->classes[i].size = 1UL << (RN_SLAB_MINSHIFT + i);
+	}
+	slab->nbclasses = RN_SLAB_NB_CLASSES;
+	slab->owner = pthread_self();
+	return 0;
+}
+
+/**
+ * Releases all chunks of a slab.
+ *
+ * @param slab Pointer to the slab
+ */
+static void rn_slab_release(rn_slab_t *slab)
+{
+	rn_slab_chunk_t *chunk;
+
+	while (slab->chunks != NULL) {
+		chunk = slab->chunks;
+		slab->chunks = chunk->next;
+		rn_allocator.free(chunk);
+	}
+}
+
+/**
+ * Moves the chunks of a slab to a heap allocated slab,
+ * which lives until its last object gets released.
+ * Every object carved from these chunks is bound to the new slab.
+ *
+ * @param slab Pointer to the slab to detach
+ * @param nbused Number of objects still allocated
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_slab_orphan(rn_slab_t *slab, size_t nbused)
+{
+	char *ptr;
+	char *end;
+	size_t objsize;
+	rn_slab_t *orphan;
+	rn_slab_obj_t *obj;
+	rn_slab_chunk_t *chunk;
+
+	orphan = rn_allocator.malloc(sizeof(*orphan));
+	if (unlikely(orphan == NULL)) {
+		return -1;
+	}
+	*orphan = *slab;
+	orphan->remote = NULL;
+	orphan->nborphans = nbused;
+	/* A chunk only holds objects of a single class */
+	for (chunk = orphan->chunks; chunk != NULL; chunk = chunk->next) {
+		ptr = (char *) chunk + sizeof(*chunk);
+		end = (char *) chunk + chunk->size;
+		obj = (rn_slab_obj_t *) ptr;
+		objsize = RN_SLAB_HDRSIZE + orphan->classes[obj->class].size;
+		for (; ptr + objsize <= end; ptr += objsize) {
+			((rn_slab_obj_t *) ptr)->slab = orphan;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Destroys a slab allocator and releases all its chunks.
+ * If objects are still allocated from this slab, chunks are handed
+ * over to a detached slab and released along with the last object.
+ * No object may be released concurrently with this call.
+ *
+ * @param slab Pointer to the slab to destroy
+ */
+void rn_slab_destroy(rn_slab_t *slab)
+{
+	size_t i;
+	size_t nbused;
+
+	rn_slab_reclaim(slab);
+	for (i = 0, nbused = 0; i < RN_SLAB_NB_CLASSES; i++) {
+		nbused += slab->classes[i].nbused;
+	}
+	if (unlikely(nbused != 0)) {
+		if (rn_slab_orphan(slab, nbused) != 0) {
+			/* Live objects would point to released memory */
+			fprintf(stderr, "rn_slab_destroy: leaking %zu chunks, %zu objects still allocated\n", slab->nbchunks, nbused);
+		}
+		slab->chunks = NULL;
+	}
+	rn_slab_release(slab);
+	slab->nbchunks = 0;
+	slab->remote = NULL;
+	memset(slab->classes, 0, sizeof(slab->classes));
+}
+
+/**
+ * Sets the calling thread as slab owner.
+ * Objects freed from any other thread go through the remote queue.
+ *
+ * @param slab Pointer to the slab
+ */
+void rn_slab_owner(rn_slab_t *slab)
+{
+	slab->owner = pthread_self();
+}
+
+/**
+ * Moves objects freed by other threads back to their free lists.
+ * This function must be called by the slab owner.
+ *
+ * @param slab Pointer to the slab
+ */
+void rn_slab_reclaim(rn_slab_t *slab)
+{
+	rn_slab_obj_t *obj;
+	rn_slab_obj_t *next;
+	rn_slab_class_t *class;
+
+	if (__atomic_load_n(&slab->remote, __ATOMIC_RELAXED) == NULL) {
+		return;
+	}
+	obj = __atomic_exchange_n(&slab->remote, NULL, __ATOMIC_ACQUIRE);
+	while (obj != NULL) {
+		next = obj->next;
+		class = &slab->classes[obj->class];
+		obj->next = class->free;
+		class->free = obj;
+		class->nbused--;
+		obj = next;
+	}
+}
+
+/**
+ * Carves a new chunk into free objects of a given class.
+ *
+ * @param slab Pointer to the slab
+ * @param class Pointer to the class to refill
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_slab_refill(rn_slab_t *slab, rn_slab_class_t *class)
+{
+	char *ptr;
+	char *end;
+	size_t objsize;
+	rn_slab_obj_t *obj;
+	rn_slab_chunk_t *chunk;
+
+	/* Chunks are not accounted, objects carved from them are */
+	chunk = rn_allocator.malloc(RN_SLAB_CHUNK_SIZE);
+	if (unlikely(chunk == NULL)) {
+		return -1;
+	}
+	chunk->size = RN_SLAB_CHUNK_SIZE;
+	chunk->next = slab->chunks;
+	slab->chunks = chunk;
+	slab->nbchunks++;
+	objsize = RN_SLAB_HDRSIZE + class->size;
+	ptr = (char *) chunk + sizeof(*chunk);
+	end = (char *) chunk + RN_SLAB_CHUNK_SIZE;
+	for (; ptr + objsize <= end; ptr += objsize) {
+		obj = (rn_slab_obj_t *) ptr;
+		obj->slab = slab;
+		obj->class = (size_t)(class - slab->classes);
+		obj->next = class->free;
+		class->free = obj;
+	}
+	return 0;
+}
+
+/**
+ * Allocates memory from a slab.
+ * Allocations bigger than RN_SLAB_MAXSIZE, or made without a slab,
+ * fall back to rn_malloc and can still be released with rn_slab_free.
+ *
+ * @param slab Pointer to the slab (can be NULL)
+ * @param size Allocation size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_slab_alloc(rn_slab_t *slab, size_t size)
+{
+	size_t index;
+	rn_slab_obj_t *obj;
+	rn_slab_class_t *class;
+
+	index = rn_slab_class(size);
+	if (slab == NULL || index >= slab->nbclasses) {
+		obj = rn_malloc(RN_SLAB_HDRSIZE + size);
+		if (unlikely(obj == NULL)) {
+			return NULL;
+		}
+		obj->slab = NULL;
+		obj->class = RN_SLAB_NB_CLASSES;
+		return (char *) obj + RN_SLAB_HDRSIZE;
+	}
+	class = &slab->classes[index];
+	if (class->free == NULL) {
+		rn_slab_reclaim(slab);
+		if (class->free == NULL && rn_slab_refill(slab, class) != 0) {
+			return NULL;
+		}
+	}
+	obj = class->free;
+	class->free = obj->next;
+	class->nbused++;
+	rn_allocator_account(size);
+	return (char *) obj + RN_SLAB_HDRSIZE;
+}
+
+/**
+ * Allocates zeroed memory from a slab.
+ *
+ * @param slab Pointer to the slab (can be NULL)
+ * @param size Allocation size
+ *
+ * @return Pointer to the allocated memory or NULL if an error occurs
+ */
+void *rn_slab_calloc(rn_slab_t *slab, size_t size)
+{
+	void *ptr;
+
+	ptr = rn_slab_alloc(slab, size);
+	if (likely(ptr != NULL)) {
+		memset(ptr, 0, size);
+	}
+	return ptr;
+}
+
+/**
+ * Releases memory allocated with rn_slab_alloc.
+ * When called from another thread than the slab owner,
+ * the object is pushed to the slab remote queue.
+ *
+ * @param ptr Pointer to the memory to release (can be NULL)
+ */
+void rn_slab_free(void *ptr)
+{
+	rn_slab_t *slab;
+	rn_slab_obj_t *obj;
+	rn_slab_class_t *class;
+
+	if (ptr == NULL) {
+		return;
+	}
+	obj = (rn_slab_obj_t *)((char *) ptr - RN_SLAB_HDRSIZE);
+	if (obj->class >= RN_SLAB_NB_CLASSES) {
+		rn_free(obj);
+		return;
+	}
+	rn_allocator_release();
+	slab = obj->slab;
+	if (unlikely(slab->nborphans != 0)) {
+		/* Slab has been destroyed, the last object releases it */
+		if (__atomic_sub_fetch(&slab->nborphans, 1, __ATOMIC_ACQ_REL) == 0) {
+			rn_slab_release(slab);
+			rn_allocator.free(slab);
+		}
+		return;
+	}
+	if (likely(pthread_equal(slab->owner, pthread_self()))) {
+		class = &slab->classes[obj->class];
+		obj->next = class->free;
+		class->free = obj;
+		class->nbused--;
+		return;
+	}
+	obj->next = __atomic_load_n(&slab->remote, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&slab->remote, &obj->next, obj, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
@@ -0,0 +1,95 @@
+/**
+ * @file   rn_arena.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_arena unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+static rn_arena_t *main_arena;
+
+void task_func(void *arg)
+{
+	char *ptr;
+	rn_arena_t *arena;
+	rn_sched_t *sched = arg;
+
+	arena = rn_task_arena(sched);
+	XTEST(arena != NULL);
+	XTEST(arena != main_arena);
+	XTEST(arena->head == NULL);
+	ptr = rn_arena_alloc(arena, 100);
+	XTEST(ptr != NULL);
+	memset(ptr, 'x', 100);
+	/* Released by rn_task_destroy */
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	char *ptr;
+	char *ptr2;
+	char *big;
+	rn_arena_t arena;
+	rn_buffer_t buffer;
+	rn_sched_t *sched;
+
+	XTEST(rn_arena(&arena, 1024) == 0);
+	XTEST(arena.head == NULL);
+	ptr = rn_arena_alloc(&arena, 10);
+	XTEST(ptr != NULL);
+	XTEST(((uintptr_t) ptr & (RN_ARENA_ALIGN - 1)) == 0);
+	XTEST(arena.head->used == RN_ARENA_ALIGN);
+	ptr2 = rn_arena_alloc(&arena, 10);
+	XTEST(ptr2 == ptr + RN_ARENA_ALIGN);
+	/* Last allocation grows in place */
+	XTEST(rn_arena_realloc(&arena, ptr2, 10, 100) == ptr2);
+	XTEST(arena.head->used == RN_ARENA_ALIGN + 112);
+	/* Others get copied */
+	memcpy(ptr, "abcdefghi", 10);
+	ptr2 = rn_arena_realloc(&arena, ptr, 10, 20);
+	XTEST(ptr2 != ptr);
+	XTEST(memcmp(ptr2, "abcdefghi", 10) == 0);
+	/* Big allocations get their own block, the current one keeps serving */
+	big = rn_arena_alloc(&arena, 4096);
+	XTEST(big != NULL);
+	XTEST(arena.head->size == 1024);
+	XTEST(arena.head->next->size == 4096);
+	ptr = rn_arena_alloc(&arena, 16);
+	XTEST(ptr == ptr2 + 32);
+	/* Reset keeps one block */
+	rn_arena_reset(&arena);
+	XTEST(arena.head != NULL);
+	XTEST(arena.head->next == NULL);
+	XTEST(arena.head->used == 0);
+	XTEST(rn_arena_alloc(&arena, 1) == ptr2 - RN_ARENA_ALIGN - 112);
+	/* Arena buffer class */
+	XTEST(rn_buffer_arena(&buffer, &arena) == 0);
+	XTEST(buffer.msize == RN_ARENA_BUFFER_INISIZE);
+	XTEST(rn_buffer_add(&buffer, "test", 4) == 4);
+	while (rn_buffer_size(&buffer) < 10000) {
+		XTEST(rn_buffer_addstr(&buffer, "0123456789") == 10);
+	}
+	XTEST(rn_buffer_strncmp(&buffer, "test0123456789", 14) == 0);
+	XTEST(rn_buffer_msize(&buffer) >= 10000);
+	rn_arena_destroy(&arena);
+	XTEST(arena.head == NULL);
+	/* Task arenas */
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	main_arena = rn_task_arena(sched);
+	XTEST(main_arena == &sched->driver.main.arena);
+	XTEST(rn_task_start(sched, task_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,155 @@
+/**
+ * @file   rn_buffer_b64decode.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_b64decode unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define DATA_SIZE	300
+
+static const char b64_vector[] =
+	"AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4vMDEyMzQ1Njc4"
+	"OTo7PD0+P0BBQkNERUZHSElKS0xNTk9QUVJTVFVWV1hZWltcXV5fYGFiY2RlZmdoaWprbG1ub3Bx"
+	"cnN0dXZ3eHl6e3x9fn+AgYKDhIWGh4iJiouMjY6PkJGSk5SVlpeYmZqbnJ2en6ChoqOkpaanqKmq"
+	"q6ytrq+wsbKztLW2t7i5uru8vb6/wMHCw8TFxsfIycrLzM3Oz9DR0tPU1dbX2Nna29zd3t/g4eLj"
+	"5OXm5+jp6uvs7e7v8PHy8/T19vf4+fr7/P3+/w==";
+
+static void check_vectors(void)
+{
+	char c;
+	size_t i;
+	rn_buffer_t src;
+	rn_buffer_t *dst;
+	rn_buffer_t *url;
+
+	dst = rn_buffer_create(NULL);
+	XTEST(dst != NULL);
+	rn_buffer_set(&src, "dGhpcyBpcyBhIHRlc3Qu");
+	XTEST(rn_buffer_b64decode(dst, &src) == 0);
+	XTEST(rn_buffer_strcmp(dst, "this is a test.") == 0);
+	rn_buffer_reset(dst);
+	rn_buffer_set(&src, b64_vector);
+	XTEST(rn_buffer_b64decode(dst, &src) == 0);
+	XTEST(rn_buffer_size(dst) == 256);
+	for (i = 0; i < 256; i++) {
+		XTEST(((unsigned char *) rn_buffer_ptr(dst))[i] == i);
+	}
+	/* Same data, URL-safe alphabet without padding */
+	url = rn_buffer_create(NULL);
+	XTEST(url != NULL);
+	XTEST(rn_buffer_b64urlencode(url, dst) == 0);
+	XTEST(rn_buffer_size(url) == strlen(b64_vector) - 2);
+	for (i = 0; i < rn_buffer_size(url); i++) {
+		c = b64_vector[i];
+		c = (c == '+' ? '-' : (c == '/' ? '_' : c));
+		XTEST(((char *) rn_buffer_ptr(url))[i] == c);
+	}
+	rn_buffer_reset(dst);
+	XTEST(rn_buffer_b64urldecode(dst, url) == 0);
+	XTEST(rn_buffer_size(dst) == 256);
+	for (i = 0; i < 256; i++) {
+		XTEST(((unsigned char *) rn_buffer_ptr(dst))[i] == i);
+	}
+	rn_buffer_destroy(url);
+	rn_buffer_destroy(dst);
+}
+
+static void check_roundtrip(rn_b64_mode_t mode)
+{
+	size_t i;
+	size_t size;
+	rn_buffer_t src;
+	rn_buffer_t *enc;
+	rn_buffer_t *dec;
+	rn_buffer_t *ref;
+	unsigned char data[DATA_SIZE];
+	rn_scan_level_t level;
+
+	for (i = 0; i < DATA_SIZE; i++) {
+		data[i] = (i * 167 + 13) & 0xff;
+	}
+	enc = rn_buffer_create(NULL);
+	dec = rn_buffer_create(NULL);
+	ref = rn_buffer_create(NULL);
+	level = rn_scan_level();
+	for (size = 0; size <= DATA_SIZE; size++) {
+		rn_buffer_reset(enc);
+		rn_buffer_reset(dec);
+		rn_buffer_reset(ref);
+		rn_buffer_static(&src, data, size);
+		XTEST((mode == RN_B64_STD ? rn_buffer_b64encode(enc, &src) : rn_buffer_b64urlencode(enc, &src)) == 0);
+		/* Scalar encoding is the reference */
+		rn_scan_setlevel(RN_SCAN_SCALAR);
+		XTEST((mode == RN_B64_STD ? rn_buffer_b64encode(ref, &src) : rn_buffer_b64urlencode(ref, &src)) == 0);
+		rn_scan_setlevel(level);
+		XTEST(rn_buffer_cmp(enc, ref) == 0);
+		XTEST((mode == RN_B64_STD ? rn_buffer_b64decode(dec, enc) : rn_buffer_b64urldecode(dec, enc)) == 0);
+		XTEST(rn_buffer_size(dec) == size);
+		XTEST(memcmp(rn_buffer_ptr(dec), data, size) == 0);
+	}
+	/* Any invalid character is detected, wherever it is */
+	rn_buffer_static(&src, data, DATA_SIZE);
+	rn_buffer_reset(enc);
+	XTEST((mode == RN_B64_STD ? rn_buffer_b64encode(enc, &src) : rn_buffer_b64urlencode(enc, &src)) == 0);
+	for (i = 0; i < rn_buffer_size(enc); i += 7) {
+		char saved = ((char *) rn_buffer_ptr(enc))[i];
+		const char *invalid = (mode == RN_B64_STD ? "-_ .\n\x80\xff" : "+/ .\n\x80\xff");
+
+		for (; *invalid != 0; invalid++) {
+			((char *) rn_buffer_ptr(enc))[i] = *invalid;
+			rn_buffer_reset(dec);
+			XTEST((mode == RN_B64_STD ? rn_buffer_b64decode(dec, enc) : rn_buffer_b64urldecode(dec, enc)) == -1);
+		}
+		((char *) rn_buffer_ptr(enc))[i] = saved;
+	}
+	rn_buffer_destroy(enc);
+	rn_buffer_destroy(dec);
+	rn_buffer_destroy(ref);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_buffer_t src;
+	rn_buffer_t *dst;
+	rn_scan_level_t level;
+
+	for (level = RN_SCAN_SCALAR; level < RN_SCAN_AUTO; level++) {
+		if (rn_scan_setlevel(level) != level) {
+			continue;
+		}
+		check_vectors();
+		check_roundtrip(RN_B64_STD);
+		check_roundtrip(RN_B64_URL);
+	}
+	rn_scan_setlevel(RN_SCAN_AUTO);
+	dst = rn_buffer_create(NULL);
+	XTEST(dst != NULL);
+	/* Padding is optional but must be complete */
+	rn_buffer_set(&src, "dGVzdA");
+	XTEST(rn_buffer_b64decode(dst, &src) == 0);
+	XTEST(rn_buffer_strcmp(dst, "test") == 0);
+	rn_buffer_reset(dst);
+	rn_buffer_set(&src, "dGVzdA=");
+	XTEST(rn_buffer_b64decode(dst, &src) == -1);
+	rn_buffer_set(&src, "dGVzd===");
+	XTEST(rn_buffer_b64decode(dst, &src) == -1);
+	rn_buffer_set(&src, "dGVzd");
+	XTEST(rn_buffer_b64decode(dst, &src) == -1);
+	rn_buffer_set(&src, "_-8");
+	XTEST(rn_buffer_b64urldecode(dst, &src) == 0);
+	XTEST(rn_buffer_size(dst) == 2);
+	XTEST(memcmp(rn_buffer_ptr(dst), "\xff\xef", 2) == 0);
+	rn_buffer_destroy(dst);
+	XPASS();
+}
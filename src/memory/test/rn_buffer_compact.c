@@ -0,0 +1,81 @@
+/**
+ * @file   rn_buffer_compact.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_compact unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	void *start;
+	size_t msize;
+	rn_buffer_t *buffer;
+	rn_buffer_t sbuffer;
+
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	start = buffer->ptr;
+	msize = buffer->msize;
+	XTEST(rn_buffer_addstr(buffer, "line1\nline2\nline3\n") == 18);
+	/* Erase only moves the buffer start */
+	XTEST(rn_buffer_erase(buffer, 6) == 0);
+	XTEST(buffer->ptr == start + 6);
+	XTEST(buffer->offset == 6);
+	XTEST(buffer->size == 12);
+	XTEST(buffer->msize == msize - 6);
+	XTEST(rn_buffer_strncmp(buffer, "line2\n", 6) == 0);
+	XTEST(rn_buffer_erase(buffer, 6) == 0);
+	XTEST(buffer->ptr == start + 12);
+	XTEST(rn_buffer_strcmp(buffer, "line3\n") == 0);
+	/* Explicit compaction */
+	rn_buffer_compact(buffer);
+	XTEST(buffer->ptr == start);
+	XTEST(buffer->offset == 0);
+	XTEST(buffer->msize == msize);
+	XTEST(rn_buffer_strcmp(buffer, "line3\n") == 0);
+	/* Extending reclaims erased space first */
+	while (buffer->size < msize) {
+		XTEST(rn_buffer_add(buffer, "x", 1) == 1);
+	}
+	XTEST(buffer->msize == msize);
+	XTEST(rn_buffer_erase(buffer, 6) == 0);
+	XTEST(rn_buffer_isfull(buffer));
+	XTEST(rn_buffer_add(buffer, "y", 1) == 1);
+	XTEST(buffer->ptr == start);
+	XTEST(buffer->msize == msize);
+	XTEST(buffer->size == msize - 5);
+	XTEST(((char *) buffer->ptr)[buffer->size - 1] == 'y');
+	/* Exact capacity is enough once compacted */
+	XTEST(rn_buffer_erase(buffer, 1) == 0);
+	XTEST(rn_buffer_extend(buffer, msize) == 0);
+	XTEST(buffer->ptr == start);
+	XTEST(buffer->msize == msize);
+	/* Erasing everything rewinds */
+	XTEST(rn_buffer_erase(buffer, 10) == 0);
+	XTEST(rn_buffer_erase(buffer, 0) == 0);
+	XTEST(buffer->ptr == start);
+	XTEST(buffer->offset == 0);
+	XTEST(buffer->size == 0);
+	XTEST(buffer->msize == msize);
+	XTEST(rn_buffer_destroy(buffer) == 0);
+	/* Static buffers */
+	rn_buffer_set(&sbuffer, "abcdef");
+	XTEST(rn_buffer_erase(&sbuffer, 2) == 0);
+	XTEST(rn_buffer_strcmp(&sbuffer, "cdef") == 0);
+	XTEST(sbuffer.msize == 0);
+	XTEST(rn_buffer_add(&sbuffer, "g", 1) == -1);
+	rn_buffer_reset(&sbuffer);
+	XTEST(strcmp(sbuffer.ptr, "abcdef") == 0);
+	XPASS();
+}
@@ -0,0 +1,86 @@
+/**
+ * @file   rn_buffer_hex.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_hexencode/rn_buffer_hexdecode unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define DATA_SIZE	200
+
+static void check(void)
+{
+	size_t i;
+	size_t size;
+	rn_buffer_t src;
+	rn_buffer_t *enc;
+	rn_buffer_t *dec;
+	unsigned char data[DATA_SIZE];
+	const char *invalid = "gG/:@`\x80 ";
+
+	for (i = 0; i < DATA_SIZE; i++) {
+		data[i] = (i * 167 + 13) & 0xff;
+	}
+	enc = rn_buffer_create(NULL);
+	dec = rn_buffer_create(NULL);
+	XTEST(enc != NULL);
+	XTEST(dec != NULL);
+	for (size = 0; size <= DATA_SIZE; size++) {
+		rn_buffer_reset(enc);
+		rn_buffer_reset(dec);
+		rn_buffer_static(&src, data, size);
+		XTEST(rn_buffer_hexencode(enc, &src) == 0);
+		XTEST(rn_buffer_size(enc) == size * 2);
+		for (i = 0; i < size; i++) {
+			XTEST(((char *) rn_buffer_ptr(enc))[i * 2] == "0123456789abcdef"[data[i] >> 4]);
+			XTEST(((char *) rn_buffer_ptr(enc))[i * 2 + 1] == "0123456789abcdef"[data[i] & 0x0f]);
+		}
+		XTEST(rn_buffer_hexdecode(dec, enc) == 0);
+		XTEST(rn_buffer_size(dec) == size);
+		XTEST(memcmp(rn_buffer_ptr(dec), data, size) == 0);
+	}
+	/* Uppercase digits are accepted */
+	for (i = 0; i < rn_buffer_size(enc); i++) {
+		((char *) rn_buffer_ptr(enc))[i] = toupper(((char *) rn_buffer_ptr(enc))[i]);
+	}
+	rn_buffer_reset(dec);
+	XTEST(rn_buffer_hexdecode(dec, enc) == 0);
+	XTEST(memcmp(rn_buffer_ptr(dec), data, DATA_SIZE) == 0);
+	/* Any invalid character is detected, wherever it is */
+	for (i = 0; i < rn_buffer_size(enc); i += 3) {
+		char saved = ((char *) rn_buffer_ptr(enc))[i];
+
+		((char *) rn_buffer_ptr(enc))[i] = invalid[i % strlen(invalid)];
+		rn_buffer_reset(dec);
+		XTEST(rn_buffer_hexdecode(dec, enc) == -1);
+		((char *) rn_buffer_ptr(enc))[i] = saved;
+	}
+	rn_buffer_setsize(enc, 3);
+	XTEST(rn_buffer_hexdecode(dec, enc) == -1);
+	rn_buffer_destroy(enc);
+	rn_buffer_destroy(dec);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_scan_level_t level;
+
+	for (level = RN_SCAN_SCALAR; level < RN_SCAN_AUTO; level++) {
+		if (rn_scan_setlevel(level) != level) {
+			continue;
+		}
+		check();
+	}
+	rn_scan_setlevel(RN_SCAN_AUTO);
+	XPASS();
+}
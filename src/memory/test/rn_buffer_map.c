@@ -0,0 +1,100 @@
+/**
+ * @file   rn_buffer_map.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Mapped buffer class unit test
+ *
+ *
+ */
+
+#include <unistd.h>
+#include "rinoo/rinoo.h"
+
+#define CHUNK_SIZE	4096
+#define DATA_SIZE	(32 * 1024 * 1024)
+
+static size_t resident(void)
+{
+	FILE *fp;
+	unsigned long size;
+	unsigned long pages;
+
+	fp = fopen("/proc/self/statm", "r");
+	XTEST(fp != NULL);
+	XTEST(fscanf(fp, "%lu %lu", &size, &pages) == 2);
+	fclose(fp);
+	return pages * sysconf(_SC_PAGESIZE);
+}
+
+static void fill(rn_buffer_t *buffer, size_t size)
+{
+	size_t i;
+	char chunk[CHUNK_SIZE];
+
+	for (i = 0; i < size; i += CHUNK_SIZE) {
+		memset(chunk, (i / CHUNK_SIZE) & 0xff, CHUNK_SIZE);
+		XTEST(rn_buffer_add(buffer, chunk, CHUNK_SIZE) == CHUNK_SIZE);
+	}
+}
+
+static void check(rn_buffer_t *buffer, size_t from, size_t size)
+{
+	size_t i;
+
+	XTEST(rn_buffer_size(buffer) == size - from);
+	for (i = from; i < size; i += CHUNK_SIZE / 2) {
+		XTEST(((unsigned char *) rn_buffer_ptr(buffer))[i - from] == ((i / CHUNK_SIZE) & 0xff));
+	}
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t before;
+	rn_buffer_t *buffer;
+
+	/* Default buffers switch to mapped memory past the threshold */
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(!rn_buffer_ismapped(buffer));
+	fill(buffer, RN_BUFFER_MAP_THRESHOLD / 2);
+	XTEST(!rn_buffer_ismapped(buffer));
+	fill(buffer, RN_BUFFER_MAP_THRESHOLD);
+	XTEST(rn_buffer_ismapped(buffer));
+	XTEST(rn_buffer_size(buffer) == RN_BUFFER_MAP_THRESHOLD / 2 + RN_BUFFER_MAP_THRESHOLD);
+	rn_buffer_setsize(buffer, RN_BUFFER_MAP_THRESHOLD / 2);
+	check(buffer, 0, RN_BUFFER_MAP_THRESHOLD / 2);
+	rn_buffer_reset(buffer);
+	fill(buffer, DATA_SIZE);
+	check(buffer, 0, DATA_SIZE);
+	/* Erased data is reclaimed before growing */
+	XTEST(rn_buffer_erase(buffer, CHUNK_SIZE * 3) == 0);
+	check(buffer, CHUNK_SIZE * 3, DATA_SIZE);
+	fill(buffer, CHUNK_SIZE * 3);
+	XTEST(rn_buffer_size(buffer) == DATA_SIZE);
+	/* Reset gives memory back */
+	before = resident();
+	rn_buffer_reset(buffer);
+	XTEST(rn_buffer_size(buffer) == 0);
+	XTEST(resident() + DATA_SIZE / 2 < before);
+	fill(buffer, DATA_SIZE);
+	check(buffer, 0, DATA_SIZE);
+	XTEST(rn_buffer_destroy(buffer) == 0);
+	/* Explicit mapped buffers, with huge pages */
+	rn_buffer_map_sethugepage(true);
+	buffer = rn_buffer_create(rn_buffer_map_class());
+	XTEST(buffer != NULL);
+	XTEST(rn_buffer_ismapped(buffer));
+	XTEST(rn_buffer_msize(buffer) == RN_BUFFER_MAP_THRESHOLD);
+	fill(buffer, DATA_SIZE);
+	check(buffer, 0, DATA_SIZE);
+	XTEST(rn_buffer_destroy(buffer) == 0);
+	rn_buffer_map_sethugepage(false);
+	XPASS();
+}
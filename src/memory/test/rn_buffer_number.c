@@ -0,0 +1,177 @@
+/**
+ * @file   rn_buffer_number.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_addu64/addi64/adddouble and bounded parsers unit test
+ *
+ *
+ */
+
+#include <limits.h>
+#include "rinoo/rinoo.h"
+
+#define NB_RANDOM	100000
+
+static void check_u64(rn_buffer_t *buffer, uint64_t value)
+{
+	size_t len;
+	char tmp[32];
+
+	rn_buffer_reset(buffer);
+	snprintf(tmp, sizeof(tmp), "%lu", (unsigned long) value);
+	XTEST(rn_buffer_addu64(buffer, value) == (int) strlen(tmp));
+	XTEST(rn_buffer_strcmp(buffer, tmp) == 0);
+	XTEST(rn_buffer_tou64(buffer, &len) == value);
+	XTEST(len == rn_buffer_size(buffer));
+}
+
+static void check_i64(rn_buffer_t *buffer, int64_t value)
+{
+	size_t len;
+	char tmp[32];
+
+	rn_buffer_reset(buffer);
+	snprintf(tmp, sizeof(tmp), "%ld", (long) value);
+	XTEST(rn_buffer_addi64(buffer, value) == (int) strlen(tmp));
+	XTEST(rn_buffer_strcmp(buffer, tmp) == 0);
+	XTEST(rn_buffer_toi64(buffer, &len) == value);
+	XTEST(len == rn_buffer_size(buffer));
+	XTEST(rn_buffer_tolong(buffer, &len, 10) == value);
+	XTEST(len == rn_buffer_size(buffer));
+}
+
+static void check_double(rn_buffer_t *buffer, double value, const char *expected)
+{
+	size_t len;
+	double result;
+
+	rn_buffer_reset(buffer);
+	XTEST(rn_buffer_adddouble(buffer, value) > 0);
+	if (expected != NULL) {
+		XTEST(rn_buffer_strcmp(buffer, expected) == 0);
+	}
+	result = rn_buffer_todouble(buffer, &len);
+	XTEST(len == rn_buffer_size(buffer));
+	XTEST(memcmp(&result, &value, sizeof(value)) == 0);
+	XTEST(rn_buffer_tostr(buffer) != NULL);
+	XTEST(strtod(rn_buffer_ptr(buffer), NULL) == value);
+}
+
+static uint64_t random64(void)
+{
+	return ((uint64_t) random() << 62) ^ ((uint64_t) random() << 31) ^ (uint64_t) random();
+}
+
+static void check_bounded(void)
+{
+	size_t len;
+	rn_buffer_t buffer;
+	unsigned long int ul;
+
+	/* Parsers must stop at the buffer size */
+	rn_buffer_static(&buffer, "123456", 3);
+	XTEST(rn_buffer_tou64(&buffer, &len) == 123 && len == 3);
+	XTEST(rn_buffer_toi64(&buffer, &len) == 123 && len == 3);
+	XTEST(rn_buffer_tolong(&buffer, &len, 0) == 123 && len == 3);
+	XTEST(rn_buffer_toulong(&buffer, &len, 0) == 123 && len == 3);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 123 && len == 3);
+	XTEST(rn_buffer_tofloat(&buffer, &len) == 123 && len == 3);
+	rn_buffer_static(&buffer, "1.2345e10", 4);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 1.23 && len == 4);
+	rn_buffer_static(&buffer, "1.2345e10", 7);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 1.2345 && len == 6);
+	/* strtol-like prefixes */
+	rn_buffer_static(&buffer, "  -0x1fz", 8);
+	XTEST(rn_buffer_tolong(&buffer, &len, 0) == -31 && len == 7);
+	rn_buffer_static(&buffer, "0x", 2);
+	XTEST(rn_buffer_tolong(&buffer, &len, 16) == 0 && len == 1);
+	rn_buffer_static(&buffer, "0755", 4);
+	XTEST(rn_buffer_toulong(&buffer, &len, 0) == 0755 && len == 4);
+	rn_buffer_static(&buffer, "zz", 2);
+	XTEST(rn_buffer_toulong(&buffer, &len, 36) == 35 * 36 + 35 && len == 2);
+	rn_buffer_static(&buffer, "abc", 3);
+	XTEST(rn_buffer_tolong(&buffer, &len, 10) == 0 && len == 0);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 0 && len == 0);
+	XTEST(rn_buffer_tou64(&buffer, &len) == 0 && len == 0);
+	/* Overflows */
+	rn_buffer_static(&buffer, "18446744073709551616", 20);
+	XTEST(rn_buffer_tou64(&buffer, &len) == UINT64_MAX && len == 0);
+	rn_buffer_static(&buffer, "18446744073709551615", 20);
+	XTEST(rn_buffer_tou64(&buffer, &len) == UINT64_MAX && len == 20);
+	rn_buffer_static(&buffer, "-9223372036854775808", 20);
+	XTEST(rn_buffer_toi64(&buffer, &len) == INT64_MIN && len == 20);
+	rn_buffer_static(&buffer, "9223372036854775808", 19);
+	XTEST(rn_buffer_toi64(&buffer, &len) == INT64_MAX && len == 0);
+	XTEST(rn_buffer_tolong(&buffer, &len, 10) == LONG_MAX && len == 19);
+	rn_buffer_static(&buffer, "-99999999999999999999999", 24);
+	XTEST(rn_buffer_tolong(&buffer, &len, 10) == LONG_MIN && len == 24);
+	ul = rn_buffer_toulong(&buffer, &len, 10);
+	XTEST(ul == ULONG_MAX && len == 24);
+	/* Special values and long numbers go through strtod */
+	rn_buffer_static(&buffer, "-inf", 4);
+	XTEST(rn_buffer_todouble(&buffer, &len) == -__builtin_inf() && len == 4);
+	rn_buffer_static(&buffer, "0x1p4", 5);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 16 && len == 5);
+	rn_buffer_static(&buffer, "0.30000000000000004441", 22);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 0.30000000000000004441 && len == 22);
+	rn_buffer_static(&buffer, "1e-320", 6);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 1e-320 && len == 6);
+	rn_buffer_static(&buffer, "5e", 2);
+	XTEST(rn_buffer_todouble(&buffer, &len) == 5 && len == 1);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	double value;
+	uint64_t bits;
+	rn_buffer_t *buffer;
+
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	check_u64(buffer, 0);
+	check_u64(buffer, 9);
+	check_u64(buffer, 10);
+	check_u64(buffer, 99);
+	check_u64(buffer, 100);
+	check_u64(buffer, UINT64_MAX);
+	check_i64(buffer, 0);
+	check_i64(buffer, -1);
+	check_i64(buffer, INT64_MIN);
+	check_i64(buffer, INT64_MAX);
+	for (i = 0; i < NB_RANDOM; i++) {
+		bits = random64();
+		check_u64(buffer, bits >> (i % 64));
+		check_i64(buffer, (int64_t) (bits >> (i % 64)));
+	}
+	check_double(buffer, 0, "0");
+	check_double(buffer, -0.0, "-0");
+	check_double(buffer, 1, "1");
+	check_double(buffer, 0.1, "0.1");
+	check_double(buffer, -1.5, "-1.5");
+	check_double(buffer, 123.456, "123.456");
+	check_double(buffer, 1e-7, "0.0000001");
+	check_double(buffer, 0.1 + 0.2, "0.30000000000000004");
+	check_double(buffer, 1e300, "1e+300");
+	check_double(buffer, 5e-324, NULL);
+	check_double(buffer, 1.7976931348623157e308, NULL);
+	for (i = 0; i < NB_RANDOM; i++) {
+		bits = random64();
+		memcpy(&value, &bits, sizeof(value));
+		if (__builtin_isnan(value) || __builtin_isinf(value)) {
+			continue;
+		}
+		check_double(buffer, value, NULL);
+		check_double(buffer, (double) (bits % 1000000) / 1000, NULL);
+	}
+	rn_buffer_destroy(buffer);
+	check_bounded();
+	XPASS();
+}
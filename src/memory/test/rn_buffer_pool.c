@@ -0,0 +1,84 @@
+/**
+ * @file   rn_buffer_pool.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_pool unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	void *ptr;
+	rn_buffer_t *buffer;
+	rn_buffer_t *buffer2;
+	rn_buffer_pool_t pool;
+
+	XTEST(rn_buffer_pool(&pool) == 0);
+	buffer = rn_buffer_pool_get(&pool);
+	XTEST(buffer != NULL);
+	XTEST(buffer->ptr != NULL);
+	XTEST(buffer->size == 0);
+	XTEST(buffer->msize == RN_BUFFER_HELPER_INISIZE);
+	XTEST(buffer->class == &pool.class);
+	XTEST(pool.nbused == 1);
+	/* Growth goes through power-of-two classes */
+	for (i = 0; i < 300; i++) {
+		XTEST(rn_buffer_add(buffer, "0123456789", 10) == 10);
+	}
+	XTEST(buffer->size == 3000);
+	XTEST(buffer->msize == 4096);
+	XTEST(pool.nbfree[0] == 1);
+	XTEST(pool.nbfree[1] == 1);
+	XTEST(memcmp(buffer->ptr + 2990, "0123456789", 10) == 0);
+	XTEST(pool.nbused == 1);
+	/* Detached buffer is reused with its memory */
+	ptr = pool.free[0];
+	rn_buffer_pool_put(buffer);
+	XTEST(pool.nbbuffers == 1);
+	XTEST(pool.nbfree[2] == 1);
+	XTEST(pool.nbused == 0);
+	buffer2 = rn_buffer_pool_get(&pool);
+	XTEST(buffer2 == buffer);
+	XTEST(buffer2->ptr == ptr);
+	XTEST(buffer2->size == 0);
+	XTEST(pool.nbbuffers == 0);
+	XTEST(pool.nbfree[0] == 0);
+	/* Released buffers hold no memory until data is added */
+	rn_buffer_pool_release(buffer2);
+	XTEST(buffer2->ptr == NULL);
+	XTEST(buffer2->msize == 0);
+	XTEST(pool.nbfree[0] == 1);
+	XTEST(pool.nbused == 0);
+	XTEST(rn_buffer_addstr(buffer2, "test") == 4);
+	XTEST(buffer2->ptr == ptr);
+	XTEST(buffer2->msize == RN_BUFFER_HELPER_INISIZE);
+	/* Big buffers are not pooled */
+	for (i = 0; i < (int) (RN_BUFFER_POOL_MAXSIZE / 1000) + 1; i++) {
+		XTEST(rn_buffer_add(buffer2, (char *) &pool, 1000) == 1000);
+	}
+	XTEST(buffer2->msize > RN_BUFFER_POOL_MAXSIZE);
+	XTEST(pool.nbused == 1);
+	XTEST(rn_buffer_destroy(buffer2) == 0);
+	XTEST(pool.nbused == 0);
+	/* Non pooled buffers are destroyed */
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	rn_buffer_pool_put(buffer);
+	XTEST(pool.nbbuffers == 0);
+	rn_buffer_pool_destroy(&pool);
+	for (i = 0; i < RN_BUFFER_POOL_NB_CLASSES; i++) {
+		XTEST(pool.free[i] == NULL);
+	}
+	XPASS();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file   rn_buffer_shared.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_buffer_shared unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_buffer_t *ref;
+	rn_buffer_t *dup;
+	rn_buffer_t *slice;
+	rn_buffer_t *buffer;
+	rn_buffer_t sbuffer;
+	rn_allocator_stats_t stats = { 0 };
+
+	rn_allocator_stats_set(&stats);
+	buffer = rn_buffer_shared("Hello shared world", 18);
+	XTEST(buffer != NULL);
+	XTEST(rn_buffer_isshared(buffer));
+	XTEST(rn_buffer_refcount(buffer) == 1);
+	XTEST(rn_buffer_strcmp(buffer, "Hello shared world") == 0);
+	/* References point to the same data */
+	ref = rn_buffer_ref(buffer);
+	XTEST(ref != NULL);
+	XTEST(rn_buffer_ptr(ref) == rn_buffer_ptr(buffer));
+	XTEST(rn_buffer_refcount(buffer) == 2);
+	dup = rn_buffer_dup(buffer);
+	XTEST(dup != NULL);
+	XTEST(rn_buffer_ptr(dup) == rn_buffer_ptr(buffer));
+	XTEST(rn_buffer_refcount(buffer) == 3);
+	/* Slices of slices */
+	slice = rn_buffer_slice(ref, 6, 12);
+	XTEST(slice != NULL);
+	XTEST(rn_buffer_strcmp(slice, "shared world") == 0);
+	XTEST(rn_buffer_slice(slice, 7, 6) == NULL);
+	rn_buffer_unref(ref);
+	ref = rn_buffer_slice(slice, 7, 5);
+	XTEST(ref != NULL);
+	XTEST(rn_buffer_strcmp(ref, "world") == 0);
+	XTEST(rn_buffer_refcount(buffer) == 4);
+	/* Shared buffers are immutable */
+	XTEST(rn_buffer_add(ref, "!", 1) == -1);
+	rn_buffer_compact(slice);
+	XTEST(rn_buffer_erase(slice, 7) == 0);
+	XTEST(rn_buffer_strcmp(slice, "world") == 0);
+	rn_buffer_set(&sbuffer, "static");
+	XTEST(!rn_buffer_isshared(&sbuffer));
+	XTEST(rn_buffer_ref(&sbuffer) == NULL);
+	/* Memory is released with the last reference */
+	rn_buffer_unref(buffer);
+	rn_buffer_unref(dup);
+	rn_buffer_unref(slice);
+	XTEST(stats.nballoc > stats.nbfree);
+	XTEST(rn_buffer_refcount(ref) == 1);
+	rn_buffer_unref(ref);
+	XTEST(stats.nballoc == stats.nbfree);
+	rn_allocator_stats_set(NULL);
+	XPASS();
+}
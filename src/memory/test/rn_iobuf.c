@@ -0,0 +1,82 @@
+/**
+ * @file   rn_iobuf.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_iobuf unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define DATA_SIZE	(RN_IOBUF_SEGSIZE * 3 + 42)
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int count;
+	size_t i;
+	char *data;
+	rn_iobuf_t iobuf;
+	rn_iobuf_seg_t *seg;
+	rn_iobuf_seg_t *head;
+	rn_buffer_t *buffer;
+	rn_buffer_t views[8];
+
+	data = malloc(DATA_SIZE);
+	XTEST(data != NULL);
+	for (i = 0; i < DATA_SIZE; i++) {
+		data[i] = 'a' + (i % 26);
+	}
+	XTEST(rn_iobuf(&iobuf) == 0);
+	XTEST(rn_iobuf_size(&iobuf) == 0);
+	/* Small adds fill the last segment */
+	XTEST(rn_iobuf_add(&iobuf, data, 10) == 0);
+	head = iobuf.head;
+	XTEST(rn_iobuf_add(&iobuf, data + 10, DATA_SIZE - 10) == 0);
+	XTEST(rn_iobuf_size(&iobuf) == DATA_SIZE);
+	XTEST(iobuf.nbsegs == 4);
+	/* Existing data never moves */
+	XTEST(iobuf.head == head);
+	seg = iobuf.head;
+	count = rn_iobuf_views(&seg, views, 8);
+	XTEST(count == 4);
+	XTEST(seg == NULL);
+	for (i = 0; i < (size_t) count; i++) {
+		XTEST(rn_buffer_ptr(&views[i]) == rn_iobuf_seg_ptr(head));
+		head = head->next;
+	}
+	/* Flatten on demand */
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(rn_iobuf_flatten(&iobuf, buffer) == 0);
+	XTEST(rn_buffer_size(buffer) == DATA_SIZE);
+	XTEST(memcmp(rn_buffer_ptr(buffer), data, DATA_SIZE) == 0);
+	rn_buffer_destroy(buffer);
+	/* Erasing releases consumed segments */
+	XTEST(rn_iobuf_erase(&iobuf, RN_IOBUF_SEGSIZE) == 0);
+	XTEST(rn_iobuf_size(&iobuf) == DATA_SIZE - RN_IOBUF_SEGSIZE);
+	XTEST(iobuf.nbsegs == 3);
+	XTEST(iobuf.spare != NULL);
+	XTEST(memcmp(rn_iobuf_seg_ptr(iobuf.head), data + RN_IOBUF_SEGSIZE, rn_iobuf_seg_size(iobuf.head)) == 0);
+	/* Truncating keeps the first bytes */
+	XTEST(rn_iobuf_truncate(&iobuf, 100) == 0);
+	XTEST(rn_iobuf_size(&iobuf) == 100);
+	XTEST(iobuf.nbsegs == 1);
+	XTEST(iobuf.head == iobuf.tail);
+	XTEST(rn_iobuf_seg_size(iobuf.head) == 100);
+	XTEST(rn_iobuf_erase(&iobuf, 0) == 0);
+	XTEST(rn_iobuf_size(&iobuf) == 0);
+	XTEST(iobuf.head == NULL);
+	XTEST(iobuf.tail == NULL);
+	XTEST(iobuf.nbsegs == 0);
+	rn_iobuf_destroy(&iobuf);
+	free(data);
+	XPASS();
+}
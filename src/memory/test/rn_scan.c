@@ -0,0 +1,112 @@
+/**
+ * @file   rn_scan.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_scan unit test
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include "rinoo/rinoo.h"
+
+#define DATA_SIZE	200
+
+static int sign(int value)
+{
+	return (value > 0) - (value < 0);
+}
+
+static void check_mem(char *data)
+{
+	size_t start;
+	size_t size;
+	const char *delims[] = { "\r\n", "\r\n\r\n", "\n", "abc" };
+	size_t i;
+
+	for (i = 0; i < sizeof(delims) / sizeof(*delims); i++) {
+		for (start = 0; start < 40; start++) {
+			for (size = 0; start + size <= DATA_SIZE; size++) {
+				XTEST(rn_scan_mem(data + start, size, delims[i], strlen(delims[i])) ==
+				      memmem(data + start, size, delims[i], strlen(delims[i])));
+			}
+		}
+	}
+}
+
+static void check_set(char *data)
+{
+	size_t start;
+	size_t size;
+	size_t expected;
+	const char *sets[] = { ":", "\r\n", " \t\r\n", "?#&=;,/ \t\r\n", "0123456789abcdefghij" };
+	size_t i;
+
+	for (i = 0; i < sizeof(sets) / sizeof(*sets); i++) {
+		for (start = 0; start < 40; start++) {
+			for (size = 0; start + size <= DATA_SIZE; size++) {
+				for (expected = 0; expected < size && strchr(sets[i], data[start + expected]) == NULL; expected++);
+				XTEST(rn_scan_set(data + start, size, sets[i]) == expected);
+			}
+		}
+	}
+}
+
+static void check_casecmp(void)
+{
+	size_t i;
+	size_t size;
+	char str1[DATA_SIZE];
+	char str2[DATA_SIZE];
+
+	for (i = 0; i < DATA_SIZE; i++) {
+		str1[i] = 32 + (i % 95);
+		str2[i] = (i % 3 == 0 ? toupper(str1[i]) : tolower(str1[i]));
+	}
+	for (size = 0; size <= DATA_SIZE; size++) {
+		XTEST(rn_scan_casecmp(str1, str2, size) == 0);
+		XTEST(rn_scan_casecmp(str1, str1, size) == 0);
+	}
+	for (i = 0; i < DATA_SIZE; i++) {
+		str2[i] = str1[i] + 1;
+		for (size = i + 1; size <= DATA_SIZE; size += 17) {
+			XTEST(sign(rn_scan_casecmp(str1, str2, size)) == sign(strncasecmp(str1, str2, size)));
+		}
+		str2[i] = toupper(str1[i]);
+	}
+	/* Non ASCII bytes are not folded */
+	XTEST(rn_scan_casecmp("\xc3\xa9t\xc3\xa9", "\xc3\x89T\xc3\x89", 6) != 0);
+	XTEST(rn_scan_casecmp("@[`{", "@[`{", 4) == 0);
+	XTEST(rn_scan_casecmp("[", "{", 1) < 0);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	rn_scan_level_t level;
+	char data[DATA_SIZE];
+	const char pattern[] = "GET / HTTP/1.1\r\nHost: abc\r\n\r\nab\rc\n\n";
+
+	for (i = 0; i < DATA_SIZE; i++) {
+		data[i] = pattern[(i * 7) % (sizeof(pattern) - 1)];
+	}
+	for (level = RN_SCAN_SCALAR; level < RN_SCAN_AUTO; level++) {
+		if (rn_scan_setlevel(level) != level) {
+			rn_log("scan level %d not supported", level);
+			continue;
+		}
+		check_mem(data);
+		check_set(data);
+		check_casecmp();
+	}
+	XTEST(rn_scan_setlevel(RN_SCAN_AUTO) == rn_scan_level());
+	XPASS();
+}
@@ -0,0 +1,109 @@
+/**
+ * @file   rn_slab.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_slab unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define NB_OBJECTS	1000
+
+void *remote_free(void *ptr)
+{
+	rn_slab_free(ptr);
+	return NULL;
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	char *ptr;
+	char *big;
+	char *prev;
+	pthread_t thread;
+	rn_slab_t slab;
+	void *objects[NB_OBJECTS];
+
+	XTEST(rn_slab(&slab) == 0);
+	XTEST(slab.classes[0].size == 32);
+	XTEST(slab.classes[RN_SLAB_NB_CLASSES - 1].size == RN_SLAB_MAXSIZE);
+	/* Size classes */
+	ptr = rn_slab_alloc(&slab, 1);
+	XTEST(ptr != NULL);
+	XTEST(slab.classes[0].nbused == 1);
+	rn_slab_free(ptr);
+	XTEST(slab.classes[0].nbused == 0);
+	ptr = rn_slab_alloc(&slab, 33);
+	XTEST(ptr != NULL);
+	XTEST(slab.classes[1].nbused == 1);
+	XTEST(((uintptr_t) ptr & 15) == 0);
+	/* Freed objects get reused */
+	rn_slab_free(ptr);
+	prev = ptr;
+	ptr = rn_slab_alloc(&slab, 64);
+	XTEST(ptr == prev);
+	rn_slab_free(ptr);
+	ptr = rn_slab_calloc(&slab, RN_SLAB_MAXSIZE);
+	XTEST(ptr != NULL);
+	XTEST(ptr[0] == 0 && ptr[RN_SLAB_MAXSIZE - 1] == 0);
+	XTEST(slab.classes[RN_SLAB_NB_CLASSES - 1].nbused == 1);
+	rn_slab_free(ptr);
+	/* Big allocations and allocations without slab fall back to malloc */
+	big = rn_slab_alloc(&slab, RN_SLAB_MAXSIZE + 1);
+	XTEST(big != NULL);
+	memset(big, 'x', RN_SLAB_MAXSIZE + 1);
+	rn_slab_free(big);
+	big = rn_slab_alloc(NULL, 16);
+	XTEST(big != NULL);
+	rn_slab_free(big);
+	rn_slab_free(NULL);
+	/* Many objects span several chunks */
+	for (i = 0; i < NB_OBJECTS; i++) {
+		objects[i] = rn_slab_alloc(&slab, 200);
+		XTEST(objects[i] != NULL);
+		memset(objects[i], i & 0xff, 200);
+	}
+	XTEST(slab.classes[3].nbused == NB_OBJECTS);
+	XTEST(slab.nbchunks > 1);
+	for (i = 0; i < NB_OBJECTS; i++) {
+		XTEST(((unsigned char *) objects[i])[199] == (i & 0xff));
+		rn_slab_free(objects[i]);
+	}
+	XTEST(slab.classes[3].nbused == 0);
+	/* Objects freed by another thread go through the remote queue */
+	ptr = rn_slab_alloc(&slab, 100);
+	XTEST(ptr != NULL);
+	XTEST(pthread_create(&thread, NULL, remote_free, ptr) == 0);
+	XTEST(pthread_join(thread, NULL) == 0);
+	XTEST(slab.remote != NULL);
+	XTEST(slab.classes[2].nbused == 1);
+	rn_slab_reclaim(&slab);
+	XTEST(slab.remote == NULL);
+	XTEST(slab.classes[2].nbused == 0);
+	XTEST(slab.classes[2].free == (rn_slab_obj_t *)(ptr - RN_SLAB_HDRSIZE));
+	/* Chunks outlive the slab while objects are still allocated */
+	ptr = rn_slab_alloc(&slab, 100);
+	XTEST(ptr != NULL);
+	big = rn_slab_alloc(&slab, 1000);
+	XTEST(big != NULL);
+	rn_slab_destroy(&slab);
+	XTEST(slab.chunks == NULL);
+	XTEST(slab.nbchunks == 0);
+	/* Slab memory may be gone by now */
+	memset(&slab, 0xff, sizeof(slab));
+	memset(ptr, 'x', 100);
+	memset(big, 'x', 1000);
+	rn_slab_free(ptr);
+	rn_slab_free(big);
+	XPASS();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file   rn_socket_mmsg.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Loopback UDP packets per second, sendto/recvfrom against sendmmsg/recvmmsg
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define BENCH_PORT	4245
+
+extern const rn_socket_class_t socket_class_udp;
+
+static size_t total = 1000000;
+static size_t dgram_size = 64;
+static size_t received;
+static long long start;
+static long long end;
+static long long send_duration;
+static bool batch;
+static char *server_bufs;
+static char *client_buf;
+static rn_dgram_t server_dgrams[RN_SOCKET_MMSG_MAX];
+static rn_dgram_t client_dgrams[RN_SOCKET_MMSG_MAX];
+
+static void server_func(void *arg)
+{
+	int i;
+	int ret;
+	rn_addr_t from;
+	rn_socket_t *server = arg;
+
+	for (i = 0; i < RN_SOCKET_MMSG_MAX; i++) {
+		server_dgrams[i].buf = server_bufs + i * dgram_size;
+		server_dgrams[i].size = dgram_size;
+	}
+	/* Datagrams may be dropped, the server stops once the flow is idle */
+	while (rn_socket_timeout(server, 200) == 0) {
+		if (batch) {
+			ret = rn_socket_recvmmsg(server, server_dgrams, RN_SOCKET_MMSG_MAX);
+		} else {
+			ret = (rn_socket_recvfrom(server, server_bufs, dgram_size, &from) > 0 ? 1 : -1);
+		}
+		if (ret <= 0) {
+			break;
+		}
+		if (received == 0) {
+			start = clock_ns();
+		}
+		received += ret;
+		end = clock_ns();
+	}
+	rn_socket_destroy(server);
+}
+
+static void client_func(void *arg)
+{
+	int i;
+	size_t sent;
+	long long begin;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	socket = rn_udp_client(sched, &addr);
+	XTEST(socket != NULL);
+	for (i = 0; i < RN_SOCKET_MMSG_MAX; i++) {
+		client_dgrams[i].buf = client_buf;
+		client_dgrams[i].len = dgram_size;
+	}
+	begin = clock_ns();
+	for (sent = 0; sent < total; sent += (batch ? RN_SOCKET_MMSG_MAX : 1)) {
+		if (batch) {
+			XTEST(rn_socket_sendmmsg(socket, client_dgrams, RN_SOCKET_MMSG_MAX) == RN_SOCKET_MMSG_MAX);
+		} else {
+			XTEST(rn_socket_write(socket, client_buf, dgram_size) == (ssize_t) dgram_size);
+		}
+	}
+	send_duration = clock_ns() - begin;
+	rn_socket_destroy(socket);
+}
+
+static void bench(bool use_batch)
+{
+	rn_addr_t addr;
+	rn_sched_t *sched;
+	rn_socket_t *server;
+
+	batch = use_batch;
+	received = 0;
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	server = rn_socket(sched, &socket_class_udp);
+	XTEST(server != NULL);
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	XTEST(rn_socket_bind(server, &addr, 0) == 0);
+	XTEST(rn_task_start(sched, server_func, server) == 0);
+	/* The sender runs on its own thread, the receiver drops what it cannot keep up with */
+	XTEST(rn_spawn(sched, 1) == 0);
+	XTEST(rn_task_start(rn_spawn_get(sched, 1), client_func, rn_spawn_get(sched, 1)) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	printf("%-18s %4zu bytes: sent %.2f Mpps, received %zu/%zu at %.2f Mpps\n",
+	       (use_batch ? "sendmmsg/recvmmsg" : "write/recvfrom"), dgram_size,
+	       total / (send_duration / 1000.0), received, total, received / ((end - start) / 1000.0));
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -n datagrams -s size\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+
+	while ((ch = getopt(argc, argv, "hn:s:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'n':
+			total = atol(optarg);
+			break;
+		case 's':
+			dgram_size = atol(optarg);
+			break;
+		default:
+			break;
+		}
+	}
+	if (dgram_size < 1) {
+		dgram_size = 1;
+	}
+	server_bufs = rn_malloc(RN_SOCKET_MMSG_MAX * dgram_size);
+	client_buf = rn_malloc(dgram_size);
+	XTEST(server_bufs != NULL && client_buf != NULL);
+	memset(client_buf, 'x', dgram_size);
+	bench(false);
+	bench(true);
+	rn_free(server_bufs);
+	rn_free(client_buf);
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file   rn_socket_readline.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Line-delimited stream parsing benchmark (rn_socket_readline + rn_buffer_erase)
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define BENCH_PORT	4244
+#define BENCH_LINE	"GET /index.html HTTP/1.1 Host: localhost User-Agent: bench\n"
+#define BENCH_CHUNK	(64 * 1024)
+
+static size_t total = 100 * 1024 * 1024;
+static size_t nblines = 0;
+
+static void fill(char *chunk, size_t size)
+{
+	size_t len;
+	size_t offset;
+
+	len = strlen(BENCH_LINE);
+	for (offset = 0; offset + len <= size; offset += len) {
+		memcpy(chunk + offset, BENCH_LINE, len);
+	}
+	memset(chunk + offset, '\n', size - offset);
+}
+
+static void bench_buffer(void)
+{
+	size_t lines;
+	char *end;
+	rn_buffer_t *buffer;
+	long long start, duration;
+
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(rn_buffer_extend(buffer, total) == 0);
+	fill(buffer->ptr, total);
+	rn_buffer_setsize(buffer, total);
+	lines = 0;
+	start = clock_ns();
+	while (rn_buffer_size(buffer) > 0) {
+		end = memchr(rn_buffer_ptr(buffer), '\n', rn_buffer_size(buffer));
+		XTEST(end != NULL);
+		rn_buffer_erase(buffer, end - (char *) rn_buffer_ptr(buffer) + 1);
+		lines++;
+	}
+	duration = clock_ns() - start;
+	printf("buffer erase (%zu MB, %zu lines): %.2f ms, %.2f MB/s\n",
+		total >> 20, lines, duration / 1000000.0, (total / 1048576.0) / (duration / 1000000000.0));
+	rn_buffer_destroy(buffer);
+}
+
+static void server_func(void *arg)
+{
+	ssize_t len;
+	rn_addr_t addr;
+	rn_buffer_t *buffer;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	server = rn_tcp_server(sched, &addr, NULL);
+	XTEST(server != NULL);
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	rn_socket_destroy(server);
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	while ((len = rn_socket_readline(client, buffer, "\n", 4096)) > 0) {
+		rn_buffer_erase(buffer, len);
+		nblines++;
+	}
+	rn_buffer_destroy(buffer);
+	rn_socket_destroy(client);
+}
+
+static void client_func(void *arg)
+{
+	size_t sent;
+	char *chunk;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+
+	chunk = malloc(BENCH_CHUNK);
+	XTEST(chunk != NULL);
+	fill(chunk, BENCH_CHUNK);
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	socket = rn_tcp_client(sched, &addr, 0, NULL);
+	XTEST(socket != NULL);
+	for (sent = 0; sent < total; sent += BENCH_CHUNK) {
+		if (rn_socket_write(socket, chunk, BENCH_CHUNK) != BENCH_CHUNK) {
+			break;
+		}
+	}
+	rn_socket_destroy(socket);
+	free(chunk);
+}
+
+static void bench_socket(void)
+{
+	rn_sched_t *sched;
+	long long start, duration;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	start = clock_ns();
+	rn_scheduler_loop(sched);
+	duration = clock_ns() - start;
+	printf("socket readline (%zu MB, %zu lines): %.2f ms, %.2f MB/s\n",
+		total >> 20, nblines, duration / 1000000.0, (total / 1048576.0) / (duration / 1000000000.0));
+	rn_scheduler_destroy(sched);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -m megabytes\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+
+	while ((ch = getopt(argc, argv, "hm:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'm':
+			total = (size_t) atoi(optarg) * 1024 * 1024;
+			if (total < BENCH_CHUNK) {
+				total = BENCH_CHUNK;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	bench_buffer();
+	bench_socket();
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file   rn_ssl.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Loopback TLS throughput, write and sendfile with and without kTLS
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define BENCH_PORT	4246
+#define BENCH_CHUNK	(64 * 1024)
+
+static size_t total = 256 * 1024 * 1024;
+static size_t received;
+static bool use_sendfile;
+static unsigned int ktls;
+static int file_fd;
+static char *chunk;
+
+static void server_func(void *arg)
+{
+	size_t sent;
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_ssl_ctx_t *ctx = arg;
+	rn_sched_t *sched = rn_scheduler_self();
+
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	server = rn_ssl_server(sched, ctx, &addr);
+	XTEST(server != NULL);
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	rn_socket_destroy(server);
+	XTEST(rn_ssl_handshake(client) == 0);
+	ktls = rn_ssl_get(client)->flags;
+	for (sent = 0; sent < total; sent += BENCH_CHUNK) {
+		if (use_sendfile) {
+			if (rn_socket_sendfile(client, file_fd, 0, BENCH_CHUNK) != BENCH_CHUNK) {
+				break;
+			}
+		} else if (rn_socket_write(client, chunk, BENCH_CHUNK) != BENCH_CHUNK) {
+			break;
+		}
+	}
+	rn_socket_destroy(client);
+}
+
+static void client_func(void *arg)
+{
+	ssize_t ret;
+	char *buf;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_ssl_ctx_t *ctx = arg;
+
+	buf = malloc(BENCH_CHUNK);
+	XTEST(buf != NULL);
+	rn_addr4(&addr, "127.0.0.1", BENCH_PORT);
+	socket = rn_ssl_client(rn_scheduler_self(), ctx, &addr, 0);
+	XTEST(socket != NULL);
+	while ((ret = rn_socket_read(socket, buf, BENCH_CHUNK)) > 0) {
+		received += ret;
+	}
+	rn_socket_destroy(socket);
+	free(buf);
+}
+
+static void bench(rn_ssl_ctx_t *ctx, bool sendfile_mode)
+{
+	rn_sched_t *sched;
+	long long start, duration;
+
+	received = 0;
+	use_sendfile = sendfile_mode;
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, ctx) == 0);
+	XTEST(rn_task_start(sched, client_func, ctx) == 0);
+	start = clock_ns();
+	rn_scheduler_loop(sched);
+	duration = clock_ns() - start;
+	XTEST(received == total);
+	printf("%-8s (kTLS tx: %-3s rx: %-3s, %zu MB): %.2f ms, %.2f MB/s\n",
+		(sendfile_mode ? "sendfile" : "write"),
+		(ktls & RN_SSL_KTLS_TX ? "yes" : "no"),
+		(ktls & RN_SSL_KTLS_RX ? "yes" : "no"),
+		total >> 20, duration / 1000000.0, (total / 1048576.0) / (duration / 1000000000.0));
+	rn_scheduler_destroy(sched);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -m megabytes\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	char path[] = "/tmp/bench_ssl.XXXXXX";
+	rn_ssl_ctx_t *ctx;
+
+	while ((ch = getopt(argc, argv, "hm:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'm':
+			total = (size_t) atoi(optarg) * 1024 * 1024;
+			if (total < BENCH_CHUNK) {
+				total = BENCH_CHUNK;
+			}
+			total -= total % BENCH_CHUNK;
+			break;
+		default:
+			break;
+		}
+	}
+	chunk = malloc(BENCH_CHUNK);
+	XTEST(chunk != NULL);
+	memset(chunk, 'x', BENCH_CHUNK);
+	file_fd = mkstemp(path);
+	XTEST(file_fd >= 0);
+	unlink(path);
+	XTEST(write(file_fd, chunk, BENCH_CHUNK) == BENCH_CHUNK);
+	rn_ssl_init();
+	ctx = rn_ssl_context(2048);
+	XTEST(ctx != NULL);
+	bench(ctx, false);
+	bench(ctx, true);
+#ifdef SSL_OP_ENABLE_KTLS
+	/* Same runs with OpenSSL doing the encryption */
+	SSL_CTX_clear_options(ctx->ctx, SSL_OP_ENABLE_KTLS);
+	bench(ctx, false);
+	bench(ctx, true);
+#endif /* SSL_OP_ENABLE_KTLS */
+	rn_ssl_context_destroy(ctx);
+	close(file_fd);
+	free(chunk);
+	XPASS();
+	return 0;
+}
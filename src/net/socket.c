@@ -120,6 +120,7 @@ rn_socket_t *rn_socket_dup(rn_sched_t *destination, rn_socket_t *socket)
 		return NULL;
 	}
 	new->node.sched = destination;
+	new->flags = socket->flags;
 	return new;
 }
 
@@ -163,6 +164,28 @@ int rn_socket_waitin(rn_socket_t *socket)
 	return rn_scheduler_waitfor(&socket->node, RN_MODE_IN);
 }
 
+/**
+ * Waits for incoming data on a socket without reading it.
+ * Returns immediately if data is already pending.
+ *
+ * @param socket Pointer to the socket to wait for
+ *
+ * @return 0 on success or -1 if an error occurs (timeout is considered as error)
+ */
+int rn_socket_waitdata(rn_socket_t *socket)
+{
+	char c;
+
+	if (socket->class->pending != NULL && socket->class->pending(socket)) {
+		return 0;
+	}
+	if (recv(socket->node.fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) >= 0 || errno != EAGAIN) {
+		/* Data, end of stream or error are reported by the next read */
+		return 0;
+	}
+	return rn_socket_waitin(socket);
+}
+
 /**
  * Releases socket execution and waits for the socket to be available for write operations.
  *
@@ -179,6 +202,7 @@ int rn_socket_waitout(rn_socket_t *socket)
 /**
  * Increments internal io counter and releases the socket if too many io operations
  * have been done consecutively.
+ * It also fails if the current task deadline expired or if the task has been cancelled.
  *
  * @param socket Pointer to the socket to wait for
  *
@@ -186,6 +210,9 @@ int rn_socket_waitout(rn_socket_t *socket)
  */
 int rn_socket_waitio(rn_socket_t *socket)
 {
+	if (unlikely(rn_task_check(rn_task_driver_getcurrent(socket->node.sched)) != 0)) {
+		return -1;
+	}
 	socket->io_calls++;
 	if (socket->io_calls > MAX_IO_CALLS) {
 		socket->io_calls = 0;
@@ -220,6 +247,115 @@ int rn_socket_timeout(rn_socket_t *socket, uint32_t ms)
 	return rn_task_schedule(rn_task_driver_getcurrent(socket->node.sched), &res);
 }
 
+/**
+ * Sets an integer socket option.
+ *
+ * @param socket Socket pointer
+ * @param level Option level
+ * @param name Option name
+ * @param value Option value
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+static int rn_socket_setint(rn_socket_t *socket, int level, int name, int value)
+{
+	if (setsockopt(socket->node.fd, level, name, &value, sizeof(value)) != 0) {
+		rn_error_set(errno);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * Applies socket options. Zero fields are left to the system default.
+ * Listening sockets get TCP_FASTOPEN with the given queue length and
+ * TCP_DEFER_ACCEPT; other sockets get TCP_FASTOPEN_CONNECT, which must
+ * be set before connecting. Options set on a listening socket are
+ * inherited by accepted sockets.
+ *
+ * @param socket Socket pointer
+ * @param opts Options to apply
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_socket_setopt(rn_socket_t *socket, const rn_socket_opts_t *opts)
+{
+	int listening;
+	socklen_t size;
+
+	XASSERT(socket != NULL, -1);
+	XASSERT(opts != NULL, -1);
+
+	size = sizeof(listening);
+	if (getsockopt(socket->node.fd, SOL_SOCKET, SO_ACCEPTCONN, &listening, &size) != 0) {
+		rn_error_set(errno);
+		return -1;
+	}
+	if (opts->nodelay && rn_socket_setint(socket, IPPROTO_TCP, TCP_NODELAY, 1) != 0) {
+		return -1;
+	}
+	if (opts->cork) {
+		if (rn_socket_setint(socket, IPPROTO_TCP, TCP_CORK, 1) != 0) {
+			return -1;
+		}
+		socket->flags |= RN_SOCKET_CORKED;
+	}
+	if (opts->keepalive) {
+		if (rn_socket_setint(socket, SOL_SOCKET, SO_KEEPALIVE, 1) != 0 ||
+		    (opts->keepidle > 0 && rn_socket_setint(socket, IPPROTO_TCP, TCP_KEEPIDLE, opts->keepidle) != 0) ||
+		    (opts->keepintvl > 0 && rn_socket_setint(socket, IPPROTO_TCP, TCP_KEEPINTVL, opts->keepintvl) != 0) ||
+		    (opts->keepcnt > 0 && rn_socket_setint(socket, IPPROTO_TCP, TCP_KEEPCNT, opts->keepcnt) != 0)) {
+			return -1;
+		}
+	}
+	if (opts->fastopen > 0) {
+		if (listening) {
+			if (rn_socket_setint(socket, IPPROTO_TCP, TCP_FASTOPEN, opts->fastopen) != 0) {
+				return -1;
+			}
+		} else if (rn_socket_setint(socket, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, 1) != 0) {
+			return -1;
+		}
+	}
+	if (opts->defer_accept > 0 && listening &&
+	    rn_socket_setint(socket, IPPROTO_TCP, TCP_DEFER_ACCEPT, opts->defer_accept) != 0) {
+		return -1;
+	}
+	if (opts->notsent_lowat > 0 && rn_socket_setint(socket, IPPROTO_TCP, TCP_NOTSENT_LOWAT, opts->notsent_lowat) != 0) {
+		return -1;
+	}
+	if (opts->sndbuf > 0 && rn_socket_setint(socket, SOL_SOCKET, SO_SNDBUF, opts->sndbuf) != 0) {
+		return -1;
+	}
+	if (opts->rcvbuf > 0 && rn_socket_setint(socket, SOL_SOCKET, SO_RCVBUF, opts->rcvbuf) != 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * Pushes pending data out of a corked socket.
+ * The socket is uncorked then corked again, so that the partial frame
+ * left by the last write is sent now. Does nothing on other sockets.
+ *
+ * @param socket Socket pointer
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_socket_flush(rn_socket_t *socket)
+{
+	XASSERT(socket != NULL, -1);
+
+	if ((socket->flags & RN_SOCKET_CORKED) == 0) {
+		return 0;
+	}
+	if (rn_socket_setint(socket, IPPROTO_TCP, TCP_CORK, 0) != 0 ||
+	    rn_socket_setint(socket, IPPROTO_TCP, TCP_CORK, 1) != 0) {
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * Connects a socket if possible by socket class.
  *
@@ -283,6 +419,32 @@ ssize_t rn_socket_read(rn_socket_t *socket, void *buf, size_t count)
 	return socket->class->read(socket, buf, count);
 }
 
+/**
+ * Calls the appropriate readv function depending on socket class.
+ * If the socket class does not provide readv, data is read in the first non-empty area.
+ *
+ * @param socket Pointer to the socket to read
+ * @param iov Array of areas where to store the information read
+ * @param count Array size
+ *
+ * @return The number of bytes read on success or -1 if an error occurs
+ */
+ssize_t rn_socket_readv(rn_socket_t *socket, const struct iovec *iov, int count)
+{
+	int i;
+
+	if (socket->class->readv != NULL) {
+		return socket->class->readv(socket, iov, count);
+	}
+	for (i = 0; i < count; i++) {
+		if (iov[i].iov_len > 0) {
+			return socket->class->read(socket, iov[i].iov_base, iov[i].iov_len);
+		}
+	}
+	rn_error_set(EINVAL);
+	return -1;
+}
+
 /**
  * Calls the appropriate recvfrom function depending on socket class.
  *
@@ -300,6 +462,25 @@ ssize_t rn_socket_recvfrom(rn_socket_t *socket, void *buf, size_t count, rn_addr
 	return socket->class->recvfrom(socket, buf, count, from);
 }
 
+/**
+ * Calls the appropriate recvmmsg function depending on socket class.
+ * Receives at least one datagram, and as many as available up to count,
+ * in a single call. For each datagram, buf and size must be set; len,
+ * addr, segment and truncated are filled in.
+ *
+ * @param socket Pointer to the socket to read
+ * @param dgrams Array of datagrams
+ * @param count Array size
+ *
+ * @return The number of datagrams received on success or -1 if an error occurs
+ */
+int rn_socket_recvmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count)
+{
+	XASSERT(socket->class->recvmmsg != NULL, -1);
+
+	return socket->class->recvmmsg(socket, dgrams, count);
+}
+
 /**
  * Calls the appropriate function depending on socket class.
  *
@@ -361,6 +542,27 @@ ssize_t rn_socket_sendto(rn_socket_t *socket, void *buf, size_t count, const rn_
 	return socket->class->sendto(socket, buf, count, dst);
 }
 
+/**
+ * Calls the appropriate sendmmsg function depending on socket class.
+ * Sends every datagram, batching syscalls. For each datagram, buf and
+ * len must be set, addr must be set unless the socket is connected
+ * (AF_UNSPEC family), and segment is the GSO segment size or 0.
+ * If an error occurs once some datagrams went out, their number is returned
+ * and rn_error tells why the next one failed.
+ *
+ * @param socket Pointer to the socket to write
+ * @param dgrams Array of datagrams
+ * @param count Array size
+ *
+ * @return The number of datagrams sent, or -1 if an error occurs before any is sent
+ */
+int rn_socket_sendmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count)
+{
+	XASSERT(socket->class->sendmmsg != NULL, -1);
+
+	return socket->class->sendmmsg(socket, dgrams, count);
+}
+
 /**
  * Socket read interface for rn_buffer_t.
  * This function waits for and reads information available on the socket.
@@ -417,7 +619,7 @@ ssize_t rn_socket_readline(rn_socket_t *socket, rn_buffer_t *buffer, const char
 	dlen = strlen(delim);
 	while (rn_buffer_size(buffer) < maxsize) {
 		if (rn_buffer_size(buffer) - offset >= dlen) {
-			ptr = memmem(rn_buffer_ptr(buffer) + offset, rn_buffer_size(buffer) - offset, delim, dlen);
+			ptr = rn_scan_mem(rn_buffer_ptr(buffer) + offset, rn_buffer_size(buffer) - offset, delim, dlen);
 			if (ptr != NULL) {
 				return (ptr - rn_buffer_ptr(buffer) + dlen);
 			}
@@ -504,20 +706,127 @@ ssize_t rn_socket_writeb(rn_socket_t *socket, rn_buffer_t *buffer)
 ssize_t rn_socket_sendfile(rn_socket_t *socket, int in_fd, off_t offset, size_t count)
 {
 	if (unlikely(socket->class->sendfile == NULL)) {
-		void *ptr;
-		int pagesize;
-		ssize_t result;
-		rn_buffer_t dummy;
-
-		pagesize = getpagesize();
-		ptr = mmap(NULL, count + (offset % pagesize), PROT_READ, MAP_PRIVATE, in_fd, pagesize * (offset / pagesize));
-		if (ptr == MAP_FAILED) {
+		return rn_socket_sendfile_mmap(socket, in_fd, offset, count);
+	}
+	return socket->class->sendfile(socket, in_fd, offset, count);
+}
+
+/**
+ * Send a file through a socket by mapping it and writing its content.
+ * This is the fallback for socket classes which cannot use sendfile(2).
+ *
+ * @param socket Pointer to the socket to write to
+ * @param in_fd File descriptor of the file to send
+ * @param offset File offset
+ * @param count Number of bytes to send
+ *
+ * @return Number of bytes sent or -1 if an error occurs
+ */
+ssize_t rn_socket_sendfile_mmap(rn_socket_t *socket, int in_fd, off_t offset, size_t count)
+{
+	void *ptr;
+	int pagesize;
+	ssize_t result;
+	rn_buffer_t dummy;
+
+	pagesize = getpagesize();
+	ptr = mmap(NULL, count + (offset % pagesize), PROT_READ, MAP_PRIVATE, in_fd, pagesize * (offset / pagesize));
+	if (ptr == MAP_FAILED) {
+		return -1;
+	}
+	rn_buffer_static(&dummy, ptr + (offset % pagesize), count);
+	result = rn_socket_writeb(socket, &dummy);
+	munmap(ptr, count + (offset % pagesize));
+	return result;
+}
+
+/**
+ * Reads data from a socket and adds it at the end of a chained buffer.
+ * Data is read in the free space of the last segment and in a new segment
+ * with one system call, so that existing data is never moved.
+ *
+ * @param socket Pointer to the socket to read
+ * @param iobuf Pointer to the chained buffer where to store data
+ *
+ * @return The number of bytes read on success or -1 if an error occurs
+ */
+ssize_t rn_socket_readio(rn_socket_t *socket, rn_iobuf_t *iobuf)
+{
+	int count;
+	size_t len;
+	ssize_t res;
+	rn_iobuf_seg_t *seg;
+	rn_iobuf_seg_t *tail;
+	struct iovec iov[2];
+
+	seg = rn_iobuf_seg(iobuf);
+	if (seg == NULL) {
+		return -1;
+	}
+	count = 0;
+	tail = iobuf->tail;
+	if (tail != NULL && tail->end < tail->msize) {
+		iov[count].iov_base = rn_iobuf_seg_data(tail) + tail->end;
+		iov[count].iov_len = tail->msize - tail->end;
+		count++;
+	}
+	iov[count].iov_base = rn_iobuf_seg_data(seg);
+	iov[count].iov_len = seg->msize;
+	count++;
+	res = rn_socket_readv(socket, iov, count);
+	if (res <= 0) {
+		rn_iobuf_append(iobuf, seg);
+		return -1;
+	}
+	len = res;
+	if (count > 1) {
+		if (len > iov[0].iov_len) {
+			len -= iov[0].iov_len;
+			tail->end = tail->msize;
+			iobuf->size += iov[0].iov_len;
+		} else {
+			tail->end += len;
+			iobuf->size += len;
+			len = 0;
+		}
+	}
+	seg->end = len;
+	rn_iobuf_append(iobuf, seg);
+	return res;
+}
+
+/**
+ * Writes chained buffer content to a socket.
+ * Segments are sent with as few writev calls as possible.
+ * The chained buffer is left untouched.
+ *
+ * @param socket Pointer to the socket to write to
+ * @param iobuf Pointer to the chained buffer to send
+ *
+ * @return The number of bytes written on success or -1 if an error occurs
+ */
+ssize_t rn_socket_writeio(rn_socket_t *socket, rn_iobuf_t *iobuf)
+{
+	int i;
+	int count;
+	ssize_t ret;
+	ssize_t total;
+	rn_iobuf_seg_t *seg;
+	rn_buffer_t views[RN_SOCKET_WRITEIO_MAX];
+	rn_buffer_t *buffers[RN_SOCKET_WRITEIO_MAX];
+
+	total = 0;
+	seg = iobuf->head;
+	while (seg != NULL) {
+		count = rn_iobuf_views(&seg, views, RN_SOCKET_WRITEIO_MAX);
+		for (i = 0; i < count; i++) {
+			buffers[i] = &views[i];
+		}
+		ret = rn_socket_writev(socket, buffers, count);
+		if (ret < 0) {
 			return -1;
 		}
-		rn_buffer_static(&dummy, ptr + (offset % pagesize), count);
-		result = rn_socket_writeb(socket, &dummy);
-		munmap(ptr, count + (offset % pagesize));
-		return result;
+		total += ret;
 	}
-	return socket->class->sendfile(socket, in_fd, offset, count);
+	return total;
 }
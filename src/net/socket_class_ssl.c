@@ -17,13 +17,17 @@ const rn_socket_class_t socket_class_ssl = {
 	.destroy = rn_socket_class_ssl_destroy,
 	.open = rn_socket_class_tcp_open,
 	.dup = NULL,
-	.close = rn_socket_class_tcp_close,
+	.close = rn_socket_class_ssl_close,
 	.read = rn_socket_class_ssl_read,
+	.readv = NULL,
+	.pending = rn_socket_class_ssl_pending,
 	.recvfrom = NULL,
+	.recvmmsg = NULL,
 	.write = rn_socket_class_ssl_write,
-	.writev = NULL,
+	.writev = rn_socket_class_ssl_writev,
 	.sendto = NULL,
-	.sendfile = NULL,
+	.sendmmsg = NULL,
+	.sendfile = rn_socket_class_ssl_sendfile,
 	.connect = rn_socket_class_ssl_connect,
 	.bind = rn_socket_class_tcp_bind,
 	.accept = rn_socket_class_ssl_accept
@@ -36,13 +40,17 @@ const rn_socket_class_t socket_class_ssl6 = {
 	.destroy = rn_socket_class_ssl_destroy,
 	.open = rn_socket_class_tcp_open,
 	.dup = NULL,
-	.close = rn_socket_class_tcp_close,
+	.close = rn_socket_class_ssl_close,
 	.read = rn_socket_class_ssl_read,
+	.readv = NULL,
+	.pending = rn_socket_class_ssl_pending,
 	.recvfrom = NULL,
+	.recvmmsg = NULL,
 	.write = rn_socket_class_ssl_write,
-	.writev = NULL,
+	.writev = rn_socket_class_ssl_writev,
 	.sendto = NULL,
-	.sendfile = NULL,
+	.sendmmsg = NULL,
+	.sendfile = rn_socket_class_ssl_sendfile,
 	.connect = rn_socket_class_ssl_connect,
 	.bind = rn_socket_class_tcp_bind,
 	.accept = rn_socket_class_ssl_accept
@@ -59,7 +67,7 @@ rn_socket_t *rn_socket_class_ssl_create(rn_sched_t *sched)
 {
 	rn_ssl_t *ssl;
 
-	ssl = calloc(1, sizeof(*ssl));
+	ssl = rn_slab_calloc(&sched->slab, sizeof(*ssl));
 	if (unlikely(ssl == NULL)) {
 		return NULL;
 	}
@@ -79,7 +87,42 @@ void rn_socket_class_ssl_destroy(rn_socket_t *socket)
 	if (ssl->ssl != NULL) {
 		SSL_free(ssl->ssl);
 	}
-	free(ssl);
+	if (ssl->record != NULL) {
+		rn_free(ssl->record);
+	}
+	rn_slab_free(ssl);
+}
+
+/**
+ * Closes a secure socket.
+ * Once the handshake is done, a close_notify alert is sent without waiting
+ * for the peer one. OpenSSL would otherwise mark the session as not resumable.
+ *
+ * @param socket Socket pointer
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_socket_class_ssl_close(rn_socket_t *socket)
+{
+	rn_ssl_t *ssl = rn_ssl_get(socket);
+
+	if (ssl->ssl != NULL && !(ssl->flags & RN_SSL_HANDSHAKE) && SSL_shutdown(ssl->ssl) < 0) {
+		ERR_clear_error();
+	}
+	return rn_socket_class_tcp_close(socket);
+}
+
+/**
+ * Checks whether data has already been received and buffered by SSL.
+ * Such data can be read without waiting for the socket.
+ *
+ * @param socket Socket pointer
+ *
+ * @return 1 if data is pending, otherwise 0
+ */
+int rn_socket_class_ssl_pending(rn_socket_t *socket)
+{
+	return SSL_has_pending(rn_ssl_get(socket)->ssl);
 }
 
 /**
@@ -97,10 +140,17 @@ ssize_t rn_socket_class_ssl_read(rn_socket_t *socket, void *buf, size_t count)
 	int ret;
 	rn_ssl_t *ssl = rn_ssl_get(socket);
 
+	if ((ssl->flags & RN_SSL_HANDSHAKE) && rn_ssl_handshake(socket) != 0) {
+		return -1;
+	}
 	if (rn_socket_waitio(socket) != 0) {
 		return -1;
 	}
-	/* Don't need to wait for input here as SSL is buffered */
+	/*
+	 * Even with kTLS receive, SSL_read is needed to handle
+	 * non-data records. The kernel decrypts them anyway.
+	 * Don't need to wait for input here as SSL is buffered.
+	 */
 	while ((ret = SSL_read(ssl->ssl, buf, count)) < 0) {
 		switch(SSL_get_error(ssl->ssl, ret)) {
 		case SSL_ERROR_NONE:
@@ -131,9 +181,81 @@ ssize_t rn_socket_class_ssl_read(rn_socket_t *socket, void *buf, size_t count)
 	return ret;
 }
 
+/**
+ * Gets the size of the next record to send, following the dynamic
+ * record sizing policy.
+ *
+ * @param ssl Secure socket pointer
+ * @param boost Bytes to send in small records before using full size ones
+ *
+ * @return Record size in bytes
+ */
+static size_t rn_socket_class_ssl_record_size(rn_ssl_t *ssl, size_t boost)
+{
+	struct timeval idle;
+
+	if (ssl->sent > 0) {
+		timersub(&ssl->socket.node.sched->clock, &ssl->last, &idle);
+		if (idle.tv_sec * 1000 + idle.tv_usec / 1000 >= RN_SSL_RECORD_IDLE) {
+			/* Congestion window may have shrunk, starts small again */
+			ssl->sent = 0;
+		}
+	}
+	return (ssl->sent < boost ? RN_SSL_RECORD_SMALL : RN_SSL_RECORD_MAX);
+}
+
+/**
+ * Sends one TLS record.
+ *
+ * @param ssl Secure socket pointer
+ * @param buf Record content
+ * @param count Record size
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+static int rn_socket_class_ssl_record(rn_ssl_t *ssl, const void *buf, size_t count)
+{
+	int ret;
+
+	if (rn_socket_waitio(&ssl->socket) != 0) {
+		return -1;
+	}
+	while ((ret = SSL_write(ssl->ssl, buf, count)) < 0) {
+		switch(SSL_get_error(ssl->ssl, ret)) {
+		case SSL_ERROR_NONE:
+			return 0;
+		case SSL_ERROR_ZERO_RETURN:
+		case SSL_ERROR_WANT_X509_LOOKUP:
+		case SSL_ERROR_SYSCALL:
+		case SSL_ERROR_SSL:
+			return -1;
+		case SSL_ERROR_WANT_READ:
+			if (rn_socket_waitin(&ssl->socket) != 0) {
+				return -1;
+			}
+			break;
+		case SSL_ERROR_WANT_WRITE:
+		case SSL_ERROR_WANT_CONNECT:
+		case SSL_ERROR_WANT_ACCEPT:
+			if (rn_socket_waitout(&ssl->socket) != 0) {
+				return -1;
+			}
+			break;
+		}
+	}
+	if (ret <= 0) {
+		return -1;
+	}
+	ssl->sent += ret;
+	ssl->last = ssl->socket.node.sched->clock;
+	return 0;
+}
+
 /**
  * Replacement to the write(2) syscall in this library.
  * This function waits for the socket to be available for write operations and calls the write(2) syscall.
+ * Only the first flight is split in small records, the rest of the data
+ * goes to a single SSL_write call.
  *
  * @param socket Pointer to the socket to read
  * @param buf Buffer which stores the information to write
@@ -143,45 +265,138 @@ ssize_t rn_socket_class_ssl_read(rn_socket_t *socket, void *buf, size_t count)
  */
 ssize_t	rn_socket_class_ssl_write(rn_socket_t *socket, const void *buf, size_t count)
 {
-	int ret;
+	size_t len;
 	size_t sent;
 	rn_ssl_t *ssl = rn_ssl_get(socket);
 
+	if ((ssl->flags & RN_SSL_HANDSHAKE) && rn_ssl_handshake(socket) != 0) {
+		return -1;
+	}
+	if (ssl->flags & RN_SSL_KTLS_TX) {
+		return rn_socket_class_tcp_write(socket, buf, count);
+	}
 	sent = count;
 	while (count > 0) {
-		if (rn_socket_waitio(socket) != 0) {
+		len = rn_socket_class_ssl_record_size(ssl, RN_SSL_RECORD_FLIGHT);
+		if (len == RN_SSL_RECORD_MAX || len > count) {
+			/* SSL_write splits data in full size records */
+			len = count;
+		}
+		if (rn_socket_class_ssl_record(ssl, buf, len) != 0) {
 			return -1;
 		}
-		while ((ret = SSL_write(ssl->ssl, buf, count)) < 0) {
-			switch(SSL_get_error(ssl->ssl, ret)) {
-			case SSL_ERROR_NONE:
-				return 0;
-			case SSL_ERROR_ZERO_RETURN:
-			case SSL_ERROR_WANT_X509_LOOKUP:
-			case SSL_ERROR_SYSCALL:
-			case SSL_ERROR_SSL:
-				return -1;
-			case SSL_ERROR_WANT_READ:
-				if (rn_socket_waitin(socket) != 0) {
-					return -1;
+		count -= len;
+		buf += len;
+	}
+	return sent;
+}
+
+/**
+ * Replacement to the writev(2) syscall in this library.
+ * With kTLS, buffers are sent with writev(2) and the kernel builds the records.
+ * Otherwise, buffers are gathered into records sized by the dynamic record
+ * sizing policy, so that small buffers do not end up in records of their own.
+ * Data filling a whole record is sent from the buffer, without copy.
+ *
+ * @param socket Pointer to the socket to write to
+ * @param buffers Array of buffers
+ * @param count Array size
+ *
+ * @return The number of bytes written on success or -1 if an error occurs
+ */
+ssize_t	rn_socket_class_ssl_writev(rn_socket_t *socket, rn_buffer_t **buffers, int count)
+{
+	int i;
+	char *ptr;
+	size_t len;
+	size_t size;
+	size_t fill;
+	size_t chunk;
+	ssize_t total;
+	rn_ssl_t *ssl = rn_ssl_get(socket);
+
+	if ((ssl->flags & RN_SSL_HANDSHAKE) && rn_ssl_handshake(socket) != 0) {
+		return -1;
+	}
+	if (ssl->flags & RN_SSL_KTLS_TX) {
+		return rn_socket_class_tcp_writev(socket, buffers, count);
+	}
+	fill = 0;
+	total = 0;
+	for (i = 0; i < count && total >= 0; i++) {
+		ptr = rn_buffer_ptr(buffers[i]);
+		len = rn_buffer_size(buffers[i]);
+		total += len;
+		while (len > 0) {
+			size = rn_socket_class_ssl_record_size(ssl, RN_SSL_RECORD_BOOST);
+			if (fill == 0 && len >= size) {
+				/* SSL_write splits data in full size records */
+				chunk = (size == RN_SSL_RECORD_MAX ? len - len % size : size);
+				if (rn_socket_class_ssl_record(ssl, ptr, chunk) != 0) {
+					total = -1;
+					break;
 				}
-				break;
-			case SSL_ERROR_WANT_WRITE:
-			case SSL_ERROR_WANT_CONNECT:
-			case SSL_ERROR_WANT_ACCEPT:
-				if (rn_socket_waitout(socket) != 0) {
-					return -1;
+				ptr += chunk;
+				len -= chunk;
+				continue;
+			}
+			if (ssl->record == NULL) {
+				ssl->record = rn_malloc(RN_SSL_RECORD_MAX);
+				if (unlikely(ssl->record == NULL)) {
+					total = -1;
+					break;
 				}
-				break;
+			}
+			if (fill < size) {
+				chunk = (size - fill < len ? size - fill : len);
+				memcpy(ssl->record + fill, ptr, chunk);
+				fill += chunk;
+				ptr += chunk;
+				len -= chunk;
+			}
+			if (fill >= size) {
+				if (rn_socket_class_ssl_record(ssl, ssl->record, fill) != 0) {
+					total = -1;
+					break;
+				}
+				fill = 0;
 			}
 		}
-		if (ret <= 0) {
-			return -1;
-		}
-		count -= ret;
-		buf += ret;
 	}
-	return sent;
+	if (total >= 0 && fill > 0 && rn_socket_class_ssl_record(ssl, ssl->record, fill) != 0) {
+		total = -1;
+	}
+	/* Idle connections do not keep a record buffer around */
+	if (ssl->record != NULL) {
+		rn_free(ssl->record);
+		ssl->record = NULL;
+	}
+	return total;
+}
+
+/**
+ * Replacement function for sendfile(2).
+ * With kTLS, file content is encrypted by the kernel and never copied to user space.
+ * Otherwise, the file is mapped and sent through SSL_write.
+ *
+ * @param socket Pointer to the socket to send the file to
+ * @param in_fd File descriptor of file to send
+ * @param offset File offset
+ * @param count Number of bytes to send
+ *
+ * @return Number of bytes correctly sent or -1 if an error occurs
+ */
+ssize_t rn_socket_class_ssl_sendfile(rn_socket_t *socket, int in_fd, off_t offset, size_t count)
+{
+	rn_ssl_t *ssl = rn_ssl_get(socket);
+
+	if ((ssl->flags & RN_SSL_HANDSHAKE) && rn_ssl_handshake(socket) != 0) {
+		return -1;
+	}
+	if (ssl->flags & RN_SSL_KTLS_TX) {
+		return rn_socket_class_tcp_sendfile(socket, in_fd, offset, count);
+	}
+	return rn_socket_sendfile_mmap(socket, in_fd, offset, count);
 }
 
 /**
@@ -194,7 +409,6 @@ ssize_t	rn_socket_class_ssl_write(rn_socket_t *socket, const void *buf, size_t c
  */
 int rn_socket_class_ssl_connect(rn_socket_t *socket, const rn_addr_t *dst)
 {
-	int ret;
 	BIO *sbio;
 	rn_ssl_t *ssl = rn_ssl_get(socket);
 
@@ -210,39 +424,19 @@ int rn_socket_class_ssl_connect(rn_socket_t *socket, const rn_addr_t *dst)
 		return -1;
 	}
 	SSL_set_bio(ssl->ssl, sbio, sbio);
-	while ((ret = SSL_connect(ssl->ssl)) < 0) {
-		switch(SSL_get_error(ssl->ssl, ret)) {
-		case SSL_ERROR_NONE:
-			return 0;
-		case SSL_ERROR_ZERO_RETURN:
-		case SSL_ERROR_WANT_X509_LOOKUP:
-		case SSL_ERROR_SYSCALL:
-		case SSL_ERROR_SSL:
-			return -1;
-		case SSL_ERROR_WANT_READ:
-			if (rn_socket_waitin(&ssl->socket) != 0) {
-				return -1;
-			}
-			break;
-		case SSL_ERROR_WANT_WRITE:
-		case SSL_ERROR_WANT_CONNECT:
-		case SSL_ERROR_WANT_ACCEPT:
-			if (rn_socket_waitout(&ssl->socket) != 0) {
-				return -1;
-			}
-			break;
-
-		}
+	SSL_set_connect_state(ssl->ssl);
+	if (ssl->ctx->cache != NULL) {
+		rn_ssl_cache_resume(ssl->ctx->cache, ssl->ssl, dst);
 	}
-	if (ret == 0) {
-		return -1;
-	}
-	return 0;
+	ssl->flags = RN_SSL_HANDSHAKE;
+	return rn_ssl_handshake(socket);
 }
 
 /**
  * Accepts a new connection from a listening socket.
  * This is a replacement to the accept(2) syscall in this library.
+ * The TLS handshake is left to the first I/O on the new socket, so that
+ * a slow peer does not hold the listening task.
  *
  * @param socket Pointer to the socket which is listening to
  * @param from Peer address
@@ -252,7 +446,6 @@ int rn_socket_class_ssl_connect(rn_socket_t *socket, const rn_addr_t *dst)
 rn_socket_t *rn_socket_class_ssl_accept(rn_socket_t *socket, rn_addr_t *from)
 {
 	int fd;
-	int ret;
 	BIO *sbio;
 	rn_ssl_t *new;
 	socklen_t addr_len;
@@ -280,7 +473,7 @@ rn_socket_t *rn_socket_class_ssl_accept(rn_socket_t *socket, rn_addr_t *from)
 		}
 		addr_len = sizeof(*from);
 	}
-	new = calloc(1, sizeof(*new));
+	new = rn_slab_calloc(&socket->node.sched->slab, sizeof(*new));
 	if (unlikely(new == NULL)) {
 		rn_error_set(errno);
 		close(fd);
@@ -291,6 +484,7 @@ rn_socket_t *rn_socket_class_ssl_accept(rn_socket_t *socket, rn_addr_t *from)
 	new->socket.node.sched = socket->node.sched;
 	new->socket.class = socket->class;
 	new->socket.parent = socket;
+	new->socket.flags = socket->flags;
 	new->ssl = SSL_new(new->ctx->ctx);
 	if (unlikely(new->ssl == NULL)) {
 		rn_socket_destroy(&new->socket);
@@ -303,31 +497,8 @@ rn_socket_t *rn_socket_class_ssl_accept(rn_socket_t *socket, rn_addr_t *from)
 		return NULL;
 	}
 	SSL_set_bio(new->ssl, sbio, sbio);
-	while ((ret = SSL_accept(new->ssl)) <= 0) {
-		switch(SSL_get_error(new->ssl, ret)) {
-		case SSL_ERROR_ZERO_RETURN:
-		case SSL_ERROR_WANT_X509_LOOKUP:
-		case SSL_ERROR_SYSCALL:
-		case SSL_ERROR_SSL:
-			//FIXME set rn_error
-			rn_socket_destroy(&new->socket);
-			return NULL;
-		case SSL_ERROR_WANT_READ:
-			if (rn_socket_waitin(&new->socket) != 0) {
-				rn_socket_destroy(&new->socket);
-				return NULL;
-			}
-			break;
-		case SSL_ERROR_WANT_WRITE:
-		case SSL_ERROR_WANT_CONNECT:
-		case SSL_ERROR_WANT_ACCEPT:
-			if (rn_socket_waitout(&new->socket) != 0) {
-				rn_socket_destroy(&new->socket);
-				return NULL;
-			}
-			break;
-
-		}
-	}
+	/* The handshake runs in the task of the connection, see rn_ssl_handshake */
+	SSL_set_accept_state(new->ssl);
+	new->flags = RN_SSL_HANDSHAKE;
 	return &new->socket;
 }
@@ -19,10 +19,14 @@ const rn_socket_class_t socket_class_tcp = {
 	.dup = rn_socket_class_tcp_dup,
 	.close = rn_socket_class_tcp_close,
 	.read = rn_socket_class_tcp_read,
+	.readv = rn_socket_class_tcp_readv,
+	.pending = NULL,
 	.recvfrom = rn_socket_class_tcp_recvfrom,
+	.recvmmsg = NULL,
 	.write = rn_socket_class_tcp_write,
 	.writev = rn_socket_class_tcp_writev,
 	.sendto = rn_socket_class_tcp_sendto,
+	.sendmmsg = NULL,
 	.sendfile = rn_socket_class_tcp_sendfile,
 	.connect = rn_socket_class_tcp_connect,
 	.bind = rn_socket_class_tcp_bind,
@@ -38,10 +42,14 @@ const rn_socket_class_t socket_class_tcp6 = {
 	.dup = rn_socket_class_tcp_dup,
 	.close = rn_socket_class_tcp_close,
 	.read = rn_socket_class_tcp_read,
+	.readv = rn_socket_class_tcp_readv,
+	.pending = NULL,
 	.recvfrom = rn_socket_class_tcp_recvfrom,
+	.recvmmsg = NULL,
 	.write = rn_socket_class_tcp_write,
 	.writev = rn_socket_class_tcp_writev,
 	.sendto = rn_socket_class_tcp_sendto,
+	.sendmmsg = NULL,
 	.sendfile = rn_socket_class_tcp_sendfile,
 	.connect = rn_socket_class_tcp_connect,
 	.bind = rn_socket_class_tcp_bind,
@@ -59,7 +67,7 @@ rn_socket_t *rn_socket_class_tcp_create(rn_sched_t *sched)
 {
 	rn_socket_t *socket;
 
-	socket = calloc(1, sizeof(*socket));
+	socket = rn_slab_calloc(&sched->slab, sizeof(*socket));
 	if (unlikely(socket == NULL)) {
 		return NULL;
 	}
@@ -74,7 +82,7 @@ rn_socket_t *rn_socket_class_tcp_create(rn_sched_t *sched)
  */
 void rn_socket_class_tcp_destroy(rn_socket_t *socket)
 {
-	free(socket);
+	rn_slab_free(socket);
 }
 
 /**
@@ -116,14 +124,15 @@ rn_socket_t *rn_socket_class_tcp_dup(rn_sched_t *destination, rn_socket_t *socke
 {
 	rn_socket_t *new;
 
-	new = calloc(1, sizeof(*new));
+	/* The destination slab belongs to the thread running that scheduler */
+	new = rn_slab_alloc(NULL, sizeof(*new));
 	if (unlikely(new == NULL)) {
 		return NULL;
 	}
 	*new = *socket;
 	new->node.fd = dup(socket->node.fd);
 	if (unlikely(new->node.fd < 0)) {
-		free(new);
+		rn_slab_free(new);
 		return NULL;
 	}
 	new->node.sched = destination;
@@ -177,6 +186,43 @@ ssize_t rn_socket_class_tcp_read(rn_socket_t *socket, void *buf, size_t count)
 	return ret;
 }
 
+/**
+ * Replacement to the readv(2) syscall in this library.
+ * This function waits for the socket to be available for read operations and calls the readv(2) syscall.
+ *
+ * @param socket Pointer to the socket to read
+ * @param iov Array of areas where to store the information read
+ * @param count Array size
+ *
+ * @return The number of bytes read on success or -1 if an error occurs
+ */
+ssize_t rn_socket_class_tcp_readv(rn_socket_t *socket, const struct iovec *iov, int count)
+{
+	ssize_t ret;
+
+	if (count > IOV_MAX) {
+		rn_error_set(EINVAL);
+		return -1;
+	}
+	if (rn_socket_waitio(socket) != 0) {
+		return -1;
+	}
+	while ((ret = readv(socket->node.fd, iov, count)) < 0) {
+		if (errno != EAGAIN && errno != EWOULDBLOCK) {
+			rn_error_set(errno);
+			return -1;
+		}
+		if (rn_socket_waitin(socket) != 0) {
+			return -1;
+		}
+	}
+	if (ret <= 0) {
+		//FIXME: set rn_error
+		return -1;
+	}
+	return ret;
+}
+
 /**
  * Replacement to the recvfrom(2) syscall in this library.
  * This function waits for the socket to be available for read operations and calls the recvfrom(2) syscall.
@@ -498,7 +544,7 @@ rn_socket_t *rn_socket_class_tcp_accept(rn_socket_t *socket, rn_addr_t *from)
 		}
 		addr_len = sizeof(*from);
 	}
-	new = calloc(1, sizeof(*new));
+	new = rn_slab_calloc(&socket->node.sched->slab, sizeof(*new));
 	if (unlikely(new == NULL)) {
 		rn_error_set(errno);
 		close(fd);
@@ -508,5 +554,7 @@ rn_socket_t *rn_socket_class_tcp_accept(rn_socket_t *socket, rn_addr_t *from)
 	new->node.sched = socket->node.sched;
 	new->parent = socket;
 	new->class = socket->class;
+	/* TCP options are inherited from the listening socket */
+	new->flags = socket->flags;
 	return new;
 }
@@ -19,10 +19,14 @@ const rn_socket_class_t socket_class_udp = {
 	.dup = rn_socket_class_udp_dup,
 	.close = rn_socket_class_udp_close,
 	.read = rn_socket_class_udp_read,
+	.readv = NULL,
+	.pending = NULL,
 	.recvfrom = rn_socket_class_udp_recvfrom,
+	.recvmmsg = rn_socket_class_udp_recvmmsg,
 	.write = rn_socket_class_udp_write,
 	.writev = rn_socket_class_udp_writev,
 	.sendto = rn_socket_class_udp_sendto,
+	.sendmmsg = rn_socket_class_udp_sendmmsg,
 	.sendfile = NULL,
 	.connect = rn_socket_class_udp_connect,
 	.bind = rn_socket_class_udp_bind,
@@ -38,10 +42,14 @@ const rn_socket_class_t socket_class_udp6 = {
 	.dup = rn_socket_class_udp_dup,
 	.close = rn_socket_class_udp_close,
 	.read = rn_socket_class_udp_read,
+	.readv = NULL,
+	.pending = NULL,
 	.recvfrom = rn_socket_class_udp_recvfrom,
+	.recvmmsg = rn_socket_class_udp_recvmmsg,
 	.write = rn_socket_class_udp_write,
 	.writev = rn_socket_class_udp_writev,
 	.sendto = rn_socket_class_udp_sendto,
+	.sendmmsg = rn_socket_class_udp_sendmmsg,
 	.sendfile = NULL,
 	.connect = rn_socket_class_udp_connect,
 	.bind = rn_socket_class_udp_bind,
@@ -59,7 +67,7 @@ rn_socket_t *rn_socket_class_udp_create(rn_sched_t *sched)
 {
 	rn_socket_t *socket;
 
-	socket = calloc(1, sizeof(*socket));
+	socket = rn_slab_calloc(&sched->slab, sizeof(*socket));
 	if (unlikely(socket == NULL)) {
 		return NULL;
 	}
@@ -74,7 +82,7 @@ rn_socket_t *rn_socket_class_udp_create(rn_sched_t *sched)
  */
 void rn_socket_class_udp_destroy(rn_socket_t *socket)
 {
-	free(socket);
+	rn_slab_free(socket);
 }
 
 /**
@@ -116,14 +124,15 @@ rn_socket_t *rn_socket_class_udp_dup(rn_sched_t *destination, rn_socket_t *socke
 {
 	rn_socket_t *new;
 
-	new = calloc(1, sizeof(*new));
+	/* The destination slab belongs to the thread running that scheduler */
+	new = rn_slab_alloc(NULL, sizeof(*new));
 	if (unlikely(new == NULL)) {
 		return NULL;
 	}
 	*new = *socket;
 	new->node.fd = dup(socket->node.fd);
 	if (unlikely(new->node.fd < 0)) {
-		free(new);
+		rn_slab_free(new);
 		return NULL;
 	}
 	new->node.sched = destination;
@@ -214,6 +223,71 @@ ssize_t rn_socket_class_udp_recvfrom(rn_socket_t *socket, void *buf, size_t coun
 	return ret;
 }
 
+/**
+ * Receives several datagrams with the recvmmsg(2) syscall.
+ * This function waits for the socket to be available for read operations
+ * only if no datagram is pending, then returns everything available up
+ * to count datagrams.
+ *
+ * @param socket Pointer to the socket to read
+ * @param dgrams Array of datagrams, with buf and size set
+ * @param count Array size
+ *
+ * @return The number of datagrams received on success or -1 if an error occurs
+ */
+int rn_socket_class_udp_recvmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count)
+{
+	int ret;
+	unsigned int i;
+	struct cmsghdr *cmsg;
+	struct iovec iov[RN_SOCKET_MMSG_MAX];
+	struct mmsghdr msgs[RN_SOCKET_MMSG_MAX];
+	/* Control buffers must be aligned for struct cmsghdr */
+	union {
+		char buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	} control[RN_SOCKET_MMSG_MAX];
+
+	if (count > RN_SOCKET_MMSG_MAX) {
+		count = RN_SOCKET_MMSG_MAX;
+	}
+	if (rn_socket_waitio(socket) != 0) {
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		iov[i].iov_base = dgrams[i].buf;
+		iov[i].iov_len = dgrams[i].size;
+		memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+		msgs[i].msg_hdr.msg_name = &dgrams[i].addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(dgrams[i].addr);
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		/* Receives the GRO segment size, if enabled */
+		msgs[i].msg_hdr.msg_control = control[i].buf;
+		msgs[i].msg_hdr.msg_controllen = sizeof(control[i].buf);
+	}
+	while ((ret = recvmmsg(socket->node.fd, msgs, count, MSG_DONTWAIT, NULL)) < 0) {
+		if (errno != EAGAIN && errno != EWOULDBLOCK) {
+			rn_error_set(errno);
+			return -1;
+		}
+		if (rn_socket_waitin(socket) != 0) {
+			return -1;
+		}
+	}
+	for (i = 0; i < (unsigned int) ret; i++) {
+		dgrams[i].len = msgs[i].msg_len;
+		dgrams[i].segment = 0;
+		dgrams[i].truncated = ((msgs[i].msg_hdr.msg_flags & MSG_TRUNC) != 0);
+		for (cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg)) {
+			if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+				dgrams[i].segment = *(int *) CMSG_DATA(cmsg);
+			}
+		}
+	}
+	return ret;
+}
+
 /**
  * Replacement to the write(2) syscall in this library.
  * This function waits for the socket to be available for write operations and calls the write(2) syscall.
@@ -360,6 +434,78 @@ ssize_t rn_socket_class_udp_sendto(rn_socket_t *socket, void *buf, size_t count,
 	return sent;
 }
 
+/**
+ * Sends several datagrams with the sendmmsg(2) syscall.
+ * This function waits for the socket to be available for write operations
+ * whenever the socket buffer is full, until every datagram is sent.
+ * If an error occurs once some datagrams went out, their number is returned.
+ *
+ * @param socket Pointer to the socket to write
+ * @param dgrams Array of datagrams, with buf, len, addr and segment set
+ * @param count Array size
+ *
+ * @return The number of datagrams sent, or -1 if an error occurs before any is sent
+ */
+int rn_socket_class_udp_sendmmsg(rn_socket_t *socket, rn_dgram_t *dgrams, unsigned int count)
+{
+	int ret;
+	unsigned int i;
+	unsigned int nb;
+	unsigned int sent;
+	rn_dgram_t *dgram;
+	struct cmsghdr *cmsg;
+	struct iovec iov[RN_SOCKET_MMSG_MAX];
+	struct mmsghdr msgs[RN_SOCKET_MMSG_MAX];
+	union {
+		char buf[CMSG_SPACE(sizeof(uint16_t))];
+		struct cmsghdr align;
+	} control[RN_SOCKET_MMSG_MAX];
+
+	sent = 0;
+	while (sent < count) {
+		nb = count - sent;
+		if (nb > RN_SOCKET_MMSG_MAX) {
+			nb = RN_SOCKET_MMSG_MAX;
+		}
+		for (i = 0; i < nb; i++) {
+			dgram = &dgrams[sent + i];
+			iov[i].iov_base = dgram->buf;
+			iov[i].iov_len = dgram->len;
+			memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+			if (dgram->addr.sa.sa_family != AF_UNSPEC) {
+				msgs[i].msg_hdr.msg_name = &dgram->addr;
+				msgs[i].msg_hdr.msg_namelen = sizeof(dgram->addr);
+			}
+			msgs[i].msg_hdr.msg_iov = &iov[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			if (dgram->segment > 0) {
+				/* The kernel splits the payload in segment sized datagrams */
+				msgs[i].msg_hdr.msg_control = control[i].buf;
+				msgs[i].msg_hdr.msg_controllen = sizeof(control[i].buf);
+				cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr);
+				cmsg->cmsg_level = SOL_UDP;
+				cmsg->cmsg_type = UDP_SEGMENT;
+				cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+				*(uint16_t *) CMSG_DATA(cmsg) = dgram->segment;
+			}
+		}
+		if (rn_socket_waitio(socket) != 0) {
+			return (sent > 0 ? (int) sent : -1);
+		}
+		while ((ret = sendmmsg(socket->node.fd, msgs, nb, MSG_DONTWAIT)) < 0) {
+			if (errno != EAGAIN && errno != EWOULDBLOCK) {
+				rn_error_set(errno);
+				return (sent > 0 ? (int) sent : -1);
+			}
+			if (rn_socket_waitout(socket) != 0) {
+				return (sent > 0 ? (int) sent : -1);
+			}
+		}
+		sent += ret;
+	}
+	return sent;
+}
+
 /**
  * Replacement to the connect(2) syscall.
  *
@@ -45,17 +45,24 @@ void rn_ssl_init()
 static rn_ssl_ctx_t *__rn_ssl_context_new(void)
 {
 	SSL_CTX *ctx;
-	rn_ssl_ctx_t *ssl = malloc(sizeof(*ssl));
+	rn_ssl_ctx_t *ssl = rn_malloc(sizeof(*ssl));
 	if (ssl == NULL) {
 		return NULL;
 	}
 	ctx = SSL_CTX_new(SSLv23_method());
 	if (ctx == NULL) {
-		free(ssl);
+		rn_free(ssl);
 		return NULL;
 	}
-
+#ifdef SSL_OP_ENABLE_KTLS
+	/* OpenSSL falls back to user space encryption when kTLS is not available */
+	SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+#endif /* SSL_OP_ENABLE_KTLS */
 	ssl->ctx = ctx;
+	ssl->handshake_timeout = RN_SSL_HANDSHAKE_TIMEOUT;
+	ssl->cache = NULL;
+	/* Lets OpenSSL callbacks get back to this context */
+	SSL_CTX_set_app_data(ctx, ssl);
 	return ssl;
 }
 
@@ -128,13 +135,13 @@ rn_ssl_ctx_t *rn_ssl_context(unsigned short keysize)
 	if (SSL_CTX_use_certificate(ssl->ctx, x509) == 0) {
 		ssl_get_first_error("create certificate");
 		rn_ssl_context_destroy(ssl);
-		free(ssl);
+		rn_free(ssl);
 		return NULL;
 	}
 	if (SSL_CTX_use_PrivateKey(ssl->ctx, pkey) == 0) {
 		ssl_get_first_error("create private key");
 		rn_ssl_context_destroy(ssl);
-		free(ssl);
+		rn_free(ssl);
 		return NULL;
 	}
 	return ssl;
@@ -157,7 +164,7 @@ rn_ssl_ctx_t *rn_ssl_context_load(const char *cert_file, const char *key_file)
     if (SSL_CTX_use_certificate_chain_file(ssl->ctx, cert_file) <= 0) {
 		ssl_get_first_error("load cerfificate from file");
 		rn_ssl_context_destroy(ssl);
-		free(ssl);
+		rn_free(ssl);
 		return (0);
     }
     if (SSL_CTX_use_PrivateKey_file(ssl->ctx, key_file, SSL_FILETYPE_PEM) <= 0) {
@@ -171,7 +178,7 @@ rn_ssl_ctx_t *rn_ssl_context_load(const char *cert_file, const char *key_file)
     if (!SSL_CTX_check_private_key(ssl->ctx)) {
 		ssl_get_first_error("private and public keys does not match");
 		rn_ssl_context_destroy(ssl);
-		free(ssl);
+		rn_free(ssl);
 		return NULL;
     }
 
@@ -193,7 +200,7 @@ void rn_ssl_context_destroy(rn_ssl_ctx_t *ctx)
 			EVP_PKEY_free(ctx->pkey);
 		}
 		SSL_CTX_free(ctx->ctx);
-		free(ctx);
+		rn_free(ctx);
 	}
 }
 
@@ -209,6 +216,107 @@ rn_ssl_t *rn_ssl_get(rn_socket_t *socket)
 	return container_of(socket, rn_ssl_t, socket);
 }
 
+/**
+ * Checks whether OpenSSL handed record encryption over to the kernel.
+ * kTLS is requested on the context and only set up by OpenSSL when
+ * the kernel supports the negotiated cipher.
+ *
+ * @param ssl Secure socket pointer, after the handshake
+ */
+static void rn_ssl_ktls(rn_ssl_t *ssl)
+{
+#ifndef OPENSSL_NO_KTLS
+	if (BIO_get_ktls_send(SSL_get_wbio(ssl->ssl))) {
+		ssl->flags |= RN_SSL_KTLS_TX;
+	}
+	if (BIO_get_ktls_recv(SSL_get_rbio(ssl->ssl))) {
+		ssl->flags |= RN_SSL_KTLS_RX;
+	}
+#endif /* !OPENSSL_NO_KTLS */
+}
+
+/**
+ * Runs the SSL_do_handshake loop.
+ *
+ * @param ssl Secure socket pointer
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+static int rn_ssl_handshake_run(rn_ssl_t *ssl)
+{
+	int ret;
+
+	while ((ret = SSL_do_handshake(ssl->ssl)) <= 0) {
+		switch (SSL_get_error(ssl->ssl, ret)) {
+		case SSL_ERROR_WANT_READ:
+			if (rn_socket_waitin(&ssl->socket) != 0) {
+				return -1;
+			}
+			break;
+		case SSL_ERROR_WANT_WRITE:
+		case SSL_ERROR_WANT_CONNECT:
+		case SSL_ERROR_WANT_ACCEPT:
+			if (rn_socket_waitout(&ssl->socket) != 0) {
+				return -1;
+			}
+			break;
+		default:
+			rn_error_set(EPROTO);
+			return -1;
+		}
+	}
+	ssl->flags &= ~RN_SSL_HANDSHAKE;
+	rn_ssl_ktls(ssl);
+	if (ssl->ctx->cache != NULL) {
+		rn_ssl_cache_account(ssl->ctx->cache, ssl->ssl);
+	}
+	return 0;
+}
+
+/**
+ * Runs the TLS handshake of a secure socket, if not done yet.
+ * Accepted sockets are returned before the handshake, which is then run
+ * by the first read or write in the task of the connection. This function
+ * runs it explicitly. The current task deadline is lowered to the context
+ * handshake timeout for the duration of the handshake.
+ *
+ * @param socket Socket pointer
+ *
+ * @return 0 on success or -1 if an error occurs (ETIMEDOUT if the handshake timed out)
+ */
+int rn_ssl_handshake(rn_socket_t *socket)
+{
+	int ret;
+	rn_task_t *task;
+	struct timeval toadd;
+	struct timeval limit;
+	struct timeval deadline;
+	rn_ssl_t *ssl = rn_ssl_get(socket);
+
+	if (!(ssl->flags & RN_SSL_HANDSHAKE)) {
+		return 0;
+	}
+	if (ssl->ctx->handshake_timeout == 0) {
+		return rn_ssl_handshake_run(ssl);
+	}
+	task = rn_task_driver_getcurrent(socket->node.sched);
+	deadline = task->deadline;
+	toadd.tv_sec = ssl->ctx->handshake_timeout / 1000;
+	toadd.tv_usec = (ssl->ctx->handshake_timeout % 1000) * 1000;
+	timeradd(&socket->node.sched->clock, &toadd, &limit);
+	if (timerisset(&deadline) && timercmp(&deadline, &limit, <=)) {
+		return rn_ssl_handshake_run(ssl);
+	}
+	task->deadline = limit;
+	ret = rn_ssl_handshake_run(ssl);
+	if (task->deadlined == true) {
+		/* Drop the wake up set for the handshake limit */
+		rn_task_unschedule(task);
+	}
+	task->deadline = deadline;
+	return ret;
+}
+
 /**
  * Creates a SSL client and tries to connect to the specified address.
  *
@@ -0,0 +1,457 @@
+/**
+ * @file   ssl_cache.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  TLS session cache shared between schedulers
+ *
+ *
+ */
+
+#include "rinoo/net/module.h"
+
+static char rn_ssl_ticket_digest[] = "sha256";
+
+static uint64_t rn_ssl_session_hash(rn_hmap_node_t *node)
+{
+	rn_ssl_session_t *session = container_of(node, rn_ssl_session_t, node);
+
+	return rn_hash_default(session->key, session->keylen);
+}
+
+static int rn_ssl_session_cmp(rn_hmap_node_t *node1, rn_hmap_node_t *node2)
+{
+	rn_ssl_session_t *session1 = container_of(node1, rn_ssl_session_t, node);
+	rn_ssl_session_t *session2 = container_of(node2, rn_ssl_session_t, node);
+
+	if (session1->keylen != session2->keylen) {
+		return (session1->keylen > session2->keylen ? 1 : -1);
+	}
+	return memcmp(session1->key, session2->key, session1->keylen);
+}
+
+static void rn_ssl_session_delete(rn_hmap_node_t *node)
+{
+	rn_ssl_session_t *session = container_of(node, rn_ssl_session_t, node);
+
+	SSL_SESSION_free(session->session);
+	rn_free(session);
+}
+
+/**
+ * Builds a client cache key from a destination address.
+ *
+ * @param addr Destination address
+ * @param key Key buffer, at least SSL_MAX_SSL_SESSION_ID_LENGTH long
+ *
+ * @return Key length
+ */
+static unsigned int rn_ssl_cache_peer_key(const rn_addr_t *addr, unsigned char *key)
+{
+	key[0] = addr->sa.sa_family;
+	if (IS_IPV6(addr)) {
+		memcpy(key + 1, &addr->v6.sin6_port, sizeof(addr->v6.sin6_port));
+		memcpy(key + 3, &addr->v6.sin6_addr, sizeof(addr->v6.sin6_addr));
+		return 3 + sizeof(addr->v6.sin6_addr);
+	}
+	memcpy(key + 1, &addr->v4.sin_port, sizeof(addr->v4.sin_port));
+	memcpy(key + 3, &addr->v4.sin_addr, sizeof(addr->v4.sin_addr));
+	return 3 + sizeof(addr->v4.sin_addr);
+}
+
+/**
+ * Adds a session to a cache map, replacing the entry with the same key.
+ * The least recently used entry is evicted once the cache is full.
+ * Cache mutex must be held.
+ *
+ * @param cache Cache pointer
+ * @param map Map where to store the session
+ * @param lru Recently used list of the map
+ * @param key Session key
+ * @param keylen Key length
+ * @param session OpenSSL session, the reference is taken by the cache on success
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+static int rn_ssl_cache_store(rn_ssl_cache_t *cache, rn_hmap_t *map, rn_list_t *lru, const unsigned char *key, unsigned int keylen, SSL_SESSION *session)
+{
+	rn_list_node_t *lnode;
+	rn_hmap_node_t *node;
+	rn_ssl_session_t dummy;
+	rn_ssl_session_t *entry;
+
+	dummy.keylen = keylen;
+	memcpy(dummy.key, key, keylen);
+	node = rn_hmap_get(map, &dummy.node);
+	if (node != NULL) {
+		entry = container_of(node, rn_ssl_session_t, node);
+		SSL_SESSION_free(entry->session);
+		entry->session = session;
+		rn_list_remove(lru, &entry->lnode);
+		rn_list_put(lru, &entry->lnode);
+		return 0;
+	}
+	if (rn_list_size(lru) >= cache->size) {
+		/* Recently used entries are at head, the oldest one is at tail */
+		lnode = lru->tail;
+		entry = container_of(lnode, rn_ssl_session_t, lnode);
+		rn_list_remove(lru, lnode);
+		rn_hmap_remove(map, &entry->node);
+		rn_ssl_session_delete(&entry->node);
+	}
+	entry = rn_malloc(sizeof(*entry));
+	if (entry == NULL) {
+		return -1;
+	}
+	*entry = dummy;
+	entry->session = session;
+	if (rn_hmap_put(map, &entry->node) != 0) {
+		rn_free(entry);
+		return -1;
+	}
+	rn_list_put(lru, &entry->lnode);
+	return 0;
+}
+
+/**
+ * Looks up a session in a cache map. Cache mutex must be held.
+ *
+ * @param map Map to look into
+ * @param lru Recently used list of the map
+ * @param key Session key
+ * @param keylen Key length
+ *
+ * @return Cache entry or NULL if not found
+ */
+static rn_ssl_session_t *rn_ssl_cache_lookup(rn_hmap_t *map, rn_list_t *lru, const unsigned char *key, unsigned int keylen)
+{
+	rn_hmap_node_t *node;
+	rn_ssl_session_t dummy;
+	rn_ssl_session_t *entry;
+
+	if (keylen > sizeof(dummy.key)) {
+		return NULL;
+	}
+	dummy.keylen = keylen;
+	memcpy(dummy.key, key, keylen);
+	node = rn_hmap_get(map, &dummy.node);
+	if (node == NULL) {
+		return NULL;
+	}
+	entry = container_of(node, rn_ssl_session_t, node);
+	rn_list_remove(lru, &entry->lnode);
+	rn_list_put(lru, &entry->lnode);
+	return entry;
+}
+
+/**
+ * Generates a new ticket key once the rotation period is over.
+ * The previous key is kept to decrypt tickets until next rotation.
+ * Cache mutex must be held.
+ *
+ * @param cache Cache pointer
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+static int rn_ssl_cache_rotate(rn_ssl_cache_t *cache)
+{
+	time_t now;
+	rn_ssl_ticket_key_t key;
+
+	now = time(NULL);
+	if (cache->nbkeys > 0 && (cache->rotation == 0 || now - cache->rotated < cache->rotation)) {
+		return 0;
+	}
+	if (RAND_bytes(key.name, sizeof(key.name)) <= 0 ||
+	    RAND_priv_bytes(key.aes, sizeof(key.aes)) <= 0 ||
+	    RAND_priv_bytes(key.hmac, sizeof(key.hmac)) <= 0) {
+		return -1;
+	}
+	cache->keys[1] = cache->keys[0];
+	cache->keys[0] = key;
+	cache->nbkeys = (cache->nbkeys == 0 ? 1 : 2);
+	cache->rotated = now;
+	return 0;
+}
+
+static rn_ssl_cache_t *rn_ssl_cache_get(SSL_CTX *ctx)
+{
+	rn_ssl_ctx_t *rn_ctx = SSL_CTX_get_app_data(ctx);
+
+	return rn_ctx->cache;
+}
+
+static int rn_ssl_cache_new_cb(SSL *ssl, SSL_SESSION *session)
+{
+	int ret;
+	rn_addr_t addr;
+	socklen_t addrlen;
+	unsigned int keylen;
+	const unsigned char *id;
+	unsigned char key[SSL_MAX_SSL_SESSION_ID_LENGTH];
+	rn_ssl_cache_t *cache = rn_ssl_cache_get(SSL_get_SSL_CTX(ssl));
+
+	if (SSL_is_server(ssl)) {
+		id = SSL_SESSION_get_id(session, &keylen);
+		pthread_mutex_lock(&cache->mutex);
+		ret = rn_ssl_cache_store(cache, &cache->sessions, &cache->sessions_lru, id, keylen, session);
+		pthread_mutex_unlock(&cache->mutex);
+		return (ret == 0 ? 1 : 0);
+	}
+	addrlen = sizeof(addr);
+	if (getpeername(SSL_get_fd(ssl), &addr.sa, &addrlen) != 0) {
+		return 0;
+	}
+	keylen = rn_ssl_cache_peer_key(&addr, key);
+	pthread_mutex_lock(&cache->mutex);
+	ret = rn_ssl_cache_store(cache, &cache->peers, &cache->peers_lru, key, keylen, session);
+	pthread_mutex_unlock(&cache->mutex);
+	/* Returning 1 keeps the reference on the session */
+	return (ret == 0 ? 1 : 0);
+}
+
+static SSL_SESSION *rn_ssl_cache_get_cb(SSL *ssl, const unsigned char *id, int len, int *copy)
+{
+	rn_ssl_session_t *entry;
+	SSL_SESSION *session = NULL;
+	rn_ssl_cache_t *cache = rn_ssl_cache_get(SSL_get_SSL_CTX(ssl));
+
+	pthread_mutex_lock(&cache->mutex);
+	entry = rn_ssl_cache_lookup(&cache->sessions, &cache->sessions_lru, id, len);
+	if (entry != NULL) {
+		session = entry->session;
+		/* Referenced under the lock, the entry may be evicted right after */
+		SSL_SESSION_up_ref(session);
+		*copy = 0;
+		cache->stats.hits++;
+	} else {
+		cache->stats.misses++;
+	}
+	pthread_mutex_unlock(&cache->mutex);
+	return session;
+}
+
+static void rn_ssl_cache_remove_cb(SSL_CTX *ctx, SSL_SESSION *session)
+{
+	unsigned int len;
+	const unsigned char *id;
+	rn_ssl_session_t *entry;
+	rn_ssl_cache_t *cache = rn_ssl_cache_get(ctx);
+
+	id = SSL_SESSION_get_id(session, &len);
+	pthread_mutex_lock(&cache->mutex);
+	entry = rn_ssl_cache_lookup(&cache->sessions, &cache->sessions_lru, id, len);
+	if (entry != NULL && entry->session == session) {
+		rn_list_remove(&cache->sessions_lru, &entry->lnode);
+		rn_hmap_remove(&cache->sessions, &entry->node);
+		rn_ssl_session_delete(&entry->node);
+	}
+	pthread_mutex_unlock(&cache->mutex);
+}
+
+static int rn_ssl_cache_ticket_cb(SSL *ssl, unsigned char *name, unsigned char *iv, EVP_CIPHER_CTX *cctx, EVP_MAC_CTX *hctx, int enc)
+{
+	unsigned int i;
+	OSSL_PARAM params[3];
+	rn_ssl_ticket_key_t key;
+	rn_ssl_cache_t *cache = rn_ssl_cache_get(SSL_get_SSL_CTX(ssl));
+
+	pthread_mutex_lock(&cache->mutex);
+	if (rn_ssl_cache_rotate(cache) != 0) {
+		pthread_mutex_unlock(&cache->mutex);
+		return -1;
+	}
+	if (enc) {
+		i = 0;
+		key = cache->keys[0];
+	} else {
+		for (i = 0; i < cache->nbkeys; i++) {
+			if (memcmp(name, cache->keys[i].name, RN_SSL_TICKET_NAME) == 0) {
+				break;
+			}
+		}
+		if (i == cache->nbkeys) {
+			/* Unknown or expired key, full handshake */
+			pthread_mutex_unlock(&cache->mutex);
+			return 0;
+		}
+		key = cache->keys[i];
+	}
+	pthread_mutex_unlock(&cache->mutex);
+	params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac, sizeof(key.hmac));
+	params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, rn_ssl_ticket_digest, 0);
+	params[2] = OSSL_PARAM_construct_end();
+	if (enc) {
+		memcpy(name, key.name, RN_SSL_TICKET_NAME);
+		if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) <= 0 ||
+		    EVP_EncryptInit_ex(cctx, EVP_aes_256_cbc(), NULL, key.aes, iv) == 0 ||
+		    EVP_MAC_CTX_set_params(hctx, params) == 0) {
+			return -1;
+		}
+		return 1;
+	}
+	if (EVP_MAC_CTX_set_params(hctx, params) == 0 ||
+	    EVP_DecryptInit_ex(cctx, EVP_aes_256_cbc(), NULL, key.aes, iv) == 0) {
+		return -1;
+	}
+	/*
+	 * Tickets of the previous key are renewed with the current one.
+	 * TLSv1.3 clients use a ticket once, so a new one is always sent.
+	 */
+	return (i == 0 && SSL_version(ssl) < TLS1_3_VERSION ? 1 : 2);
+}
+
+/**
+ * Creates a TLS session cache. A cache is meant to be shared by the
+ * SSL contexts of every scheduler (spawns) of a process, so that a
+ * client resumes its session whichever thread accepts it.
+ * Server sessions are stored by id, ticket keys are shared and rotated,
+ * and client sessions are stored per destination address.
+ *
+ * @param size Maximum number of sessions, for each of server and client sides
+ * @param timeout Session lifetime in seconds
+ * @param rotation Ticket key rotation period in seconds, 0 to never rotate
+ *
+ * @return Pointer to the new cache or NULL if an error occurs
+ */
+rn_ssl_cache_t *rn_ssl_cache(size_t size, uint32_t timeout, uint32_t rotation)
+{
+	rn_ssl_cache_t *cache;
+
+	XASSERT(size > 0, NULL);
+
+	cache = rn_calloc(1, sizeof(*cache));
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->size = size;
+	cache->timeout = timeout;
+	cache->rotation = rotation;
+	if (pthread_mutex_init(&cache->mutex, NULL) != 0) {
+		rn_free(cache);
+		return NULL;
+	}
+	if (rn_hmap(&cache->sessions, 64, rn_ssl_session_hash, rn_ssl_session_cmp) != 0) {
+		pthread_mutex_destroy(&cache->mutex);
+		rn_free(cache);
+		return NULL;
+	}
+	if (rn_hmap(&cache->peers, 64, rn_ssl_session_hash, rn_ssl_session_cmp) != 0) {
+		rn_hmap_destroy(&cache->sessions);
+		pthread_mutex_destroy(&cache->mutex);
+		rn_free(cache);
+		return NULL;
+	}
+	rn_list(&cache->sessions_lru, NULL);
+	rn_list(&cache->peers_lru, NULL);
+	if (rn_ssl_cache_rotate(cache) != 0) {
+		rn_ssl_cache_destroy(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+/**
+ * Destroys a TLS session cache.
+ * SSL contexts using this cache must have been destroyed.
+ *
+ * @param cache Cache pointer
+ */
+void rn_ssl_cache_destroy(rn_ssl_cache_t *cache)
+{
+	XASSERTN(cache != NULL);
+
+	rn_hmap_flush(&cache->sessions, rn_ssl_session_delete);
+	rn_hmap_flush(&cache->peers, rn_ssl_session_delete);
+	rn_hmap_destroy(&cache->sessions);
+	rn_hmap_destroy(&cache->peers);
+	OPENSSL_cleanse(cache->keys, sizeof(cache->keys));
+	pthread_mutex_destroy(&cache->mutex);
+	rn_free(cache);
+}
+
+/**
+ * Makes a SSL context use a session cache.
+ * Must be called before any socket is created with this context.
+ *
+ * @param ctx SSL context
+ * @param cache Cache pointer
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_ssl_context_cache(rn_ssl_ctx_t *ctx, rn_ssl_cache_t *cache)
+{
+	XASSERT(ctx != NULL, -1);
+	XASSERT(cache != NULL, -1);
+
+	ctx->cache = cache;
+	if (SSL_CTX_set_session_id_context(ctx->ctx, (const unsigned char *) "rinoo", 5) == 0) {
+		return -1;
+	}
+	SSL_CTX_set_session_cache_mode(ctx->ctx, SSL_SESS_CACHE_BOTH | SSL_SESS_CACHE_NO_INTERNAL);
+	SSL_CTX_set_timeout(ctx->ctx, cache->timeout);
+	SSL_CTX_sess_set_new_cb(ctx->ctx, rn_ssl_cache_new_cb);
+	SSL_CTX_sess_set_get_cb(ctx->ctx, rn_ssl_cache_get_cb);
+	SSL_CTX_sess_set_remove_cb(ctx->ctx, rn_ssl_cache_remove_cb);
+	if (SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx->ctx, rn_ssl_cache_ticket_cb) == 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * Gets session cache statistics.
+ * The resumption hit rate is resumed / handshakes.
+ *
+ * @param cache Cache pointer
+ * @param stats Pointer to the statistics to fill
+ */
+void rn_ssl_cache_stats(rn_ssl_cache_t *cache, rn_ssl_stats_t *stats)
+{
+	XASSERTN(cache != NULL);
+	XASSERTN(stats != NULL);
+
+	pthread_mutex_lock(&cache->mutex);
+	*stats = cache->stats;
+	pthread_mutex_unlock(&cache->mutex);
+}
+
+/**
+ * Sets the cached session of a destination on a client connection
+ * before its handshake.
+ *
+ * @param cache Cache pointer
+ * @param ssl OpenSSL connection
+ * @param dst Destination address
+ */
+void rn_ssl_cache_resume(rn_ssl_cache_t *cache, SSL *ssl, const rn_addr_t *dst)
+{
+	unsigned int keylen;
+	rn_ssl_session_t *entry;
+	unsigned char key[SSL_MAX_SSL_SESSION_ID_LENGTH];
+
+	keylen = rn_ssl_cache_peer_key(dst, key);
+	pthread_mutex_lock(&cache->mutex);
+	entry = rn_ssl_cache_lookup(&cache->peers, &cache->peers_lru, key, keylen);
+	if (entry != NULL) {
+		/* The connection takes its own reference */
+		SSL_set_session(ssl, entry->session);
+	}
+	pthread_mutex_unlock(&cache->mutex);
+}
+
+/**
+ * Accounts a completed handshake in cache statistics.
+ *
+ * @param cache Cache pointer
+ * @param ssl OpenSSL connection
+ */
+void rn_ssl_cache_account(rn_ssl_cache_t *cache, SSL *ssl)
+{
+	pthread_mutex_lock(&cache->mutex);
+	cache->stats.handshakes++;
+	if (SSL_session_reused(ssl)) {
+		cache->stats.resumed++;
+	}
+	pthread_mutex_unlock(&cache->mutex);
+}
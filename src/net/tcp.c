@@ -19,10 +19,11 @@ extern const rn_socket_class_t socket_class_tcp6;
  * @param sched Scheduler pointer
  * @param dst Destination address to connect to
  * @param timeout Socket timeout
+ * @param opts Socket options, or NULL
  *
  * @return Socket pointer on success or NULL if an error occurs
  */
-rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout)
+rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout, const rn_socket_opts_t *opts)
 {
 	rn_socket_t *socket;
 
@@ -34,6 +35,10 @@ rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout)
 		rn_socket_destroy(socket);
 		return NULL;
 	}
+	if (opts != NULL && rn_socket_setopt(socket, opts) != 0) {
+		rn_socket_destroy(socket);
+		return NULL;
+	}
 	if (rn_socket_connect(socket, dst) != 0) {
 		rn_socket_destroy(socket);
 		return NULL;
@@ -46,10 +51,11 @@ rn_socket_t *rn_tcp_client(rn_sched_t *sched, rn_addr_t *dst, uint32_t timeout)
  *
  * @param sched Scheduler pointer
  * @param dst Address to bind
+ * @param opts Socket options, inherited by accepted sockets, or NULL
  *
  * @return Socket pointer to the server on success or NULL if an error occurs
  */
-rn_socket_t *rn_tcp_server(rn_sched_t *sched, rn_addr_t *dst)
+rn_socket_t *rn_tcp_server(rn_sched_t *sched, rn_addr_t *dst, const rn_socket_opts_t *opts)
 {
 	rn_socket_t *socket;
 
@@ -61,5 +67,9 @@ rn_socket_t *rn_tcp_server(rn_sched_t *sched, rn_addr_t *dst)
 		rn_socket_destroy(socket);
 		return NULL;
 	}
+	if (opts != NULL && rn_socket_setopt(socket, opts) != 0) {
+		rn_socket_destroy(socket);
+		return NULL;
+	}
 	return socket;
 }
@@ -0,0 +1,414 @@
+/**
+ * @file   tcp_pool.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Keep-alive TCP connection pool
+ *
+ *
+ */
+
+#include "rinoo/net/module.h"
+
+typedef struct rn_tcp_pool_waiter_s {
+	bool woken;
+	uint64_t ticket;
+	rn_task_t *task;
+	rn_tcp_conn_t *conn;
+	rn_list_node_t lnode;
+} rn_tcp_pool_waiter_t;
+
+static uint64_t rn_tcp_pool_host_hash(rn_hmap_node_t *node)
+{
+	rn_tcp_pool_host_t *host = container_of(node, rn_tcp_pool_host_t, node);
+
+	if (IS_IPV6(&host->addr)) {
+		return rn_hash_u64(host->addr.v6.sin6_port, rn_hash_default(&host->addr.v6.sin6_addr, sizeof(host->addr.v6.sin6_addr)));
+	}
+	return rn_hash_u64(host->addr.v4.sin_port, rn_hash_default(&host->addr.v4.sin_addr, sizeof(host->addr.v4.sin_addr)));
+}
+
+static int rn_tcp_pool_host_cmp(rn_hmap_node_t *node1, rn_hmap_node_t *node2)
+{
+	rn_tcp_pool_host_t *host1 = container_of(node1, rn_tcp_pool_host_t, node);
+	rn_tcp_pool_host_t *host2 = container_of(node2, rn_tcp_pool_host_t, node);
+
+	if (host1->addr.sa.sa_family != host2->addr.sa.sa_family) {
+		return (host1->addr.sa.sa_family > host2->addr.sa.sa_family ? 1 : -1);
+	}
+	if (IS_IPV6(&host1->addr)) {
+		if (host1->addr.v6.sin6_port != host2->addr.v6.sin6_port) {
+			return (host1->addr.v6.sin6_port > host2->addr.v6.sin6_port ? 1 : -1);
+		}
+		return memcmp(&host1->addr.v6.sin6_addr, &host2->addr.v6.sin6_addr, sizeof(host1->addr.v6.sin6_addr));
+	}
+	if (host1->addr.v4.sin_port != host2->addr.v4.sin_port) {
+		return (host1->addr.v4.sin_port > host2->addr.v4.sin_port ? 1 : -1);
+	}
+	return memcmp(&host1->addr.v4.sin_addr, &host2->addr.v4.sin_addr, sizeof(host1->addr.v4.sin_addr));
+}
+
+static int rn_tcp_pool_waiter_cmp(rn_list_node_t *node1, rn_list_node_t *node2)
+{
+	rn_tcp_pool_waiter_t *waiter1 = container_of(node1, rn_tcp_pool_waiter_t, lnode);
+	rn_tcp_pool_waiter_t *waiter2 = container_of(node2, rn_tcp_pool_waiter_t, lnode);
+
+	/* Newest first, the oldest waiter is at tail */
+	if (waiter1->ticket == waiter2->ticket) {
+		return 0;
+	}
+	return (waiter1->ticket > waiter2->ticket ? -1 : 1);
+}
+
+/**
+ * Creates a connection pool. Connections are kept per destination
+ * address and only used by tasks of the given scheduler.
+ * Connect timeout, socket options and TLS context can be set afterwards
+ * through the timeout, opts and ssl fields. Socket options only apply
+ * to plain TCP connections.
+ *
+ * @param sched Scheduler pointer
+ * @param max_idle Maximum idle connections per destination
+ * @param max_total Maximum connections per destination, idle or in use
+ * @param idle_timeout Time in milliseconds after which an idle connection is closed
+ *
+ * @return Pointer to the new pool or NULL if an error occurs
+ */
+rn_tcp_pool_t *rn_tcp_pool(rn_sched_t *sched, unsigned int max_idle, unsigned int max_total, uint32_t idle_timeout)
+{
+	rn_tcp_pool_t *pool;
+
+	XASSERT(sched != NULL, NULL);
+	XASSERT(max_total > 0, NULL);
+
+	pool = rn_calloc(1, sizeof(*pool));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->sched = sched;
+	pool->max_idle = max_idle;
+	pool->max_total = max_total;
+	pool->idle_timeout = idle_timeout;
+	if (rn_hmap(&pool->hosts, 8, rn_tcp_pool_host_hash, rn_tcp_pool_host_cmp) != 0 ||
+	    rn_list(&pool->idle, NULL) != 0) {
+		rn_free(pool);
+		return NULL;
+	}
+	return pool;
+}
+
+/**
+ * Wakes up the oldest task waiting for a destination, if any.
+ * Without connection, the task opens a new one in the freed slot.
+ *
+ * @param host Destination to use
+ * @param conn Connection handed over to the task, or NULL
+ *
+ * @return true if a task has been woken up, otherwise false
+ */
+static bool rn_tcp_pool_wakeup(rn_tcp_pool_host_t *host, rn_tcp_conn_t *conn)
+{
+	rn_list_node_t *lnode;
+	rn_tcp_pool_waiter_t *waiter;
+
+	/* Waiters are queued at head, the oldest one is at tail */
+	lnode = host->waiters.tail;
+	if (lnode == NULL) {
+		return false;
+	}
+	rn_list_remove(&host->waiters, lnode);
+	waiter = container_of(lnode, rn_tcp_pool_waiter_t, lnode);
+	waiter->conn = conn;
+	waiter->woken = true;
+	rn_task_schedule(waiter->task, NULL);
+	return true;
+}
+
+/**
+ * Releases a connection slot and hands it over to a waiting task.
+ *
+ * @param host Destination owning the slot
+ */
+static void rn_tcp_pool_release(rn_tcp_pool_host_t *host)
+{
+	host->nbtotal--;
+	rn_tcp_pool_wakeup(host, NULL);
+}
+
+/**
+ * Closes a connection and releases its slot.
+ *
+ * @param conn Connection to close
+ */
+static void rn_tcp_pool_close(rn_tcp_conn_t *conn)
+{
+	rn_tcp_pool_host_t *host = conn->host;
+
+	rn_socket_destroy(conn->socket);
+	rn_slab_free(conn);
+	rn_tcp_pool_release(host);
+}
+
+static void rn_tcp_pool_host_delete(rn_hmap_node_t *node)
+{
+	rn_list_node_t *lnode;
+	rn_tcp_conn_t *conn;
+	rn_tcp_pool_host_t *host = container_of(node, rn_tcp_pool_host_t, node);
+
+	while ((lnode = rn_list_pop(&host->idle)) != NULL) {
+		conn = container_of(lnode, rn_tcp_conn_t, hnode);
+		rn_socket_destroy(conn->socket);
+		rn_slab_free(conn);
+	}
+	rn_free(host);
+}
+
+/**
+ * Destroys a connection pool and closes idle connections.
+ * Connections still checked out must not be put back afterwards,
+ * and no task must be waiting on the pool.
+ *
+ * @param pool Pool to destroy
+ */
+void rn_tcp_pool_destroy(rn_tcp_pool_t *pool)
+{
+	XASSERTN(pool != NULL);
+
+	if (pool->reaper != NULL) {
+		rn_task_destroy(pool->reaper);
+		pool->reaper = NULL;
+	}
+	rn_hmap_flush(&pool->hosts, rn_tcp_pool_host_delete);
+	rn_hmap_destroy(&pool->hosts);
+	rn_free(pool);
+}
+
+/**
+ * Idle connections reaper task.
+ * Sleeps until the oldest idle connection expires and closes it.
+ * The task ends once no idle connection is left.
+ *
+ * @param arg Pointer to the pool
+ */
+static void rn_tcp_pool_reaper(void *arg)
+{
+	struct timeval tv;
+	rn_tcp_conn_t *conn;
+	rn_list_node_t *lnode;
+	rn_tcp_pool_t *pool = arg;
+
+	/* Idle connections are queued at head, the oldest one is at tail */
+	while ((lnode = pool->idle.tail) != NULL) {
+		conn = container_of(lnode, rn_tcp_conn_t, pnode);
+		if (timercmp(&conn->expire, &pool->sched->clock, >)) {
+			timersub(&conn->expire, &pool->sched->clock, &tv);
+			if (rn_task_wait(pool->sched, tv.tv_sec * 1000 + tv.tv_usec / 1000 + 1) != 0) {
+				break;
+			}
+			continue;
+		}
+		rn_list_remove(&pool->idle, &conn->pnode);
+		rn_list_remove(&conn->host->idle, &conn->hnode);
+		rn_tcp_pool_close(conn);
+	}
+	pool->reaper = NULL;
+}
+
+/**
+ * Checks whether an idle connection is still usable.
+ * Idle sockets are watched for input: any event received while idle,
+ * peer close (EPOLLRDHUP), unexpected data or error, discards it.
+ *
+ * @param conn Idle connection
+ *
+ * @return true if the connection can be reused
+ */
+static bool rn_tcp_pool_healthy(rn_tcp_conn_t *conn)
+{
+	rn_sched_node_t *node = &conn->socket->node;
+
+	return (node->error == 0 && !rn_mode_received(node, RN_MODE_IN));
+}
+
+/**
+ * Prepares a connection to stay idle: makes sure nothing is pending
+ * on the socket and starts watching it for input.
+ *
+ * @param conn Connection to check in
+ *
+ * @return 0 on success or -1 if the connection cannot be reused
+ */
+static int rn_tcp_pool_watch(rn_tcp_conn_t *conn)
+{
+	char c;
+	rn_socket_t *socket = conn->socket;
+
+	if (socket->node.error != 0) {
+		return -1;
+	}
+	if (socket->class->pending != NULL && socket->class->pending(socket)) {
+		/* Data buffered by the socket class, such as TLS records */
+		return -1;
+	}
+	if (recv(socket->node.fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) >= 0 || errno != EAGAIN) {
+		/* Unread data, end of stream or error */
+		return -1;
+	}
+	return rn_scheduler_watch(&socket->node, RN_MODE_IN);
+}
+
+/**
+ * Finds or creates a destination entry.
+ *
+ * @param pool Pool to use
+ * @param dst Destination address
+ *
+ * @return Pointer to the destination entry or NULL if an error occurs
+ */
+static rn_tcp_pool_host_t *rn_tcp_pool_host(rn_tcp_pool_t *pool, const rn_addr_t *dst)
+{
+	rn_hmap_node_t *node;
+	rn_tcp_pool_host_t dummy;
+	rn_tcp_pool_host_t *host;
+
+	dummy.addr = *dst;
+	node = rn_hmap_get(&pool->hosts, &dummy.node);
+	if (node != NULL) {
+		return container_of(node, rn_tcp_pool_host_t, node);
+	}
+	host = rn_calloc(1, sizeof(*host));
+	if (host == NULL) {
+		return NULL;
+	}
+	host->addr = *dst;
+	host->pool = pool;
+	rn_list(&host->idle, NULL);
+	rn_list(&host->waiters, rn_tcp_pool_waiter_cmp);
+	if (rn_hmap_put(&pool->hosts, &host->node) != 0) {
+		rn_free(host);
+		return NULL;
+	}
+	return host;
+}
+
+/**
+ * Checks a connection out of the pool.
+ * The most recently used idle connection is returned first. Otherwise,
+ * a new connection is opened while below the total limit. Once the
+ * limit is reached, the task waits for a connection to be put back.
+ *
+ * @param pool Pool to use
+ * @param dst Destination address
+ *
+ * @return Pointer to the connection or NULL if an error occurs
+ */
+rn_tcp_conn_t *rn_tcp_pool_get(rn_tcp_pool_t *pool, const rn_addr_t *dst)
+{
+	rn_tcp_conn_t *conn;
+	rn_socket_t *socket;
+	rn_list_node_t *lnode;
+	rn_tcp_pool_host_t *host;
+	rn_tcp_pool_waiter_t waiter;
+
+	XASSERT(pool != NULL, NULL);
+	XASSERT(dst != NULL, NULL);
+
+	host = rn_tcp_pool_host(pool, dst);
+	if (host == NULL) {
+		return NULL;
+	}
+	waiter.woken = false;
+	while (true) {
+		while ((lnode = rn_list_pop(&host->idle)) != NULL) {
+			conn = container_of(lnode, rn_tcp_conn_t, hnode);
+			rn_list_remove(&pool->idle, &conn->pnode);
+			if (rn_tcp_pool_healthy(conn)) {
+				return conn;
+			}
+			rn_tcp_pool_close(conn);
+		}
+		if (host->nbtotal < pool->max_total) {
+			break;
+		}
+		if (!waiter.woken) {
+			waiter.ticket = host->ticket++;
+		}
+		/* A waiter woken without connection keeps its place */
+		waiter.woken = false;
+		waiter.conn = NULL;
+		waiter.task = rn_task_self();
+		rn_list_put(&host->waiters, &waiter.lnode);
+		if (rn_task_release(pool->sched) != 0 || !waiter.woken) {
+			/* Deadline expired or task cancelled */
+			if (!waiter.woken) {
+				rn_list_remove(&host->waiters, &waiter.lnode);
+			} else if (waiter.conn != NULL) {
+				rn_tcp_pool_put(waiter.conn, true);
+			} else {
+				/* The freed slot goes to the next waiter */
+				rn_tcp_pool_wakeup(host, NULL);
+			}
+			return NULL;
+		}
+		if (waiter.conn != NULL) {
+			return waiter.conn;
+		}
+	}
+	conn = rn_slab_calloc(&pool->sched->slab, sizeof(*conn));
+	if (conn == NULL) {
+		return NULL;
+	}
+	conn->host = host;
+	host->nbtotal++;
+	if (pool->ssl != NULL) {
+		socket = rn_ssl_client(pool->sched, pool->ssl, &host->addr, pool->timeout);
+	} else {
+		socket = rn_tcp_client(pool->sched, &host->addr, pool->timeout, pool->opts);
+	}
+	if (socket == NULL) {
+		rn_slab_free(conn);
+		rn_tcp_pool_release(host);
+		return NULL;
+	}
+	conn->socket = socket;
+	return conn;
+}
+
+/**
+ * Puts a connection back into the pool. Reusable connections go to a
+ * waiting task if any, otherwise they stay idle up to the idle limit.
+ * Connections left in an unknown state (partial exchange, error) must
+ * not be reused.
+ *
+ * @param conn Connection to put back
+ * @param reuse Whether the connection can be used again
+ */
+void rn_tcp_pool_put(rn_tcp_conn_t *conn, bool reuse)
+{
+	rn_tcp_pool_host_t *host = conn->host;
+	rn_tcp_pool_t *pool = host->pool;
+
+	if (!reuse || rn_tcp_pool_watch(conn) != 0) {
+		rn_tcp_pool_close(conn);
+		return;
+	}
+	if (rn_tcp_pool_wakeup(host, conn)) {
+		return;
+	}
+	if (rn_list_size(&host->idle) >= pool->max_idle) {
+		rn_tcp_pool_close(conn);
+		return;
+	}
+	conn->expire.tv_sec = pool->idle_timeout / 1000;
+	conn->expire.tv_usec = (pool->idle_timeout % 1000) * 1000;
+	timeradd(&pool->sched->clock, &conn->expire, &conn->expire);
+	rn_list_put(&host->idle, &conn->hnode);
+	rn_list_put(&pool->idle, &conn->pnode);
+	if (pool->reaper == NULL) {
+		pool->reaper = rn_task(pool->sched, &pool->sched->driver.main, rn_tcp_pool_reaper, pool);
+		if (pool->reaper != NULL && rn_task_schedule(pool->reaper, NULL) != 0) {
+			rn_task_destroy(pool->reaper);
+			pool->reaper = NULL;
+		}
+	}
+}
@@ -0,0 +1,97 @@
+/**
+ * @file   rn_socket_iobuf.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for chained buffer read and write functions.
+ *
+ *
+ */
+#include "rinoo/rinoo.h"
+
+#define DATA_SIZE	(1024 * 1024 + 42)
+
+extern const rn_socket_class_t socket_class_tcp;
+
+static char data[DATA_SIZE];
+
+void process_client(void *arg)
+{
+	rn_iobuf_t iobuf;
+	rn_socket_t *socket = arg;
+
+	rn_log("server - client accepted");
+	XTEST(rn_iobuf(&iobuf) == 0);
+	XTEST(rn_iobuf_add(&iobuf, data, DATA_SIZE) == 0);
+	rn_log("server - sending %d bytes", DATA_SIZE);
+	XTEST(rn_socket_writeio(socket, &iobuf) == DATA_SIZE);
+	rn_iobuf_destroy(&iobuf);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	server = rn_socket(sched, &socket_class_tcp);
+	XTEST(server != NULL);
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	XTEST(rn_socket_bind(server, &addr, 42) == 0);
+	rn_log("server listening...");
+	client = rn_socket_accept(server, &addr);
+	XTEST(client != NULL);
+	rn_task_start(sched, process_client, client);
+	rn_socket_destroy(server);
+}
+
+void client_func(void *arg)
+{
+	rn_addr_t addr;
+	rn_iobuf_t iobuf;
+	rn_buffer_t *buffer;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+
+	socket = rn_socket(sched, &socket_class_tcp);
+	XTEST(socket != NULL);
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	XTEST(rn_socket_connect(socket, &addr) == 0);
+	rn_log("client - connected");
+	XTEST(rn_iobuf(&iobuf) == 0);
+	while (rn_iobuf_size(&iobuf) < DATA_SIZE) {
+		XTEST(rn_socket_readio(socket, &iobuf) > 0);
+	}
+	XTEST(rn_iobuf_size(&iobuf) == DATA_SIZE);
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(rn_iobuf_flatten(&iobuf, buffer) == 0);
+	XTEST(memcmp(rn_buffer_ptr(buffer), data, DATA_SIZE) == 0);
+	rn_buffer_destroy(buffer);
+	rn_iobuf_destroy(&iobuf);
+	rn_socket_destroy(socket);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	rn_sched_t *sched;
+
+	for (i = 0; i < DATA_SIZE; i++) {
+		data[i] = 'a' + (i % 26);
+	}
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
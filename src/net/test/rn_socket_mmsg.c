@@ -0,0 +1,161 @@
+/**
+ * @file   rn_socket_mmsg.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for recvmmsg/sendmmsg functions.
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define NB_DGRAMS	100
+#define DGRAM_SIZE	128
+#define GSO_SEGMENT	100
+#define GSO_COUNT	10
+
+extern const rn_socket_class_t socket_class_udp;
+
+/* Task stacks are small, buffers are kept out of them */
+static char server_bufs[RN_SOCKET_MMSG_MAX][DGRAM_SIZE];
+static rn_dgram_t server_dgrams[RN_SOCKET_MMSG_MAX];
+static char client_bufs[NB_DGRAMS][DGRAM_SIZE];
+static char client_gso[GSO_SEGMENT * GSO_COUNT];
+static rn_dgram_t client_dgrams[NB_DGRAMS];
+
+static void fill(char *buf, size_t size, int seed)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		buf[i] = (char) (seed + i);
+	}
+}
+
+void server_func(void *arg)
+{
+	int i;
+	int ret;
+	int received;
+	char expected[DGRAM_SIZE];
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_dgram_t *dgrams = server_dgrams;
+	rn_sched_t *sched = arg;
+
+	server = rn_socket(sched, &socket_class_udp);
+	XTEST(server != NULL);
+	rn_addr4(&addr, "127.0.0.1", 4251);
+	XTEST(rn_socket_bind(server, &addr, 0) == 0);
+	for (i = 0; i < RN_SOCKET_MMSG_MAX; i++) {
+		dgrams[i].buf = server_bufs[i];
+		dgrams[i].size = DGRAM_SIZE;
+	}
+	rn_log("server - receiving %d datagrams", NB_DGRAMS);
+	received = 0;
+	while (received < NB_DGRAMS) {
+		/* Count is clamped to RN_SOCKET_MMSG_MAX */
+		ret = rn_socket_recvmmsg(server, dgrams, NB_DGRAMS - received);
+		XTEST(ret > 0 && ret <= RN_SOCKET_MMSG_MAX);
+		for (i = 0; i < ret; i++, received++) {
+			XTEST(dgrams[i].len == (size_t) (received % DGRAM_SIZE) + 1);
+			XTEST(dgrams[i].segment == 0);
+			XTEST(dgrams[i].truncated == false);
+			XTEST(IS_IPV4(&dgrams[i].addr));
+			XTEST(dgrams[i].addr.v4.sin_addr.s_addr == htonl(INADDR_LOOPBACK));
+			fill(expected, dgrams[i].len, received);
+			XTEST(memcmp(dgrams[i].buf, expected, dgrams[i].len) == 0);
+		}
+	}
+	rn_log("server - receiving %d segmented datagrams", GSO_COUNT);
+	received = 0;
+	while (received < GSO_COUNT) {
+		ret = rn_socket_recvmmsg(server, dgrams, GSO_COUNT - received);
+		XTEST(ret > 0);
+		for (i = 0; i < ret; i++, received++) {
+			XTEST(dgrams[i].len == GSO_SEGMENT);
+			fill(expected, GSO_SEGMENT, received * GSO_SEGMENT);
+			XTEST(memcmp(dgrams[i].buf, expected, GSO_SEGMENT) == 0);
+		}
+	}
+	rn_log("server - receiving datagrams sent before a failure");
+	received = 0;
+	while (received < 2) {
+		ret = rn_socket_recvmmsg(server, dgrams, 2 - received);
+		XTEST(ret > 0);
+		for (i = 0; i < ret; i++, received++) {
+			XTEST(dgrams[i].len == (size_t) received + 1);
+		}
+	}
+	rn_log("server - receiving a truncated datagram");
+	XTEST(rn_socket_recvmmsg(server, dgrams, 1) == 1);
+	XTEST(dgrams[0].len == DGRAM_SIZE);
+	XTEST(dgrams[0].truncated == true);
+	fill(expected, DGRAM_SIZE, 0);
+	XTEST(memcmp(dgrams[0].buf, expected, DGRAM_SIZE) == 0);
+	rn_socket_destroy(server);
+}
+
+void client_func(void *arg)
+{
+	int i;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_dgram_t *dgrams = client_dgrams;
+	rn_sched_t *sched = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4251);
+	socket = rn_udp_client(sched, &addr);
+	XTEST(socket != NULL);
+	memset(client_dgrams, 0, sizeof(client_dgrams));
+	for (i = 0; i < NB_DGRAMS; i++) {
+		dgrams[i].buf = client_bufs[i];
+		dgrams[i].len = (i % DGRAM_SIZE) + 1;
+		fill(client_bufs[i], dgrams[i].len, i);
+		/* Half of them use the connected address */
+		if (i % 2 == 0) {
+			dgrams[i].addr = addr;
+		}
+	}
+	rn_log("client - sending %d datagrams", NB_DGRAMS);
+	XTEST(rn_socket_sendmmsg(socket, dgrams, NB_DGRAMS) == NB_DGRAMS);
+	rn_log("client - sending %d segmented datagrams", GSO_COUNT);
+	fill(client_gso, sizeof(client_gso), 0);
+	dgrams[0].buf = client_gso;
+	dgrams[0].len = sizeof(client_gso);
+	dgrams[0].segment = GSO_SEGMENT;
+	XTEST(rn_socket_sendmmsg(socket, dgrams, 1) == 1);
+	rn_log("client - sending datagrams followed by an invalid one");
+	dgrams[0].buf = client_bufs[0];
+	dgrams[0].len = 1;
+	dgrams[0].segment = 0;
+	dgrams[1].buf = client_bufs[1];
+	dgrams[1].len = 2;
+	dgrams[2].addr.sa.sa_family = AF_INET6;
+	XTEST(rn_socket_sendmmsg(socket, dgrams, 3) == 2);
+	XTEST(rn_socket_sendmmsg(socket, &dgrams[2], 1) == -1);
+	rn_log("client - sending a datagram larger than the server buffer");
+	dgrams[0].buf = client_gso;
+	dgrams[0].len = DGRAM_SIZE * 2;
+	XTEST(rn_socket_sendmmsg(socket, dgrams, 1) == 1);
+	rn_socket_destroy(socket);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -37,7 +37,7 @@ void server_func(void *unused(arg))
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	server = rn_tcp_server(rn_scheduler_self(), &addr);
+	server = rn_tcp_server(rn_scheduler_self(), &addr, NULL);
 	XTEST(server != NULL);
 	client = rn_socket_accept(server, NULL);
 	XTEST(client != NULL);
@@ -53,7 +53,7 @@ void client_func(void *unused(arg))
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	client = rn_tcp_client(rn_scheduler_self(), &addr, 0);
+	client = rn_tcp_client(rn_scheduler_self(), &addr, 0, NULL);
 	XTEST(client != NULL);
 	str = malloc(sizeof(*str) * TRANSFER_SIZE);
 	XTEST(str != NULL);
@@ -0,0 +1,120 @@
+/**
+ * @file   rn_socket_setopt.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for TCP socket options.
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+static int getint(rn_socket_t *socket, int level, int name)
+{
+	int value;
+	socklen_t size;
+
+	size = sizeof(value);
+	XTEST(getsockopt(socket->node.fd, level, name, &value, &size) == 0);
+	return value;
+}
+
+void server_func(void *arg)
+{
+	char b;
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+	rn_socket_opts_t opts = {
+		.nodelay = true,
+		.cork = true,
+		.keepalive = true,
+		.keepidle = 30,
+		.keepintvl = 5,
+		.keepcnt = 3,
+		.fastopen = 16,
+		.defer_accept = 1,
+		.notsent_lowat = 16384,
+		.sndbuf = 65536,
+		.rcvbuf = 65536,
+	};
+
+	rn_addr4(&addr, "127.0.0.1", 4253);
+	server = rn_tcp_server(sched, &addr, &opts);
+	XTEST(server != NULL);
+	XTEST(getint(server, IPPROTO_TCP, TCP_FASTOPEN) == 16);
+	XTEST(getint(server, IPPROTO_TCP, TCP_DEFER_ACCEPT) > 0);
+	XTEST(getint(server, SOL_SOCKET, SO_KEEPALIVE) == 1);
+	XTEST(getint(server, IPPROTO_TCP, TCP_KEEPIDLE) == 30);
+	XTEST(getint(server, IPPROTO_TCP, TCP_KEEPINTVL) == 5);
+	XTEST(getint(server, IPPROTO_TCP, TCP_KEEPCNT) == 3);
+	XTEST(getint(server, IPPROTO_TCP, TCP_NOTSENT_LOWAT) == 16384);
+	/* The kernel doubles buffer sizes for bookkeeping */
+	XTEST(getint(server, SOL_SOCKET, SO_SNDBUF) >= 65536);
+	XTEST(getint(server, SOL_SOCKET, SO_RCVBUF) >= 65536);
+	rn_log("server listening...");
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	rn_socket_destroy(server);
+	/* Options are inherited by accepted sockets */
+	XTEST(getint(client, IPPROTO_TCP, TCP_NODELAY) == 1);
+	XTEST(getint(client, IPPROTO_TCP, TCP_CORK) == 1);
+	XTEST(getint(client, SOL_SOCKET, SO_KEEPALIVE) == 1);
+	XTEST(client->flags & RN_SOCKET_CORKED);
+	XTEST(rn_socket_read(client, &b, 1) == 1);
+	XTEST(b == 'a');
+	rn_log("server - sending 'b' corked");
+	XTEST(rn_socket_write(client, "b", 1) == 1);
+	XTEST(rn_socket_flush(client) == 0);
+	XTEST(getint(client, IPPROTO_TCP, TCP_CORK) == 1);
+	XTEST(rn_socket_read(client, &b, 1) == -1);
+	rn_socket_destroy(client);
+}
+
+void client_func(void *arg)
+{
+	char b;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+	rn_socket_opts_t opts = {
+		.nodelay = true,
+		.fastopen = 1,
+	};
+
+	rn_addr4(&addr, "127.0.0.1", 4253);
+	socket = rn_tcp_client(sched, &addr, 0, &opts);
+	XTEST(socket != NULL);
+	XTEST(getint(socket, IPPROTO_TCP, TCP_NODELAY) == 1);
+	XTEST(getint(socket, IPPROTO_TCP, TCP_FASTOPEN_CONNECT) == 1);
+	XTEST((socket->flags & RN_SOCKET_CORKED) == 0);
+	XTEST(rn_socket_flush(socket) == 0);
+	/* Deferred accept, the server wakes up with data */
+	XTEST(rn_socket_write(socket, "a", 1) == 1);
+	/* Corked data would be held up to 200ms without flush */
+	XTEST(rn_socket_timeout(socket, 100) == 0);
+	XTEST(rn_socket_read(socket, &b, 1) == 1);
+	XTEST(b == 'b');
+	rn_log("client - received 'b'");
+	rn_socket_destroy(socket);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
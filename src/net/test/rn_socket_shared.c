@@ -0,0 +1,106 @@
+/**
+ * @file   rn_socket_shared.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for shared buffer fan-out writes.
+ *
+ *
+ */
+#include "rinoo/rinoo.h"
+
+#define NB_CLIENTS	4
+#define PAYLOAD		"This payload is shared by every client\n"
+
+extern const rn_socket_class_t socket_class_tcp;
+
+static rn_buffer_t *payload;
+
+void process_client(void *arg)
+{
+	rn_buffer_t *ref;
+	rn_buffer_t *slices[2];
+	rn_socket_t *socket = arg;
+
+	ref = rn_buffer_ref(payload);
+	XTEST(ref != NULL);
+	XTEST(rn_buffer_ptr(ref) == rn_buffer_ptr(payload));
+	XTEST(rn_socket_writeb(socket, ref) == (ssize_t) rn_buffer_size(ref));
+	slices[0] = rn_buffer_slice(ref, 0, 5);
+	slices[1] = rn_buffer_slice(ref, 5, rn_buffer_size(ref) - 5);
+	XTEST(slices[0] != NULL);
+	XTEST(slices[1] != NULL);
+	rn_buffer_unref(ref);
+	XTEST(rn_socket_writev(socket, slices, 2) == (ssize_t) strlen(PAYLOAD));
+	rn_buffer_unref(slices[0]);
+	rn_buffer_unref(slices[1]);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	int i;
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	server = rn_socket(sched, &socket_class_tcp);
+	XTEST(server != NULL);
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	XTEST(rn_socket_bind(server, &addr, 42) == 0);
+	rn_log("server listening...");
+	for (i = 0; i < NB_CLIENTS; i++) {
+		client = rn_socket_accept(server, &addr);
+		XTEST(client != NULL);
+		rn_task_start(sched, process_client, client);
+	}
+	rn_socket_destroy(server);
+}
+
+void client_func(void *arg)
+{
+	rn_addr_t addr;
+	rn_buffer_t *buffer;
+	rn_socket_t *socket;
+	rn_sched_t *sched = arg;
+
+	socket = rn_socket(sched, &socket_class_tcp);
+	XTEST(socket != NULL);
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	XTEST(rn_socket_connect(socket, &addr) == 0);
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	while (rn_buffer_size(buffer) < 2 * strlen(PAYLOAD)) {
+		XTEST(rn_socket_readb(socket, buffer) > 0);
+	}
+	XTEST(rn_buffer_size(buffer) == 2 * strlen(PAYLOAD));
+	XTEST(memcmp(rn_buffer_ptr(buffer), PAYLOAD PAYLOAD, 2 * strlen(PAYLOAD)) == 0);
+	rn_buffer_destroy(buffer);
+	rn_socket_destroy(socket);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	rn_sched_t *sched;
+
+	payload = rn_buffer_shared(PAYLOAD, strlen(PAYLOAD));
+	XTEST(payload != NULL);
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	for (i = 0; i < NB_CLIENTS; i++) {
+		XTEST(rn_task_start(sched, client_func, sched) == 0);
+	}
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XTEST(rn_buffer_refcount(payload) == 1);
+	rn_buffer_unref(payload);
+	XPASS();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file   rn_ssl_cache.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for TLS session resumption through a shared cache
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define TICKET_PORT	4257
+#define STATEFUL_PORT	4258
+
+typedef struct server_s {
+	rn_ssl_ctx_t *ctx;
+	uint16_t port;
+	int count;
+} server_t;
+
+rn_sched_t *sched;
+static rn_ssl_cache_t *cache;
+static rn_ssl_cache_t *clients;
+static rn_ssl_ctx_t *server_ctx[2];
+static rn_ssl_ctx_t *client_ctx;
+static server_t server;
+
+void server_func(void *arg)
+{
+	int i;
+	char b;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+	rn_socket_t *client;
+	server_t *params = arg;
+
+	rn_addr4(&addr, "127.0.0.1", params->port);
+	socket = rn_ssl_server(sched, params->ctx, &addr);
+	XTEST(socket != NULL);
+	for (i = 0; i < params->count; i++) {
+		client = rn_socket_accept(socket, NULL);
+		XTEST(client != NULL);
+		XTEST(rn_socket_read(client, &b, 1) == 1);
+		XTEST(rn_socket_write(client, &b, 1) == 1);
+		rn_socket_destroy(client);
+	}
+	rn_socket_destroy(socket);
+}
+
+static void start_server(rn_ssl_ctx_t *ctx, uint16_t port, int count)
+{
+	server.ctx = ctx;
+	server.port = port;
+	server.count = count;
+	XTEST(rn_task_start(sched, server_func, &server) == 0);
+	/* Lets the server listen */
+	rn_task_wait(sched, 10);
+}
+
+static bool exchange(uint16_t port)
+{
+	char b;
+	bool reused;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+
+	rn_addr4(&addr, "127.0.0.1", port);
+	socket = rn_ssl_client(sched, client_ctx, &addr, 0);
+	XTEST(socket != NULL);
+	XTEST(rn_socket_write(socket, "x", 1) == 1);
+	/* Session tickets are received along with the answer */
+	XTEST(rn_socket_read(socket, &b, 1) == 1);
+	XTEST(b == 'x');
+	reused = SSL_session_reused(rn_ssl_get(socket)->ssl);
+	rn_socket_destroy(socket);
+	return reused;
+}
+
+void client_func(void *unused(arg))
+{
+	rn_ssl_stats_t stats;
+	unsigned char name[RN_SSL_TICKET_NAME];
+
+	rn_log("client - stateless tickets");
+	start_server(server_ctx[0], TICKET_PORT, 2);
+	XTEST(exchange(TICKET_PORT) == false);
+	XTEST(exchange(TICKET_PORT) == true);
+	/* Another context sharing the cache, as another spawn would do */
+	start_server(server_ctx[1], TICKET_PORT, 2);
+	XTEST(exchange(TICKET_PORT) == true);
+	rn_log("client - ticket key rotation");
+	memcpy(name, cache->keys[0].name, sizeof(name));
+	rn_task_wait(sched, 1100);
+	XTEST(exchange(TICKET_PORT) == true);
+	XTEST(cache->nbkeys == 2);
+	XTEST(memcmp(cache->keys[0].name, name, sizeof(name)) != 0);
+	XTEST(memcmp(cache->keys[1].name, name, sizeof(name)) == 0);
+	rn_log("client - stateful sessions");
+	SSL_CTX_set_options(server_ctx[0]->ctx, SSL_OP_NO_TICKET);
+	start_server(server_ctx[0], STATEFUL_PORT, 2);
+	XTEST(exchange(STATEFUL_PORT) == false);
+	XTEST(exchange(STATEFUL_PORT) == true);
+	rn_ssl_cache_stats(cache, &stats);
+	rn_log("server - %lu handshakes, %lu resumed, %lu hits, %lu misses",
+	       stats.handshakes, stats.resumed, stats.hits, stats.misses);
+	XTEST(stats.handshakes == 6);
+	XTEST(stats.resumed == 4);
+	XTEST(stats.hits == 1);
+	XTEST(rn_list_size(&cache->sessions_lru) > 0);
+	rn_ssl_cache_stats(clients, &stats);
+	XTEST(stats.handshakes == 6);
+	XTEST(stats.resumed == 4);
+	XTEST(rn_list_size(&clients->peers_lru) == 2);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+
+	rn_ssl_init();
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	cache = rn_ssl_cache(64, RN_SSL_CACHE_TIMEOUT, 1);
+	XTEST(cache != NULL);
+	clients = rn_ssl_cache(64, RN_SSL_CACHE_TIMEOUT, 0);
+	XTEST(clients != NULL);
+	for (i = 0; i < 2; i++) {
+		server_ctx[i] = rn_ssl_context(2048);
+		XTEST(server_ctx[i] != NULL);
+		XTEST(rn_ssl_context_cache(server_ctx[i], cache) == 0);
+	}
+	client_ctx = rn_ssl_context(2048);
+	XTEST(client_ctx != NULL);
+	XTEST(rn_ssl_context_cache(client_ctx, clients) == 0);
+	XTEST(rn_task_start(sched, client_func, NULL) == 0);
+	rn_scheduler_loop(sched);
+	for (i = 0; i < 2; i++) {
+		rn_ssl_context_destroy(server_ctx[i]);
+	}
+	rn_ssl_context_destroy(client_ctx);
+	rn_ssl_cache_destroy(cache);
+	rn_ssl_cache_destroy(clients);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
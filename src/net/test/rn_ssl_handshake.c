@@ -0,0 +1,144 @@
+/**
+ * @file   rn_ssl_handshake.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for lazy TLS handshake on accepted sockets
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define NBSTALLED		2
+#define NBCLIENTS		4
+#define HANDSHAKE_TIMEOUT	1000
+
+rn_sched_t *sched;
+static int nbaccepted;
+static int nbdone;
+static int nbtimedout;
+
+void process_client(void *arg)
+{
+	char b;
+	int ret;
+	bool explicit;
+	rn_socket_t *socket = arg;
+
+	XTEST(rn_ssl_get(socket)->flags & RN_SSL_HANDSHAKE);
+	/* Every other connection relies on the implicit handshake at first read */
+	explicit = (nbaccepted++ % 2 == 0);
+	if (explicit) {
+		ret = rn_ssl_handshake(socket);
+	} else {
+		ret = (rn_socket_read(socket, &b, 1) == 1 ? 0 : -1);
+	}
+	if (ret != 0) {
+		XTEST(rn_error == ETIMEDOUT);
+		/* Other clients have been served meanwhile */
+		XTEST(nbdone == NBCLIENTS);
+		rn_log("server - stalled handshake timed out");
+		nbtimedout++;
+		rn_socket_destroy(socket);
+		return;
+	}
+	XTEST((rn_ssl_get(socket)->flags & RN_SSL_HANDSHAKE) == 0);
+	if (explicit) {
+		XTEST(rn_socket_read(socket, &b, 1) == 1);
+	}
+	XTEST(rn_socket_write(socket, &b, 1) == 1);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	int i;
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_socket_t *server;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4256);
+	server = rn_ssl_server(sched, ctx, &addr);
+	XTEST(server != NULL);
+	rn_log("server listening...");
+	for (i = 0; i < NBSTALLED + NBCLIENTS; i++) {
+		client = rn_socket_accept(server, NULL);
+		XTEST(client != NULL);
+		XTEST(rn_task_start(sched, process_client, client) == 0);
+	}
+	rn_socket_destroy(server);
+}
+
+void stalled_func(void *unused(arg))
+{
+	char b;
+	rn_addr_t addr;
+	rn_socket_t *socket;
+
+	rn_addr4(&addr, "127.0.0.1", 4256);
+	socket = rn_tcp_client(sched, &addr, 0, NULL);
+	XTEST(socket != NULL);
+	rn_log("stalled - connected, never sending a client hello");
+	XTEST(rn_socket_read(socket, &b, 1) <= 0);
+	rn_socket_destroy(socket);
+}
+
+void client_func(void *arg)
+{
+	char b;
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4256);
+	client = rn_ssl_client(sched, ctx, &addr, 0);
+	XTEST(client != NULL);
+	XTEST(rn_socket_write(client, "x", 1) == 1);
+	XTEST(rn_socket_read(client, &b, 1) == 1);
+	XTEST(b == 'x');
+	nbdone++;
+	rn_log("client - served (%d/%d)", nbdone, NBCLIENTS);
+	rn_socket_destroy(client);
+}
+
+void clients_func(void *arg)
+{
+	int i;
+
+	/* Lets stalled connections be accepted first */
+	rn_task_wait(sched, 10);
+	for (i = 0; i < NBCLIENTS; i++) {
+		XTEST(rn_task_start(sched, client_func, arg) == 0);
+	}
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	rn_ssl_ctx_t *ssl;
+
+	rn_ssl_init();
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	ssl = rn_ssl_context(2048);
+	XTEST(ssl != NULL);
+	ssl->handshake_timeout = HANDSHAKE_TIMEOUT;
+	XTEST(rn_task_start(sched, server_func, ssl) == 0);
+	for (i = 0; i < NBSTALLED; i++) {
+		XTEST(rn_task_start(sched, stalled_func, NULL) == 0);
+	}
+	XTEST(rn_task_start(sched, clients_func, ssl) == 0);
+	rn_scheduler_loop(sched);
+	XTEST(nbdone == NBCLIENTS);
+	XTEST(nbtimedout == NBSTALLED);
+	rn_ssl_context_destroy(ssl);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file   rn_ssl_sendfile.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for writev and sendfile on secure sockets
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define FILE_SIZE	(256 * 1024)
+
+rn_sched_t *sched;
+static char content[FILE_SIZE];
+
+static void ktls_log(const char *side, rn_socket_t *socket)
+{
+	rn_ssl_t *ssl = rn_ssl_get(socket);
+
+	rn_log("%s - kTLS tx: %s, rx: %s", side,
+	       (ssl->flags & RN_SSL_KTLS_TX ? "yes" : "no"),
+	       (ssl->flags & RN_SSL_KTLS_RX ? "yes" : "no"));
+}
+
+void process_client(void *arg)
+{
+	int fd;
+	char path[] = "/tmp/rn_ssl_sendfile.XXXXXX";
+	rn_buffer_t a;
+	rn_buffer_t b;
+	rn_buffer_t *buffers[2];
+	rn_socket_t *socket = arg;
+
+	XTEST(rn_ssl_handshake(socket) == 0);
+	ktls_log("server", socket);
+	fd = mkstemp(path);
+	XTEST(fd >= 0);
+	unlink(path);
+	XTEST(write(fd, content, sizeof(content)) == sizeof(content));
+	rn_log("server - sending 'hello world' with writev");
+	rn_buffer_static(&a, "hello ", 6);
+	rn_buffer_static(&b, "world", 5);
+	buffers[0] = &a;
+	buffers[1] = &b;
+	XTEST(rn_socket_writev(socket, buffers, 2) == 11);
+	rn_log("server - sending file from offset 1");
+	XTEST(rn_socket_sendfile(socket, fd, 1, FILE_SIZE - 1) == FILE_SIZE - 1);
+	close(fd);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_socket_t *server;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4255);
+	server = rn_ssl_server(sched, ctx, &addr);
+	XTEST(server != NULL);
+	rn_log("server listening...");
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	rn_task_start(sched, process_client, client);
+	rn_socket_destroy(server);
+}
+
+void client_func(void *arg)
+{
+	ssize_t ret;
+	size_t received;
+	char buf[4096];
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4255);
+	client = rn_ssl_client(sched, ctx, &addr, 0);
+	XTEST(client != NULL);
+	ktls_log("client", client);
+	received = 0;
+	while (received < 11) {
+		ret = rn_socket_read(client, buf + received, 11 - received);
+		XTEST(ret > 0);
+		received += ret;
+	}
+	XTEST(memcmp(buf, "hello world", 11) == 0);
+	rn_log("client - received 'hello world'");
+	received = 0;
+	while ((ret = rn_socket_read(client, buf, sizeof(buf))) > 0) {
+		XTEST(received + ret <= FILE_SIZE - 1);
+		XTEST(memcmp(buf, content + 1 + received, ret) == 0);
+		received += ret;
+	}
+	XTEST(received == FILE_SIZE - 1);
+	rn_log("client - received file");
+	rn_socket_destroy(client);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	rn_ssl_ctx_t *ssl;
+
+	for (i = 0; i < sizeof(content); i++) {
+		content[i] = (char) (i * 7 + i / 251);
+	}
+	rn_ssl_init();
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	ssl = rn_ssl_context(2048);
+	XTEST(ssl != NULL);
+	rn_task_start(sched, server_func, ssl);
+	rn_task_start(sched, client_func, ssl);
+	rn_scheduler_loop(sched);
+	rn_ssl_context_destroy(ssl);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,144 @@
+/**
+ * @file   rn_ssl_writev.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for TLS record coalescing and dynamic record sizing
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define NBSMALL		100
+#define SMALL_SIZE	10
+#define LARGE_SIZE	40000
+#define VECTOR_SIZE	(NBSMALL * SMALL_SIZE + LARGE_SIZE)
+#define STREAM_SIZE	(2 * RN_SSL_RECORD_BOOST)
+/* Encryption overhead, way above what any cipher adds */
+#define RECORD_OVERHEAD	256
+
+rn_sched_t *sched;
+static char content[STREAM_SIZE];
+static char received[STREAM_SIZE];
+static rn_buffer_t views[NBSMALL + 1];
+static rn_buffer_t *buffers[NBSMALL + 1];
+static size_t nbrecords;
+static size_t maxrecord;
+
+static void record_cb(int write_p, int unused(version), int content_type, const void *buf, size_t len, SSL *unused(ssl), void *unused(arg))
+{
+	size_t size;
+	const unsigned char *header = buf;
+
+	if (write_p == 0 && content_type == SSL3_RT_HEADER && len == SSL3_RT_HEADER_LENGTH) {
+		size = (header[3] << 8) | header[4];
+		nbrecords++;
+		if (size > maxrecord) {
+			maxrecord = size;
+		}
+	}
+}
+
+void process_client(void *arg)
+{
+	int i;
+	rn_socket_t *socket = arg;
+
+	for (i = 0; i < NBSMALL; i++) {
+		rn_buffer_static(&views[i], content + i * SMALL_SIZE, SMALL_SIZE);
+		buffers[i] = &views[i];
+	}
+	rn_buffer_static(&views[NBSMALL], content + NBSMALL * SMALL_SIZE, LARGE_SIZE);
+	buffers[NBSMALL] = &views[NBSMALL];
+	rn_log("server - sending %d small buffers and a large one", NBSMALL);
+	XTEST(rn_socket_writev(socket, buffers, NBSMALL + 1) == VECTOR_SIZE);
+	/* Record buffer is released once flushed */
+	XTEST(rn_ssl_get(socket)->record == NULL);
+	rn_log("server - sending %d bytes", STREAM_SIZE);
+	XTEST(rn_socket_write(socket, content, STREAM_SIZE) == STREAM_SIZE);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_socket_t *server;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4259);
+	server = rn_ssl_server(sched, ctx, &addr);
+	XTEST(server != NULL);
+	rn_log("server listening...");
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	rn_task_start(sched, process_client, client);
+	rn_socket_destroy(server);
+}
+
+static void receive(rn_socket_t *socket, size_t size)
+{
+	ssize_t ret;
+	size_t total;
+
+	for (total = 0; total < size; total += ret) {
+		ret = rn_socket_read(socket, received + total, size - total);
+		XTEST(ret > 0);
+	}
+}
+
+void client_func(void *arg)
+{
+	size_t expected;
+	rn_addr_t addr;
+	rn_socket_t *client;
+	rn_ssl_ctx_t *ctx = arg;
+
+	rn_addr4(&addr, "127.0.0.1", 4259);
+	client = rn_ssl_client(sched, ctx, &addr, 0);
+	XTEST(client != NULL);
+	SSL_set_msg_callback(rn_ssl_get(client)->ssl, record_cb);
+	receive(client, VECTOR_SIZE);
+	XTEST(memcmp(received, content, VECTOR_SIZE) == 0);
+	expected = (VECTOR_SIZE + RN_SSL_RECORD_SMALL - 1) / RN_SSL_RECORD_SMALL;
+	rn_log("client - %zu records, %zu expected, largest is %zu bytes", nbrecords, expected, maxrecord);
+	/* Session tickets may come along */
+	XTEST(nbrecords <= expected + 2);
+	XTEST(maxrecord <= RN_SSL_RECORD_SMALL + RECORD_OVERHEAD);
+	nbrecords = 0;
+	receive(client, STREAM_SIZE);
+	XTEST(memcmp(received, content, STREAM_SIZE) == 0);
+	expected = (STREAM_SIZE + RN_SSL_RECORD_MAX - 1) / RN_SSL_RECORD_MAX;
+	rn_log("client - %zu records, %zu expected, largest is %zu bytes", nbrecords, expected, maxrecord);
+	/* Past the first flight, plain writes use full size records */
+	XTEST(nbrecords <= expected + 2);
+	XTEST(maxrecord > RN_SSL_RECORD_MAX);
+	rn_socket_destroy(client);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	rn_ssl_ctx_t *ssl;
+
+	for (i = 0; i < sizeof(content); i++) {
+		content[i] = (char) (i * 7 + i / 251);
+	}
+	rn_ssl_init();
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	ssl = rn_ssl_context(2048);
+	XTEST(ssl != NULL);
+	rn_task_start(sched, server_func, ssl);
+	rn_task_start(sched, client_func, ssl);
+	rn_scheduler_loop(sched);
+	rn_ssl_context_destroy(ssl);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,292 @@
+/**
+ * @file   rn_tcp_pool.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for TCP connection pool.
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define MAX_IDLE	2
+#define MAX_TOTAL	3
+#define IDLE_TIMEOUT	200
+
+static int nbaccepted;
+static rn_addr_t addr;
+static rn_addr_t ssl_addr;
+static rn_ssl_ctx_t *ssl;
+static rn_tcp_pool_t *pool;
+static rn_tcp_conn_t *waited;
+static rn_addr_t closed_addr;
+static rn_tcp_pool_t *single;
+static rn_cancel_t cancel;
+static int nbfailed;
+
+void process_client(void *arg)
+{
+	char b;
+	rn_socket_t *socket = arg;
+
+	/* Echoes bytes, 'q' closes the connection */
+	while (rn_socket_read(socket, &b, 1) == 1 && b != 'q') {
+		XTEST(rn_socket_write(socket, &b, 1) == 1);
+	}
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *arg)
+{
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	server = rn_tcp_server(sched, &addr, NULL);
+	XTEST(server != NULL);
+	while ((client = rn_socket_accept(server, NULL)) != NULL) {
+		nbaccepted++;
+		XTEST(rn_task_start(sched, process_client, client) == 0);
+	}
+	rn_socket_destroy(server);
+}
+
+void ssl_server_func(void *arg)
+{
+	rn_socket_t *server;
+	rn_socket_t *client;
+	rn_sched_t *sched = arg;
+
+	server = rn_ssl_server(sched, ssl, &ssl_addr);
+	XTEST(server != NULL);
+	while ((client = rn_socket_accept(server, NULL)) != NULL) {
+		XTEST(rn_task_start(sched, process_client, client) == 0);
+	}
+	rn_socket_destroy(server);
+}
+
+static void echo(rn_tcp_conn_t *conn)
+{
+	char b;
+
+	XTEST(rn_socket_write(conn->socket, "x", 1) == 1);
+	XTEST(rn_socket_read(conn->socket, &b, 1) == 1);
+	XTEST(b == 'x');
+}
+
+void waiter_func(void *arg)
+{
+	rn_tcp_conn_t **conn = arg;
+
+	rn_log("waiter - waiting for a connection");
+	*conn = rn_tcp_pool_get(pool, &addr);
+	XTEST(*conn != NULL);
+	rn_log("waiter - got a connection");
+}
+
+void failing_func(void *unused(arg))
+{
+	XTEST(rn_tcp_pool_get(single, &closed_addr) == NULL);
+	nbfailed++;
+}
+
+void single_func(void *arg)
+{
+	rn_tcp_conn_t **conn = arg;
+
+	*conn = rn_tcp_pool_get(single, &addr);
+	XTEST(*conn != NULL);
+}
+
+void cancelled_func(void *unused(arg))
+{
+	XTEST(rn_cancel_attach(&cancel, rn_task_self()) == 0);
+	XTEST(rn_tcp_pool_get(single, &addr) == NULL);
+	XTEST(rn_error == ECANCELED);
+	rn_cancel_detach(rn_task_self());
+}
+
+static void single_slot(rn_sched_t *sched)
+{
+	rn_tcp_conn_t *conn;
+	rn_tcp_pool_host_t *host;
+
+	single = rn_tcp_pool(sched, MAX_IDLE, 1, IDLE_TIMEOUT);
+	XTEST(single != NULL);
+	rn_log("client - failed connection wakes up waiters");
+	nbfailed = 0;
+	XTEST(rn_task_start(sched, failing_func, NULL) == 0);
+	XTEST(rn_task_start(sched, failing_func, NULL) == 0);
+	rn_task_wait(sched, 100);
+	XTEST(nbfailed == 2);
+	rn_log("client - woken waiter failing hands its slot over");
+	conn = rn_tcp_pool_get(single, &addr);
+	XTEST(conn != NULL);
+	host = conn->host;
+	XTEST(rn_cancel(&cancel) == 0);
+	XTEST(rn_task_start(sched, cancelled_func, NULL) == 0);
+	rn_task_wait(sched, 10);
+	waited = NULL;
+	XTEST(rn_task_start(sched, single_func, &waited) == 0);
+	rn_task_wait(sched, 10);
+	XTEST(rn_list_size(&host->waiters) == 2);
+	/* The oldest waiter gets the slot but is cancelled before running */
+	rn_tcp_pool_put(conn, false);
+	rn_cancel_trigger(&cancel);
+	rn_task_wait(sched, 10);
+	XTEST(waited != NULL);
+	XTEST(host->nbtotal == 1);
+	rn_tcp_pool_put(waited, true);
+	rn_cancel_destroy(&cancel);
+	rn_tcp_pool_destroy(single);
+}
+
+static void ssl_client(rn_sched_t *sched)
+{
+	rn_tcp_conn_t *conn;
+	rn_tcp_pool_t *ssl_pool;
+
+	ssl_pool = rn_tcp_pool(sched, MAX_IDLE, MAX_TOTAL, IDLE_TIMEOUT);
+	XTEST(ssl_pool != NULL);
+	ssl_pool->ssl = ssl;
+	conn = rn_tcp_pool_get(ssl_pool, &ssl_addr);
+	XTEST(conn != NULL);
+	XTEST(conn->socket->class->pending != NULL);
+	echo(conn);
+	rn_tcp_pool_put(conn, true);
+	XTEST(rn_tcp_pool_get(ssl_pool, &ssl_addr) == conn);
+	echo(conn);
+	rn_tcp_pool_put(conn, true);
+	rn_tcp_pool_destroy(ssl_pool);
+}
+
+void client_func(void *arg)
+{
+	rn_addr_t other;
+	rn_tcp_conn_t *first;
+	rn_tcp_conn_t *second;
+	rn_tcp_pool_host_t *host;
+	rn_tcp_conn_t *conns[MAX_TOTAL];
+	rn_sched_t *sched = arg;
+
+	pool = rn_tcp_pool(sched, MAX_IDLE, MAX_TOTAL, IDLE_TIMEOUT);
+	XTEST(pool != NULL);
+	rn_log("client - connection reuse");
+	conns[0] = rn_tcp_pool_get(pool, &addr);
+	XTEST(conns[0] != NULL);
+	echo(conns[0]);
+	rn_tcp_pool_put(conns[0], true);
+	XTEST(rn_tcp_pool_get(pool, &addr) == conns[0]);
+	echo(conns[0]);
+	/* Destinations are matched on family, address and port only */
+	rn_tcp_pool_put(conns[0], true);
+	other = addr;
+	memset(other.v4.sin_zero, 0xff, sizeof(other.v4.sin_zero));
+	XTEST(rn_tcp_pool_get(pool, &other) == conns[0]);
+	XTEST(nbaccepted == 1);
+	host = conns[0]->host;
+	rn_log("client - total limit");
+	conns[1] = rn_tcp_pool_get(pool, &addr);
+	conns[2] = rn_tcp_pool_get(pool, &addr);
+	XTEST(conns[1] != NULL && conns[2] != NULL);
+	XTEST(host->nbtotal == MAX_TOTAL);
+	XTEST(rn_task_start(sched, waiter_func, &waited) == 0);
+	rn_task_wait(sched, 10);
+	XTEST(waited == NULL);
+	XTEST(rn_list_size(&host->waiters) == 1);
+	/* Handed over to the waiting task */
+	rn_tcp_pool_put(conns[0], true);
+	rn_task_wait(sched, 10);
+	XTEST(waited == conns[0]);
+	echo(waited);
+	XTEST(nbaccepted == MAX_TOTAL);
+	rn_log("client - waiters are served in order");
+	first = NULL;
+	second = NULL;
+	XTEST(rn_task_start(sched, waiter_func, &first) == 0);
+	rn_task_wait(sched, 10);
+	XTEST(rn_task_start(sched, waiter_func, &second) == 0);
+	rn_task_wait(sched, 10);
+	XTEST(rn_list_size(&host->waiters) == 2);
+	/* The freed slot is taken before the first waiter runs */
+	rn_tcp_pool_put(waited, false);
+	waited = rn_tcp_pool_get(pool, &addr);
+	XTEST(waited != NULL);
+	rn_task_wait(sched, 10);
+	XTEST(first == NULL && second == NULL);
+	XTEST(rn_list_size(&host->waiters) == 2);
+	rn_tcp_pool_put(conns[1], true);
+	rn_task_wait(sched, 10);
+	XTEST(first == conns[1]);
+	XTEST(second == NULL);
+	rn_tcp_pool_put(conns[2], true);
+	rn_task_wait(sched, 10);
+	XTEST(second == conns[2]);
+	XTEST(nbaccepted == MAX_TOTAL + 1);
+	rn_log("client - idle limit");
+	rn_tcp_pool_put(conns[1], true);
+	rn_tcp_pool_put(conns[2], true);
+	rn_tcp_pool_put(waited, true);
+	XTEST(rn_list_size(&host->idle) == MAX_IDLE);
+	XTEST(host->nbtotal == MAX_IDLE);
+	rn_log("client - peer close while idle");
+	conns[0] = rn_tcp_pool_get(pool, &addr);
+	conns[1] = rn_tcp_pool_get(pool, &addr);
+	XTEST(rn_socket_write(conns[0]->socket, "q", 1) == 1);
+	rn_tcp_pool_put(conns[0], true);
+	rn_tcp_pool_put(conns[1], true);
+	XTEST(rn_list_size(&host->idle) == 2);
+	/* Lets the server close the connection */
+	rn_task_wait(sched, 10);
+	/* Most recent first: conns[1] is healthy */
+	XTEST(rn_tcp_pool_get(pool, &addr) == conns[1]);
+	/* conns[0] has been closed by the peer, a new connection is opened */
+	conns[0] = rn_tcp_pool_get(pool, &addr);
+	XTEST(conns[0] != NULL);
+	echo(conns[0]);
+	XTEST(nbaccepted == MAX_TOTAL + 2);
+	rn_log("client - idle expiry");
+	rn_tcp_pool_put(conns[0], true);
+	rn_tcp_pool_put(conns[1], true);
+	XTEST(rn_list_size(&host->idle) == 2);
+	rn_task_wait(sched, IDLE_TIMEOUT * 2);
+	XTEST(rn_list_size(&host->idle) == 0);
+	XTEST(host->nbtotal == 0);
+	XTEST(pool->reaper == NULL);
+	rn_log("client - destroy with idle connections");
+	rn_tcp_pool_put(rn_tcp_pool_get(pool, &addr), true);
+	XTEST(pool->reaper != NULL);
+	rn_tcp_pool_destroy(pool);
+	single_slot(sched);
+	rn_log("client - TLS connections");
+	ssl_client(sched);
+	rn_scheduler_stop(sched);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+
+	rn_addr4(&addr, "127.0.0.1", 4254);
+	rn_addr4(&ssl_addr, "127.0.0.1", 4260);
+	/* Nothing listens there */
+	rn_addr4(&closed_addr, "127.0.0.1", 4262);
+	rn_ssl_init();
+	ssl = rn_ssl_context(2048);
+	XTEST(ssl != NULL);
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, ssl_server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	rn_ssl_context_destroy(ssl);
+	XPASS();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file   rn_udp_server.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Test file for multi-spawn UDP server.
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define NBSPAWNS	2
+#define NBCLIENTS	8
+#define NBDGRAMS	50
+#define DGRAM_SIZE	32
+
+static int handled[NBSPAWNS + 1];
+static int truncated = 0;
+
+void echo_handler(rn_socket_t *socket, rn_dgram_t *dgram, void *arg)
+{
+	XTEST(arg == handled);
+	XTEST(dgram->size == DGRAM_SIZE);
+	__atomic_add_fetch(&handled[rn_scheduler_self()->id], 1, __ATOMIC_RELAXED);
+	if (dgram->truncated) {
+		__atomic_add_fetch(&truncated, 1, __ATOMIC_RELAXED);
+	}
+	XTEST(rn_socket_sendto(socket, dgram->buf, dgram->len, &dgram->addr) == (ssize_t) dgram->len);
+}
+
+void client_func(void *arg)
+{
+	int i;
+	int j;
+	char buf[DGRAM_SIZE * 2];
+	char expected[DGRAM_SIZE];
+	rn_addr_t addr;
+	rn_sched_t *sched = arg;
+	rn_socket_t *sockets[NBCLIENTS];
+
+	rn_addr4(&addr, "127.0.0.1", 4252);
+	/* Distinct source ports, flows get spread across spawns */
+	for (i = 0; i < NBCLIENTS; i++) {
+		sockets[i] = rn_udp_client(sched, &addr);
+		XTEST(sockets[i] != NULL);
+	}
+	/* One flow in flight at a time, so that no socket buffer overflows */
+	for (i = 0; i < NBCLIENTS; i++) {
+		for (j = 0; j < NBDGRAMS; j++) {
+			snprintf(buf, sizeof(buf), "client %d dgram %d", i, j);
+			XTEST(rn_socket_write(sockets[i], buf, strlen(buf)) == (ssize_t) strlen(buf));
+		}
+		for (j = 0; j < NBDGRAMS; j++) {
+			snprintf(expected, sizeof(expected), "client %d dgram %d", i, j);
+			XTEST(rn_socket_read(sockets[i], buf, sizeof(buf)) == (ssize_t) strlen(expected));
+			XTEST(memcmp(buf, expected, strlen(expected)) == 0);
+		}
+		rn_socket_destroy(sockets[i]);
+	}
+	rn_log("client - %d echoes received", NBCLIENTS * NBDGRAMS);
+	/* Larger datagrams are truncated to the server receive size */
+	sockets[0] = rn_udp_client(sched, &addr);
+	XTEST(sockets[0] != NULL);
+	memset(buf, 'x', sizeof(buf));
+	XTEST(rn_socket_write(sockets[0], buf, sizeof(buf)) == sizeof(buf));
+	XTEST(rn_socket_read(sockets[0], buf, sizeof(buf)) == DGRAM_SIZE);
+	rn_socket_destroy(sockets[0]);
+	/* Lets spawns go idle, a stop signal is only caught while polling */
+	rn_task_wait(sched, 100);
+	rn_scheduler_stop(sched);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	int i;
+	int total;
+	rn_addr_t addr;
+	rn_sched_t *sched;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_spawn(sched, NBSPAWNS) == 0);
+	rn_addr4(&addr, "127.0.0.1", 4252);
+	XTEST(rn_udp_server_spawn(sched, &addr, DGRAM_SIZE, echo_handler, handled) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	for (i = 0, total = 0; i <= NBSPAWNS; i++) {
+		rn_log("scheduler %d - %d datagrams handled", i, handled[i]);
+		total += handled[i];
+	}
+	XTEST(total == NBCLIENTS * NBDGRAMS + 1);
+	XTEST(truncated == 1);
+	XPASS();
+}
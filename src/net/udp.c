@@ -13,6 +13,14 @@
 extern const rn_socket_class_t socket_class_udp;
 extern const rn_socket_class_t socket_class_udp6;
 
+/**
+ * Creates a UDP client to be connected to a specific address.
+ *
+ * @param sched Scheduler pointer
+ * @param dst Destination address to connect to
+ *
+ * @return Socket pointer on success or NULL if an error occurs
+ */
 rn_socket_t *rn_udp_client(rn_sched_t *sched, rn_addr_t *dst)
 {
 	rn_socket_t *socket;
@@ -27,3 +35,149 @@ rn_socket_t *rn_udp_client(rn_sched_t *sched, rn_addr_t *dst)
 	}
 	return socket;
 }
+
+/**
+ * Creates a UDP server bound to a specific address.
+ * SO_REUSEPORT is set, so several servers can share the same address
+ * and the kernel spreads incoming flows across them.
+ *
+ * @param sched Scheduler pointer
+ * @param dst Address to bind
+ *
+ * @return Socket pointer to the server on success or NULL if an error occurs
+ */
+rn_socket_t *rn_udp_server(rn_sched_t *sched, rn_addr_t *dst)
+{
+	rn_socket_t *socket;
+
+	socket = rn_socket(sched, (IS_IPV6(dst) ? &socket_class_udp6 : &socket_class_udp));
+	if (unlikely(socket == NULL)) {
+		return NULL;
+	}
+	if (rn_socket_bind(socket, dst, 0) != 0) {
+		rn_socket_destroy(socket);
+		return NULL;
+	}
+	return socket;
+}
+
+/**
+ * UDP server processing callback.
+ * Receives datagrams in batches and calls the handler for each of them,
+ * until the socket fails or the scheduler stops.
+ *
+ * @param context Pointer to a UDP server context
+ */
+static void rn_udp_server_process(void *context)
+{
+	int i;
+	int ret;
+	rn_udp_context_t *ucontext = context;
+
+	for (i = 0; i < RN_SOCKET_MMSG_MAX; i++) {
+		ucontext->dgrams[i].buf = ucontext->bufs + i * ucontext->size;
+		ucontext->dgrams[i].size = ucontext->size;
+	}
+	while ((ret = rn_socket_recvmmsg(ucontext->socket, ucontext->dgrams, RN_SOCKET_MMSG_MAX)) > 0) {
+		for (i = 0; i < ret; i++) {
+			ucontext->handler(ucontext->socket, &ucontext->dgrams[i], ucontext->arg);
+		}
+	}
+	rn_socket_destroy(ucontext->socket);
+	rn_free(ucontext);
+}
+
+/**
+ * Starts a UDP server which calls handler for every datagram received.
+ * The handler runs in the receiving task and can reply to dgram->addr
+ * through the given socket. The datagram buffer is only valid during
+ * the call. Datagrams larger than size are truncated, with their
+ * truncated flag set.
+ *
+ * @param sched Pointer to a scheduler
+ * @param dst Address to bind
+ * @param size Receive buffer size per datagram, 0 for RN_UDP_DGRAM_SIZE
+ * @param handler Datagram handler
+ * @param arg Handler argument
+ *
+ * @return 0 on success, or -1 if an error occurs
+ */
+int rn_udp_server_start(rn_sched_t *sched, rn_addr_t *dst, size_t size, rn_udp_handler_t handler, void *arg)
+{
+	rn_socket_t *server;
+	rn_udp_context_t *context;
+
+	XASSERT(handler != NULL, -1);
+
+	if (size == 0) {
+		size = RN_UDP_DGRAM_SIZE;
+	}
+	server = rn_udp_server(sched, dst);
+	if (server == NULL) {
+		return -1;
+	}
+	context = rn_malloc(sizeof(*context) + RN_SOCKET_MMSG_MAX * size);
+	if (context == NULL) {
+		rn_socket_destroy(server);
+		return -1;
+	}
+	context->arg = arg;
+	context->socket = server;
+	context->handler = handler;
+	context->size = size;
+	if (rn_task_start(sched, rn_udp_server_process, context) != 0) {
+		rn_socket_destroy(server);
+		rn_free(context);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * Starts a UDP server on the scheduler and on each of its spawns.
+ * Every scheduler gets its own SO_REUSEPORT socket bound to the same
+ * address, so the kernel shards flows across threads without any lock.
+ * This must be called after rn_spawn and before rn_scheduler_loop.
+ * The handler may run concurrently on several threads.
+ *
+ * @param sched Pointer to the parent scheduler
+ * @param dst Address to bind
+ * @param size Receive buffer size per datagram, 0 for RN_UDP_DGRAM_SIZE
+ * @param handler Datagram handler
+ * @param arg Handler argument
+ *
+ * @return 0 on success, or -1 if an error occurs
+ */
+int rn_udp_server_spawn(rn_sched_t *sched, rn_addr_t *dst, size_t size, rn_udp_handler_t handler, void *arg)
+{
+	int i;
+
+	for (i = 0; i <= sched->spawns.count; i++) {
+		if (rn_udp_server_start(rn_spawn_get(sched, i), dst, size, handler, arg) != 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Enables or disables UDP generic receive offload on a socket. When
+ * enabled, rn_socket_recvmmsg may return several coalesced datagrams in
+ * one buffer, with their size in the segment field.
+ *
+ * @param socket Socket to use
+ * @param enabled Whether to enable GRO
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_udp_gro(rn_socket_t *socket, bool enabled)
+{
+	int value;
+
+	value = enabled;
+	if (setsockopt(socket->node.fd, SOL_UDP, UDP_GRO, &value, sizeof(value)) != 0) {
+		rn_error_set(errno);
+		return -1;
+	}
+	return 0;
+}
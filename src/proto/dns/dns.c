@@ -24,15 +24,9 @@ void rn_dns_init(rn_sched_t *sched, rn_dns_t *dns, rn_dns_type_t type, const cha
 
 void rn_dns_destroy(rn_dns_t *dns)
 {
-	if (dns->answer != NULL) {
-		free(dns->answer);
-	}
-	if (dns->authority != NULL) {
-		free(dns->authority);
-	}
-	if (dns->additional != NULL) {
-		free(dns->additional);
-	}
+	rn_slab_free(dns->answer);
+	rn_slab_free(dns->authority);
+	rn_slab_free(dns->additional);
 	rn_socket_destroy(dns->socket);
 }
 
@@ -109,9 +103,11 @@ int rn_dns_get(rn_dns_t *dns, rn_dns_query_t *query, rn_addr_t *from)
 int rn_dns_reply_get(rn_dns_t *dns, uint32_t timeout)
 {
 	unsigned int i;
+	rn_slab_t *slab;
 	rn_dns_query_t query;
 	rn_buffer_iterator_t iterator;
 
+	slab = &dns->socket->node.sched->slab;
 	rn_buffer_reset(&dns->buffer);
 	rn_buffer_init(&query.name.buffer, query.name.value, sizeof(query.name.value));
 	if (rn_socket_timeout(dns->socket, timeout) != 0) {
@@ -143,7 +139,7 @@ int rn_dns_reply_get(rn_dns_t *dns, uint32_t timeout)
 		return -1;
 	}
 	if (dns->header.ancount > 0) {
-		dns->answer = malloc(sizeof(*dns->answer) * dns->header.ancount);
+		dns->answer = rn_slab_alloc(slab, sizeof(*dns->answer) * dns->header.ancount);
 		if (dns->answer == NULL) {
 			return -1;
 		}
@@ -154,7 +150,7 @@ int rn_dns_reply_get(rn_dns_t *dns, uint32_t timeout)
 		}
 	}
 	if (dns->header.nscount > 0) {
-		dns->authority = malloc(sizeof(*dns->authority) * dns->header.nscount);
+		dns->authority = rn_slab_alloc(slab, sizeof(*dns->authority) * dns->header.nscount);
 		if (dns->authority == NULL) {
 			return -1;
 		}
@@ -165,7 +161,7 @@ int rn_dns_reply_get(rn_dns_t *dns, uint32_t timeout)
 		}
 	}
 	if (dns->header.arcount > 0) {
-		dns->additional = malloc(sizeof(*dns->additional) * dns->header.arcount);
+		dns->additional = rn_slab_alloc(slab, sizeof(*dns->additional) * dns->header.arcount);
 		if (dns->additional == NULL) {
 			return -1;
 		}
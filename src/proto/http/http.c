@@ -14,25 +14,26 @@ int rn_http_init(rn_socket_t *socket, rn_http_t *http)
 {
 	memset(http, 0, sizeof(*http));
 	http->socket = socket;
-	http->request.buffer = rn_buffer_create(NULL);
+	http->request.buffer = rn_buffer_pool_get(&socket->node.sched->bufpool);
 	if (http->request.buffer == NULL) {
 		return -1;
 	}
-	http->response.buffer = rn_buffer_create(NULL);
+	http->response.buffer = rn_buffer_pool_get(&socket->node.sched->bufpool);
 	if (http->response.buffer == NULL) {
-		rn_buffer_destroy(http->request.buffer);
+		rn_buffer_pool_put(http->request.buffer);
 		return -1;
 	}
 	if (rn_http_headers_init(&http->request.headers) != 0) {
-		rn_buffer_destroy(http->request.buffer);
-		rn_buffer_destroy(http->response.buffer);
+		rn_buffer_pool_put(http->request.buffer);
+		rn_buffer_pool_put(http->response.buffer);
 		return -1;
 	}
 	if (rn_http_headers_init(&http->response.headers) != 0) {
-		rn_buffer_destroy(http->request.buffer);
-		rn_buffer_destroy(http->response.buffer);
+		rn_buffer_pool_put(http->request.buffer);
+		rn_buffer_pool_put(http->response.buffer);
 		return -1;
 	}
+	rn_arena(&http->arena, 0);
 	http->version = RN_HTTP_VERSION_11;
 	return 0;
 }
@@ -40,27 +41,114 @@ int rn_http_init(rn_socket_t *socket, rn_http_t *http)
 void rn_http_destroy(rn_http_t *http)
 {
 	if (http->request.buffer != NULL) {
-		rn_buffer_destroy(http->request.buffer);
+		rn_buffer_pool_put(http->request.buffer);
 		http->request.buffer = NULL;
 	}
 	if (http->response.buffer != NULL) {
-		rn_buffer_destroy(http->response.buffer);
+		rn_buffer_pool_put(http->response.buffer);
 		http->response.buffer = NULL;
 	}
 	rn_http_headers_flush(&http->request.headers);
 	rn_http_headers_flush(&http->response.headers);
+	rn_arena_destroy(&http->arena);
 }
 
 void rn_http_reset(rn_http_t *http)
 {
 	/* Reset request */
 	memset(&http->request.uri, 0, sizeof(http->request.uri));
+	memset(&http->request.path, 0, sizeof(http->request.path));
 	http->request.method = RN_HTTP_METHOD_UNKNOWN;
 	rn_buffer_reset(http->request.buffer);
 	rn_http_headers_flush(&http->request.headers);
+	if (http->request.body != NULL) {
+		rn_iobuf_erase(http->request.body, 0);
+	}
 	/* Reset response */
 	memset(&http->response.msg, 0, sizeof(http->response.msg));
 	http->response.code = 0;
 	rn_buffer_reset(http->response.buffer);
 	rn_http_headers_flush(&http->response.headers);
+	if (http->response.body != NULL) {
+		rn_iobuf_erase(http->response.body, 0);
+	}
+	/* Releases per request memory */
+	rn_arena_reset(&http->arena);
+}
+
+/**
+ * Reads a http body into a chained buffer.
+ * Body bytes already read along with headers are moved from the
+ * buffer to the chained buffer, the remaining ones are read directly
+ * into chained buffer segments so that large bodies are never copied again.
+ *
+ * @param http Pointer to a http structure
+ * @param buffer Pointer to the buffer containing headers, headers are kept
+ * @param offset Headers length
+ * @param length Body length
+ * @param body Pointer to the chained buffer where to store the body
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_http_body_get(rn_http_t *http, rn_buffer_t *buffer, size_t offset, size_t length, rn_iobuf_t *body)
+{
+	size_t available;
+
+	available = rn_buffer_size(buffer) - offset;
+	if (available > length) {
+		available = length;
+	}
+	if (rn_iobuf_add(body, rn_buffer_ptr(buffer) + offset, available) != 0) {
+		return -1;
+	}
+	rn_buffer_setsize(buffer, offset);
+	while (rn_iobuf_size(body) < length) {
+		if (rn_socket_readio(http->socket, body) <= 0) {
+			return -1;
+		}
+	}
+	return rn_iobuf_truncate(body, length);
+}
+
+/**
+ * Sends a http header buffer followed by a chained buffer body.
+ * Headers and body segments are given to the same writev call.
+ *
+ * @param http Pointer to a http structure
+ * @param buffer Pointer to the buffer containing headers
+ * @param body Pointer to the chained buffer to send
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_http_body_send(rn_http_t *http, rn_buffer_t *buffer, rn_iobuf_t *body)
+{
+	int i;
+	int count;
+	size_t size;
+	rn_iobuf_seg_t *seg;
+	rn_buffer_t views[RN_SOCKET_WRITEIO_MAX];
+	rn_buffer_t *buffers[RN_SOCKET_WRITEIO_MAX];
+
+	seg = body->head;
+	buffers[0] = buffer;
+	size = rn_buffer_size(buffer);
+	count = rn_iobuf_views(&seg, views, RN_SOCKET_WRITEIO_MAX - 1);
+	for (i = 0; i < count; i++) {
+		buffers[i + 1] = &views[i];
+		size += rn_buffer_size(&views[i]);
+	}
+	if (rn_socket_writev(http->socket, buffers, count + 1) != (ssize_t) size) {
+		return -1;
+	}
+	while (seg != NULL) {
+		count = rn_iobuf_views(&seg, views, RN_SOCKET_WRITEIO_MAX);
+		for (i = 0, size = 0; i < count; i++) {
+			buffers[i] = &views[i];
+			size += rn_buffer_size(&views[i]);
+		}
+		if (rn_socket_writev(http->socket, buffers, count) != (ssize_t) size) {
+			return -1;
+		}
+	}
+	return rn_socket_flush(http->socket);
 }
@@ -18,8 +18,8 @@
  */
 static void rn_http_easy_route_call(rn_http_t *http, rn_http_route_t *route)
 {
+	rn_buffer_t uri;
 	rn_buffer_t body;
-	rn_buffer_t *uri;
 
 	http->response.code = route->code;
 	switch (route->type) {
@@ -42,17 +42,17 @@ static void rn_http_easy_route_call(rn_http_t *http, rn_http_route_t *route)
 		}
 		break;
 	case RN_HTTP_ROUTE_DIR:
-		uri = rn_buffer_create(NULL);
-		rn_buffer_addstr(uri, route->path);
-		rn_buffer_addstr(uri, "/");
-		rn_buffer_add(uri, rn_buffer_ptr(&http->request.uri), rn_buffer_size(&http->request.uri));
-		rn_buffer_addnull(uri);
-		if (rn_http_send_file(http, rn_buffer_ptr(uri)) != 0) {
+		/* Released by rn_http_reset */
+		if (rn_buffer_arena(&uri, &http->arena) != 0 ||
+		    rn_buffer_addstr(&uri, route->path) < 0 ||
+		    rn_buffer_addstr(&uri, "/") < 0 ||
+		    rn_buffer_add(&uri, rn_buffer_ptr(&http->request.path), rn_buffer_size(&http->request.path)) < 0 ||
+		    rn_buffer_addnull(&uri) < 0 ||
+		    rn_http_send_file(http, rn_buffer_ptr(&uri)) != 0) {
 			http->response.code = 404;
 			rn_buffer_set(&body, RN_HTTP_ERROR_404);
 			rn_http_response_send(http, &body);
 		}
-		rn_buffer_destroy(uri);
 		break;
 	case RN_HTTP_ROUTE_REDIRECT:
 		rn_http_header_set(&http->response.headers, "Location", route->location);
@@ -78,8 +78,8 @@ static void rn_http_easy_client_process(void *context)
 	while (rn_http_request_get(&http)) {
 		for (i = 0, found = false; i < econtext->nbroutes && found == false; i++) {
 			if (econtext->routes[i].uri == NULL ||
-			rn_buffer_strcmp(&http.request.uri, econtext->routes[i].uri) == 0 ||
-			(econtext->routes[i].type == RN_HTTP_ROUTE_DIR && rn_buffer_strncmp(&http.request.uri, econtext->routes[i].uri, strlen(econtext->routes[i].uri)) == 0)) {
+			rn_buffer_strcmp(&http.request.path, econtext->routes[i].uri) == 0 ||
+			(econtext->routes[i].type == RN_HTTP_ROUTE_DIR && rn_buffer_strncmp(&http.request.path, econtext->routes[i].uri, strlen(econtext->routes[i].uri)) == 0)) {
 				rn_http_easy_route_call(&http, &econtext->routes[i]);
 				found = true;
 			}
@@ -93,7 +93,7 @@ static void rn_http_easy_client_process(void *context)
 	}
 	rn_http_destroy(&http);
 	rn_socket_destroy(econtext->socket);
-	free(econtext);
+	rn_free(econtext);
 }
 
 /**
@@ -108,11 +108,11 @@ static void rn_http_easy_server_process(void *context)
 	rn_http_easy_context_t *s_context = context;
 
 	while ((client = rn_socket_accept(s_context->socket, NULL)) != NULL) {
-		c_context = malloc(sizeof(*c_context));
+		c_context = rn_malloc(sizeof(*c_context));
 		if (c_context == NULL) {
 			rn_socket_destroy(client);
 			rn_socket_destroy(s_context->socket);
-			free(s_context);
+			rn_free(s_context);
 			return;
 		}
 		c_context->socket = client;
@@ -121,7 +121,7 @@ static void rn_http_easy_server_process(void *context)
 		rn_task_start(s_context->socket->node.sched, rn_http_easy_client_process, c_context);
 	}
 	rn_socket_destroy(s_context->socket);
-	free(s_context);
+	rn_free(s_context);
 }
 
 /**
@@ -142,11 +142,11 @@ int rn_http_easy_server(rn_sched_t *sched, rn_addr_t *dst, rn_http_route_t *rout
 	if (routes == NULL) {
 		return -1;
 	}
-	server = rn_tcp_server(sched, dst);
+	server = rn_tcp_server(sched, dst, NULL);
 	if (server == NULL) {
 		return -1;
 	}
-	context = malloc(sizeof(*context));
+	context = rn_malloc(sizeof(*context));
 	if (context == NULL) {
 		return -1;
 	}
@@ -154,7 +154,7 @@ int rn_http_easy_server(rn_sched_t *sched, rn_addr_t *dst, rn_http_route_t *rout
 	context->routes = routes;
 	context->nbroutes = size;
 	if (rn_task_start(sched, rn_http_easy_server_process, context) != 0) {
-		free(context);
+		rn_free(context);
 		return -1;
 	}
 	return 0;
@@ -12,12 +12,11 @@
 
 int rn_http_send_dir(rn_http_t *http, const char *path)
 {
-	int ret;
 	int flag;
 	DIR *dir;
 	char *hl;
 	char *de;
-	rn_buffer_t *result;
+	rn_buffer_t result;
 	struct stat stats;
 	struct dirent *curentry;
 
@@ -37,12 +36,12 @@ int rn_http_send_dir(rn_http_t *http, const char *path)
 		rn_error_set(errno);
 		return -1;
 	}
-	result = rn_buffer_create(NULL);
-	if (result == NULL) {
+	/* Released by rn_http_reset */
+	if (rn_buffer_arena(&result, &http->arena) != 0) {
 		closedir(dir);
 		return -1;
 	}
-	rn_buffer_print(result,
+	rn_buffer_addstr(&result,
 		     "<html>\n"
 		     "  <head>\n"
 		     "    <title>Directory listing</title>\n"
@@ -86,23 +85,24 @@ int rn_http_send_dir(rn_http_t *http, const char *path)
 			} else {
 				de = "";
 			}
-			rn_buffer_print(result,
-				     "<li>\n"
-				     "  <a href=\"%s%s\"%s>\n"
-				     "    <div class=\"dl_en\">%s%s</div>\n"
+			rn_buffer_addstr(&result, "<li>\n  <a href=\"");
+			rn_buffer_addstr(&result, curentry->d_name);
+			rn_buffer_addstr(&result, de);
+			rn_buffer_addstr(&result, "\"");
+			rn_buffer_addstr(&result, hl);
+			rn_buffer_addstr(&result, ">\n    <div class=\"dl_en\">");
+			rn_buffer_addstr(&result, curentry->d_name);
+			rn_buffer_addstr(&result, de);
+			rn_buffer_addstr(&result,
+				     "</div>\n"
 				     "    <div class=\"dl_ed\">-</div>\n"
 				     "    <div class=\"dl_es\">-</div>\n"
 				     "  </a>\n"
-				     "</li>\n",
-				     curentry->d_name,
-				     de,
-				     hl,
-				     curentry->d_name,
-				     de);
+				     "</li>\n");
 			flag = !flag;
 		}
 	}
-	rn_buffer_print(result,
+	rn_buffer_addstr(&result,
 		     "        </ul>\n"
 		     "      </div>\n"
 		     "    </div>\n"
@@ -111,9 +111,7 @@ int rn_http_send_dir(rn_http_t *http, const char *path)
 	closedir(dir);
 
 	http->response.code = 200;
-	ret = rn_http_response_send(http, result);
-	rn_buffer_destroy(result);
-	return ret;
+	return rn_http_response_send(http, &result);
 }
 
 int rn_http_send_file(rn_http_t *http, const char *path)
@@ -12,6 +12,7 @@
 
 /**
  * Compare function used in the HTTP header tree to sort entries.
+ * Header names are case-insensitive.
  *
  * @param node1 Pointer to node1
  * @param node2 Pointer to node2
@@ -24,7 +25,7 @@ static int rn_http_header_cmp(rn_rbtree_node_t *node1, rn_rbtree_node_t *node2)
 	rn_http_header_t *header1 = container_of(node1, rn_http_header_t, node);
 	rn_http_header_t *header2 = container_of(node2, rn_http_header_t, node);
 
-	return rn_buffer_cmp(&header1->key, &header2->key);
+	return rn_buffer_casecmp(&header1->key, &header2->key);
 }
 
 /**
@@ -36,9 +37,9 @@ static void rn_http_header_free(rn_rbtree_node_t *node)
 {
 	rn_http_header_t *header = container_of(node, rn_http_header_t, node);
 
-	free(rn_buffer_ptr(&header->key));
-	free(rn_buffer_ptr(&header->value));
-	free(header);
+	/* Key is stored right after the header structure */
+	rn_slab_free(rn_buffer_ptr(&header->value));
+	rn_slab_free(header);
 }
 
 /**
@@ -77,7 +78,12 @@ void rn_http_headers_flush(rn_http_header_set_t *headers)
  */
 int rn_http_header_setdata(rn_http_header_set_t *headers, const char *key, const char *value, uint32_t size)
 {
+	char *new_key;
 	char *new_value;
+	size_t key_len;
+	size_t value_len;
+	rn_slab_t *slab;
+	rn_sched_t *sched;
 	rn_http_header_t *new;
 	rn_http_header_t dummy;
 	rn_rbtree_node_t *found;
@@ -87,28 +93,33 @@ int rn_http_header_setdata(rn_http_header_set_t *headers, const char *key, const
 	XASSERT(value != NULL, -1);
 	XASSERT(size > 0, -1);
 
+	sched = rn_scheduler_self();
+	slab = (sched != NULL ? &sched->slab : NULL);
+	value_len = strnlen(value, size);
+	new_value = rn_slab_alloc(slab, value_len + 1);
+	if (new_value == NULL) {
+		return -1;
+	}
+	memcpy(new_value, value, value_len);
+	new_value[value_len] = 0;
 	rn_buffer_set(&dummy.key, key);
-	new_value = strndup(value, size);
 	found = rn_rbtree_find(&headers->tree, &dummy.node);
 	if (found != NULL) {
 		new = container_of(found, rn_http_header_t, node);
-		free(new->value.ptr);
+		rn_slab_free(new->value.ptr);
 		rn_buffer_set(&new->value, new_value);
 		return 0;
 	}
-
-	new = calloc(1, sizeof(*new));
+	key_len = strlen(key);
+	new = rn_slab_alloc(slab, sizeof(*new) + key_len + 1);
 	if (new == NULL) {
-		free(new_value);
-		return -1;
-	}
-	key = strdup(key);
-	if (key == NULL) {
-		free(new_value);
-		free(new);
+		rn_slab_free(new_value);
 		return -1;
 	}
-	rn_buffer_set(&new->key, key);
+	memset(new, 0, sizeof(*new));
+	new_key = (char *)(new + 1);
+	memcpy(new_key, key, key_len + 1);
+	rn_buffer_set(&new->key, new_key);
 	rn_buffer_set(&new->value, new_value);
 	if (rn_rbtree_put(&headers->tree, &new->node) != 0) {
 		rn_http_header_free(&new->node);
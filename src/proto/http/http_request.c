@@ -10,6 +10,19 @@
 
 #include "rinoo/proto/http/module.h"
 
+/**
+ * Sets the request path from the request URI.
+ *
+ * @param http Pointer to a http structure
+ */
+static void rn_http_request_setpath(rn_http_t *http)
+{
+	size_t size;
+
+	size = rn_scan_set(rn_buffer_ptr(&http->request.uri), rn_buffer_size(&http->request.uri), "?#");
+	rn_buffer_static(&http->request.path, rn_buffer_ptr(&http->request.uri), size);
+}
+
 /**
  * Reads a http request.
  *
@@ -22,9 +35,23 @@ bool rn_http_request_get(rn_http_t *http)
 	int ret;
 
 	rn_http_reset(http);
+	/* Idle keep-alive connections give their buffers back to the pool */
+	rn_buffer_pool_release(http->request.buffer);
+	rn_buffer_pool_release(http->response.buffer);
+	if (rn_socket_waitdata(http->socket) != 0) {
+		return false;
+	}
 	while (rn_socket_readb(http->socket, http->request.buffer) > 0) {
 		ret = rn_http_request_parse(http);
 		if (ret == 1) {
+			rn_http_request_setpath(http);
+			if (http->request.body != NULL) {
+				if (rn_http_body_get(http, http->request.buffer, http->request.headers.length, http->request.headers.content_length, http->request.body) != 0) {
+					return false;
+				}
+				rn_buffer_static(&http->request.content, rn_buffer_ptr(http->request.buffer) + http->request.headers.length, 0);
+				return true;
+			}
 			while (rn_buffer_size(http->request.buffer) < http->request.headers.length + http->request.headers.content_length) {
 				if (rn_socket_readb(http->socket, http->request.buffer) <= 0) {
 					return false;
@@ -50,36 +77,32 @@ bool rn_http_request_get(rn_http_t *http)
  */
 void rn_http_request_setdefaultheaders(rn_http_t *http)
 {
-	char tmp[24];
+	char tmp[RN_U64TOA_MAX];
 
 	if (rn_http_header_get(&http->request.headers, "Content-Length") == NULL) {
-		if (snprintf(tmp, 24, "%lu", http->request.headers.content_length) > 0) {
-			rn_http_header_set(&http->request.headers, "Content-Length", tmp);
-		}
+		rn_http_header_setdata(&http->request.headers, "Content-Length", tmp,
+				       rn_u64toa(tmp, http->request.headers.content_length));
 	}
 }
 
 /**
- * Sends a http request.
+ * Prepares http request headers in the request buffer.
  *
  * @param http Pointer to a http structure
  * @param method HTTP method to be used
  * @param uri URI to use
- * @param body Pointer to http request body, if any
+ * @param body_length Size of the request body
  *
  * @return 0 on success, otherwise -1
  */
-int rn_http_request_send(rn_http_t *http, rn_http_method_t method, const char *uri, rn_buffer_t *body)
+static int rn_http_request_prepare(rn_http_t *http, rn_http_method_t method, const char *uri, size_t body_length)
 {
-	ssize_t ret;
 	rn_http_header_t *cur_header;
 
 	XASSERT(http != NULL, -1);
 	XASSERT(rn_buffer_size(http->request.buffer) == 0, -1);
 
-	if (body != NULL) {
-		http->request.headers.content_length = rn_buffer_size(body);
-	}
+	http->request.headers.content_length = body_length;
 	http->request.method = method;
 	switch (http->request.method) {
 	case RN_HTTP_METHOD_OPTIONS:
@@ -124,14 +147,32 @@ int rn_http_request_send(rn_http_t *http, rn_http_method_t method, const char *u
 	for (cur_header = rn_http_header_first(&http->request.headers);
 	     cur_header != NULL;
 	     cur_header = rn_http_header_next(cur_header)) {
-		rn_buffer_print(http->request.buffer,
-			     "%.*s: %.*s\r\n",
-			     rn_buffer_size(&cur_header->key),
-			     rn_buffer_ptr(&cur_header->key),
-			     rn_buffer_size(&cur_header->value),
-			     rn_buffer_ptr(&cur_header->value));
+		rn_buffer_add(http->request.buffer, rn_buffer_ptr(&cur_header->key), rn_buffer_size(&cur_header->key));
+		rn_buffer_add(http->request.buffer, ": ", 2);
+		rn_buffer_add(http->request.buffer, rn_buffer_ptr(&cur_header->value), rn_buffer_size(&cur_header->value));
+		rn_buffer_add(http->request.buffer, "\r\n", 2);
 	}
 	rn_buffer_add(http->request.buffer, "\r\n", 2);
+	return 0;
+}
+
+/**
+ * Sends a http request.
+ *
+ * @param http Pointer to a http structure
+ * @param method HTTP method to be used
+ * @param uri URI to use
+ * @param body Pointer to http request body, if any
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_http_request_send(rn_http_t *http, rn_http_method_t method, const char *uri, rn_buffer_t *body)
+{
+	ssize_t ret;
+
+	if (rn_http_request_prepare(http, method, uri, (body != NULL ? rn_buffer_size(body) : http->request.headers.content_length)) != 0) {
+		return -1;
+	}
 	ret = rn_socket_writeb(http->socket, http->request.buffer);
 	if (ret != (ssize_t) rn_buffer_size(http->request.buffer)) {
 		rn_error_set(ECOMM);
@@ -141,5 +182,27 @@ int rn_http_request_send(rn_http_t *http, rn_http_method_t method, const char *u
 		rn_error_set(ECOMM);
 		return -1;
 	}
+	return rn_socket_flush(http->socket);
+}
+
+/**
+ * Sends a http request with a chained buffer body.
+ *
+ * @param http Pointer to a http structure
+ * @param method HTTP method to be used
+ * @param uri URI to use
+ * @param body Pointer to http request body
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_http_request_send_iobuf(rn_http_t *http, rn_http_method_t method, const char *uri, rn_iobuf_t *body)
+{
+	if (rn_http_request_prepare(http, method, uri, rn_iobuf_size(body)) != 0) {
+		return -1;
+	}
+	if (rn_http_body_send(http, http->request.buffer, body) != 0) {
+		rn_error_set(ECOMM);
+		return -1;
+	}
 	return 0;
 }
@@ -232,16 +232,17 @@ int rn_http_request_parse(rn_http_t *http)
 	char *hdv_start = NULL;
 	char *hdv_end = NULL;
 	char tmp;
+	uint64_t value;
 
 	
-#line 238 "http_request_parse.c"
+#line 239 "http_request_parse.c"
 	{
 	cs = httpreq_reader_start;
 	}
 
-#line 87 "http_request_parse.rl"
+#line 88 "http_request_parse.rl"
 	
-#line 245 "http_request_parse.c"
+#line 246 "http_request_parse.c"
 	{
 	int _klen;
 	unsigned int _trans;
@@ -361,10 +362,11 @@ _match:
 	  rn_buffer_static(&http->request.uri, uri_start, uri_end - uri_start);
 	  if (cl_start != NULL && cl_end != NULL)
 	  {
-		  tmp = *cl_end;
-		  *cl_end = 0;
-		  http->request.headers.content_length = atoi(cl_start);
-		  *cl_end = tmp;
+		  if (rn_atou64(cl_start, cl_end - cl_start, &value) != (size_t) (cl_end - cl_start)) {
+			  rn_error_set(EBADMSG);
+			  return -1;
+		  }
+		  http->request.headers.content_length = value;
 	  }
 	  http->request.headers.length = p - ((char *) rn_buffer_ptr(http->request.buffer)) + 1;
 	  return 1;
@@ -372,7 +374,7 @@ _match:
 	break;
 	case 9:
 #line 45 "http_request_parse.rl"
-	{ return -1; }
+	{ rn_error_set(EBADMSG); return -1; }
 	break;
 	case 10:
 #line 48 "http_request_parse.rl"
@@ -414,7 +416,7 @@ _match:
 #line 58 "http_request_parse.rl"
 	{ http->version = RN_HTTP_VERSION_11; }
 	break;
-#line 418 "http_request_parse.c"
+#line 419 "http_request_parse.c"
 		}
 	}
 
@@ -432,9 +434,9 @@ _again:
 		switch ( *__acts++ ) {
 	case 9:
 #line 45 "http_request_parse.rl"
-	{ return -1; }
+	{ rn_error_set(EBADMSG); return -1; }
 	break;
-#line 438 "http_request_parse.c"
+#line 439 "http_request_parse.c"
 		}
 	}
 	}
@@ -442,7 +444,7 @@ _again:
 	_out: {}
 	}
 
-#line 88 "http_request_parse.rl"
+#line 89 "http_request_parse.rl"
 
 	(void) httpreq_reader_en_main;
 	(void) httpreq_reader_error;
@@ -34,15 +34,16 @@
 	  rn_buffer_static(&http->request.uri, uri_start, uri_end - uri_start);
 	  if (cl_start != NULL && cl_end != NULL)
 	  {
-		  tmp = *cl_end;
-		  *cl_end = 0;
-		  http->request.headers.content_length = atoi(cl_start);
-		  *cl_end = tmp;
+		  if (rn_atou64(cl_start, cl_end - cl_start, &value) != (size_t) (cl_end - cl_start)) {
+			  rn_error_set(EBADMSG);
+			  return -1;
+		  }
+		  http->request.headers.content_length = value;
 	  }
 	  http->request.headers.length = fpc - ((char *) rn_buffer_ptr(http->request.buffer)) + 1;
 	  return 1;
   }
-  action parseerror	{ return -1; }
+  action parseerror	{ rn_error_set(EBADMSG); return -1; }
 
   crlf = '\r\n';
   method = ( 'OPTIONS'i %{ http->request.method = RN_HTTP_METHOD_OPTIONS; } |
@@ -82,6 +83,7 @@ int rn_http_request_parse(rn_http_t *http)
 	char *hdv_start = NULL;
 	char *hdv_end = NULL;
 	char tmp;
+	uint64_t value;
 
 	%% write init;
 	%% write exec;
@@ -25,6 +25,13 @@ bool rn_http_response_get(rn_http_t *http)
 	while (rn_socket_readb(http->socket, http->response.buffer) > 0) {
 		ret = rn_http_response_parse(http);
 		if (ret == 1) {
+			if (http->response.body != NULL) {
+				if (rn_http_body_get(http, http->response.buffer, http->response.headers.length, http->response.headers.content_length, http->response.body) != 0) {
+					return false;
+				}
+				rn_buffer_static(&http->response.content, rn_buffer_ptr(http->response.buffer) + http->response.headers.length, 0);
+				return true;
+			}
 			while (rn_buffer_size(http->response.buffer) < http->response.headers.length + http->response.headers.content_length) {
 				if (rn_socket_readb(http->socket, http->response.buffer) <= 0) {
 					return false;
@@ -197,12 +204,11 @@ void rn_http_response_setdefaultmsg(rn_http_t *http)
  */
 void rn_http_response_setdefaultheaders(rn_http_t *http)
 {
-	char tmp[24];
+	char tmp[RN_U64TOA_MAX];
 
 	if (rn_http_header_get(&http->response.headers, "Content-Length") == NULL) {
-		if (snprintf(tmp, 24, "%lu", http->response.headers.content_length) > 0) {
-			rn_http_header_set(&http->response.headers, "Content-Length", tmp);
-		}
+		rn_http_header_setdata(&http->response.headers, "Content-Length", tmp,
+				       rn_u64toa(tmp, http->response.headers.content_length));
 	}
 	if (rn_http_header_get(&http->response.headers, "Server") == NULL) {
 		rn_http_header_set(&http->response.headers, "Server", RN_HTTP_SIGNATURE);
@@ -238,16 +244,18 @@ int rn_http_response_prepare(rn_http_t *http, size_t body_length)
 		rn_buffer_add(http->response.buffer, "HTTP/1.1", 8);
 		break;
 	}
-	rn_buffer_print(http->response.buffer, " %d %.*s\r\n", http->response.code, rn_buffer_size(&http->response.msg), rn_buffer_ptr(&http->response.msg));
+	rn_buffer_add(http->response.buffer, " ", 1);
+	rn_buffer_addi64(http->response.buffer, http->response.code);
+	rn_buffer_add(http->response.buffer, " ", 1);
+	rn_buffer_add(http->response.buffer, rn_buffer_ptr(&http->response.msg), rn_buffer_size(&http->response.msg));
+	rn_buffer_add(http->response.buffer, "\r\n", 2);
 	for (cur_header = rn_http_header_first(&http->response.headers);
 	     cur_header != NULL;
 	     cur_header = rn_http_header_next(cur_header)) {
-		rn_buffer_print(http->response.buffer,
-			     "%.*s: %.*s\r\n",
-			     rn_buffer_size(&cur_header->key),
-			     rn_buffer_ptr(&cur_header->key),
-			     rn_buffer_size(&cur_header->value),
-			     rn_buffer_ptr(&cur_header->value));
+		rn_buffer_add(http->response.buffer, rn_buffer_ptr(&cur_header->key), rn_buffer_size(&cur_header->key));
+		rn_buffer_add(http->response.buffer, ": ", 2);
+		rn_buffer_add(http->response.buffer, rn_buffer_ptr(&cur_header->value), rn_buffer_size(&cur_header->value));
+		rn_buffer_add(http->response.buffer, "\r\n", 2);
 	}
 	rn_buffer_add(http->response.buffer, "\r\n", 2);
 	return 0;
@@ -279,5 +287,22 @@ int rn_http_response_send(rn_http_t *http, rn_buffer_t *body)
 			return -1;
 		}
 	}
-	return 0;
+	/* The response is complete, a corked socket sends its last frame */
+	return rn_socket_flush(http->socket);
+}
+
+/**
+ * Sends a http response with a chained buffer body.
+ *
+ * @param http Pointer to a http structure
+ * @param body Pointer to http response body
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_http_response_send_iobuf(rn_http_t *http, rn_iobuf_t *body)
+{
+	if (rn_http_response_prepare(http, rn_iobuf_size(body)) != 0) {
+		return -1;
+	}
+	return rn_http_body_send(http, http->response.buffer, body);
 }
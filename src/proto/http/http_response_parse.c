@@ -139,7 +139,7 @@ static const int httpres_reader_error = 0;
 static const int httpres_reader_en_main = 1;
 
 
-#line 62 "http_response_parse.rl"
+#line 64 "http_response_parse.rl"
 
 
 
@@ -159,16 +159,17 @@ int rn_http_response_parse(rn_http_t *http)
 	char *hdv_start = NULL;
 	char *hdv_end = NULL;
 	char tmp;
+	uint64_t value;
 
 	
-#line 165 "http_response_parse.c"
+#line 166 "http_response_parse.c"
 	{
 	cs = httpres_reader_start;
 	}
 
-#line 83 "http_response_parse.rl"
+#line 86 "http_response_parse.rl"
 	
-#line 172 "http_response_parse.c"
+#line 173 "http_response_parse.c"
 	{
 	int _klen;
 	unsigned int _trans;
@@ -289,32 +290,34 @@ _match:
 	case 9:
 #line 34 "http_response_parse.rl"
 	{
-	  http->response.code = atoi(code_start);
+	  rn_atou64(code_start, 3, &value);
+	  http->response.code = value;
 	  rn_buffer_static(&http->response.msg, msg_start, msg_end - msg_start);
 	  if (cl_start != NULL && cl_end != NULL)
 	  {
-		  tmp = *cl_end;
-		  *cl_end = 0;
-		  http->response.headers.content_length = atoi(cl_start);
-		  *cl_end = tmp;
+		  if (rn_atou64(cl_start, cl_end - cl_start, &value) != (size_t) (cl_end - cl_start)) {
+			  rn_error_set(EBADMSG);
+			  return -1;
+		  }
+		  http->response.headers.content_length = value;
 	  }
 	  http->response.headers.length = p - ((char *) rn_buffer_ptr(http->response.buffer)) + 1;
 	  return 1;
   }
 	break;
 	case 10:
-#line 47 "http_response_parse.rl"
+#line 49 "http_response_parse.rl"
 	{ rn_error_set(EBADMSG); return -1; }
 	break;
 	case 11:
-#line 52 "http_response_parse.rl"
+#line 54 "http_response_parse.rl"
 	{ http->version = RN_HTTP_VERSION_10; }
 	break;
 	case 12:
-#line 53 "http_response_parse.rl"
+#line 55 "http_response_parse.rl"
 	{ http->version = RN_HTTP_VERSION_11; }
 	break;
-#line 318 "http_response_parse.c"
+#line 321 "http_response_parse.c"
 		}
 	}
 
@@ -331,10 +334,10 @@ _again:
 	while ( __nacts-- > 0 ) {
 		switch ( *__acts++ ) {
 	case 10:
-#line 47 "http_response_parse.rl"
+#line 49 "http_response_parse.rl"
 	{ rn_error_set(EBADMSG); return -1; }
 	break;
-#line 338 "http_response_parse.c"
+#line 341 "http_response_parse.c"
 		}
 	}
 	}
@@ -342,7 +345,7 @@ _again:
 	_out: {}
 	}
 
-#line 84 "http_response_parse.rl"
+#line 87 "http_response_parse.rl"
 
 	(void) httpres_reader_en_main;
 	(void) httpres_reader_error;
@@ -32,14 +32,16 @@
 	  }
   }
   action okac		{
-	  http->response.code = atoi(code_start);
+	  rn_atou64(code_start, 3, &value);
+	  http->response.code = value;
 	  rn_buffer_static(&http->response.msg, msg_start, msg_end - msg_start);
 	  if (cl_start != NULL && cl_end != NULL)
 	  {
-		  tmp = *cl_end;
-		  *cl_end = 0;
-		  http->response.headers.content_length = atoi(cl_start);
-		  *cl_end = tmp;
+		  if (rn_atou64(cl_start, cl_end - cl_start, &value) != (size_t) (cl_end - cl_start)) {
+			  rn_error_set(EBADMSG);
+			  return -1;
+		  }
+		  http->response.headers.content_length = value;
 	  }
 	  http->response.headers.length = fpc - ((char *) rn_buffer_ptr(http->response.buffer)) + 1;
 	  return 1;
@@ -78,6 +80,7 @@ int rn_http_response_parse(rn_http_t *http)
 	char *hdv_start = NULL;
 	char *hdv_end = NULL;
 	char tmp;
+	uint64_t value;
 
 	%% write init;
 	%% write exec;
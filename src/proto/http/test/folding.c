@@ -48,7 +48,7 @@ void http_client(void *sched)
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	client = rn_tcp_client(sched, &addr, 0);
+	client = rn_tcp_client(sched, &addr, 0, NULL);
 	XTEST(client != NULL);
 	XTEST(rn_http_init(client, &http) == 0);
 	http_client_send(&http, HEADER1, 200);
@@ -97,7 +97,7 @@ void http_server(void *sched)
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	server = rn_tcp_server(sched, &addr);
+	server = rn_tcp_server(sched, &addr, NULL);
 	XTEST(server != NULL);
 	client = rn_socket_accept(server, &addr);
 	XTEST(client != NULL);
@@ -19,10 +19,10 @@ void http_client(void *sched)
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	client = rn_tcp_client(sched, &addr, 0);
+	client = rn_tcp_client(sched, &addr, 0, NULL);
 	XTEST(client != NULL);
 	XTEST(rn_http_init(client, &http) == 0);
-	XTEST(rn_http_request_send(&http, RN_HTTP_METHOD_GET, "/", NULL) == 0);
+	XTEST(rn_http_request_send(&http, RN_HTTP_METHOD_GET, "/index?a=b#c", NULL) == 0);
 	XTEST(rn_http_response_get(&http));
 	XTEST(rn_buffer_size(&http.response.content) == strlen(HTTP_CONTENT));
 	XTEST(http.response.code == 200);
@@ -32,14 +32,28 @@ void http_client(void *sched)
 
 void http_server_process(void *socket)
 {
+	char *kept;
+	rn_arena_t *arena;
 	rn_buffer_t content;
 	rn_http_t http;
 
+	arena = rn_task_arena(rn_scheduler_self());
+	kept = rn_arena_alloc(arena, 16);
+	XTEST(kept != NULL);
 	XTEST(rn_http_init(socket, &http) == 0);
 	XTEST(rn_http_request_get(&http));
+	XTEST(rn_buffer_strcmp(&http.request.uri, "/index?a=b#c") == 0);
+	XTEST(rn_buffer_strcmp(&http.request.path, "/index") == 0);
 	http.response.code = 200;
 	rn_buffer_set(&content, HTTP_CONTENT);
 	XTEST(rn_http_response_send(&http, &content) == 0);
+	/* Task arena is left alone by http resets */
+	rn_http_reset(&http);
+	XTEST(rn_arena_alloc(arena, 16) != kept);
+	/* Overflowing content length is rejected as a bad message */
+	XTEST(rn_buffer_addstr(http.request.buffer, "GET / HTTP/1.1\r\nContent-Length: 99999999999999999999999\r\n\r\n") > 0);
+	XTEST(rn_http_request_parse(&http) == -1);
+	XTEST(rn_error == EBADMSG);
 	rn_http_destroy(&http);
 	rn_socket_destroy(socket);
 }
@@ -52,7 +66,7 @@ void http_server(void *sched)
 	rn_socket_t *client;
 
 	rn_addr4(&addr, "127.0.0.1", 4242);
-	server = rn_tcp_server(sched, &addr);
+	server = rn_tcp_server(sched, &addr, NULL);
 	XTEST(server != NULL);
 	client = rn_socket_accept(server, &addr);
 	XTEST(client != NULL);
@@ -0,0 +1,107 @@
+/**
+ * @file   http_iobuf.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  http chained buffer body unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define BODY_SIZE	(300 * 1024 + 42)
+
+static char body[BODY_SIZE];
+
+static void check_body(rn_iobuf_t *iobuf)
+{
+	rn_buffer_t *buffer;
+
+	XTEST(rn_iobuf_size(iobuf) == BODY_SIZE);
+	buffer = rn_buffer_create(NULL);
+	XTEST(buffer != NULL);
+	XTEST(rn_iobuf_flatten(iobuf, buffer) == 0);
+	XTEST(memcmp(rn_buffer_ptr(buffer), body, BODY_SIZE) == 0);
+	rn_buffer_destroy(buffer);
+}
+
+void http_client(void *sched)
+{
+	rn_addr_t addr;
+	rn_http_t http;
+	rn_iobuf_t iobuf;
+	rn_socket_t *client;
+
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	client = rn_tcp_client(sched, &addr, 0, NULL);
+	XTEST(client != NULL);
+	XTEST(rn_http_init(client, &http) == 0);
+	XTEST(rn_iobuf(&iobuf) == 0);
+	XTEST(rn_iobuf_add(&iobuf, body, BODY_SIZE) == 0);
+	XTEST(rn_http_request_send_iobuf(&http, RN_HTTP_METHOD_POST, "/", &iobuf) == 0);
+	http.response.body = &iobuf;
+	XTEST(rn_http_response_get(&http));
+	XTEST(http.response.code == 200);
+	XTEST(rn_buffer_size(&http.response.content) == 0);
+	check_body(&iobuf);
+	rn_iobuf_destroy(&iobuf);
+	rn_http_destroy(&http);
+	rn_socket_destroy(client);
+}
+
+void http_server_process(void *socket)
+{
+	rn_http_t http;
+	rn_iobuf_t iobuf;
+
+	XTEST(rn_http_init(socket, &http) == 0);
+	XTEST(rn_iobuf(&iobuf) == 0);
+	http.request.body = &iobuf;
+	XTEST(rn_http_request_get(&http));
+	XTEST(http.request.method == RN_HTTP_METHOD_POST);
+	check_body(&iobuf);
+	http.response.code = 200;
+	XTEST(rn_http_response_send_iobuf(&http, &iobuf) == 0);
+	rn_iobuf_destroy(&iobuf);
+	rn_http_destroy(&http);
+	rn_socket_destroy(socket);
+}
+
+void http_server(void *sched)
+{
+	rn_addr_t addr;
+	rn_socket_t *server;
+	rn_socket_t *client;
+
+	rn_addr4(&addr, "127.0.0.1", 4242);
+	server = rn_tcp_server(sched, &addr, NULL);
+	XTEST(server != NULL);
+	client = rn_socket_accept(server, &addr);
+	XTEST(client != NULL);
+	rn_task_start(sched, http_server_process, client);
+	rn_socket_destroy(server);
+}
+
+/**
+ * Main function for this unit test.
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	rn_sched_t *sched;
+
+	for (i = 0; i < BODY_SIZE; i++) {
+		body[i] = 'a' + (i % 26);
+	}
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, http_server, sched) == 0);
+	XTEST(rn_task_start(sched, http_client, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file   cancel.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Task cancellation tokens
+ *
+ *
+ */
+
+#include "rinoo/scheduler/module.h"
+
+/**
+ * Initializes a cancellation token.
+ *
+ * @param cancel Pointer to the token to initialize
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_cancel(rn_cancel_t *cancel)
+{
+	XASSERT(cancel != NULL, -1);
+
+	cancel->cancelled = false;
+	return rn_list(&cancel->tasks, NULL);
+}
+
+/**
+ * Detaches a task from its token while flushing a token.
+ *
+ * @param node Task token list node
+ */
+static void rn_cancel_flush_task(rn_list_node_t *node)
+{
+	rn_task_t *task = container_of(node, rn_task_t, cancel_node);
+
+	task->cancel = NULL;
+}
+
+/**
+ * Destroys a cancellation token.
+ * All attached tasks are detached, they are not cancelled.
+ *
+ * @param cancel Pointer to the token to destroy
+ */
+void rn_cancel_destroy(rn_cancel_t *cancel)
+{
+	XASSERTN(cancel != NULL);
+
+	rn_list_flush(&cancel->tasks, rn_cancel_flush_task);
+}
+
+/**
+ * Attaches a task to a cancellation token.
+ * Tasks run by this task get attached to the same token.
+ *
+ * @param cancel Pointer to the token to use
+ * @param task Pointer to the task to attach
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_cancel_attach(rn_cancel_t *cancel, rn_task_t *task)
+{
+	XASSERT(cancel != NULL, -1);
+	XASSERT(task != NULL, -1);
+
+	rn_cancel_detach(task);
+	task->cancel = cancel;
+	rn_list_put(&cancel->tasks, &task->cancel_node);
+	return 0;
+}
+
+/**
+ * Detaches a task from its cancellation token, if any.
+ *
+ * @param task Pointer to the task to detach
+ */
+void rn_cancel_detach(rn_task_t *task)
+{
+	XASSERTN(task != NULL);
+
+	if (task->cancel != NULL) {
+		rn_list_remove(&task->cancel->tasks, &task->cancel_node);
+		task->cancel = NULL;
+	}
+}
+
+/**
+ * Triggers a cancellation token.
+ * Every attached task which is waiting gets resumed and its
+ * pending call fails with ECANCELED. Tasks must run on the same
+ * scheduler as the caller.
+ *
+ * @param cancel Pointer to the token to trigger
+ */
+void rn_cancel_trigger(rn_cancel_t *cancel)
+{
+	rn_task_t *task;
+	rn_list_node_t *node;
+
+	XASSERTN(cancel != NULL);
+
+	if (cancel->cancelled == true) {
+		return;
+	}
+	cancel->cancelled = true;
+	for (node = rn_list_head(&cancel->tasks); node != NULL; node = node->next) {
+		task = container_of(node, rn_task_t, cancel_node);
+		if (task->released == true) {
+			rn_task_schedule(task, NULL);
+		}
+	}
+}
+
+/**
+ * Checks whether a cancellation token has been triggered.
+ *
+ * @param cancel Pointer to the token to check
+ *
+ * @return true if the token has been triggered, otherwise false
+ */
+bool rn_cancel_triggered(rn_cancel_t *cancel)
+{
+	return cancel->cancelled;
+}
@@ -21,7 +21,7 @@ rn_channel_t *rn_channel(rn_sched_t *sched)
 {
 	rn_channel_t *channel;
 
-	channel = calloc(1, sizeof(*channel));
+	channel = rn_slab_calloc(&sched->slab, sizeof(*channel));
 	if (channel == NULL) {
 		return NULL;
 	}
@@ -36,7 +36,22 @@ rn_channel_t *rn_channel(rn_sched_t *sched)
  */
 void rn_channel_destroy(rn_channel_t *channel)
 {
-	free(channel);
+	rn_slab_free(channel);
+}
+
+/**
+ * Removes the current task from a channel after a failed wait
+ * (deadline expired or task cancelled).
+ *
+ * @param channel Channel the current task was waiting on.
+ */
+static void rn_channel_abort(rn_channel_t *channel)
+{
+	if (channel->task == rn_task_self()) {
+		channel->buf = NULL;
+		channel->size = 0;
+		channel->task = NULL;
+	}
 }
 
 void *rn_channel_get(rn_channel_t *channel)
@@ -51,8 +66,8 @@ void *rn_channel_get(rn_channel_t *channel)
 	}
 	if (channel->buf == NULL) {
 		channel->task = rn_task_self();
-		rn_task_release(sched);
-		if (channel->buf == NULL) {
+		if (rn_task_release(sched) != 0 || channel->buf == NULL) {
+			rn_channel_abort(channel);
 			return NULL;
 		}
 	}
@@ -93,8 +108,8 @@ int rn_channel_read(rn_channel_t *channel, void *dest, size_t size)
 	}
 	if (channel->buf == NULL) {
 		channel->task = rn_task_self();
-		rn_task_release(sched);
-		if (channel->buf == NULL) {
+		if (rn_task_release(sched) != 0 || channel->buf == NULL) {
+			rn_channel_abort(channel);
 			return -1;
 		}
 	}
@@ -140,6 +155,9 @@ int rn_channel_write(rn_channel_t *channel, void *buf, size_t size)
 		rn_task_schedule(task, NULL);
 	}
 	channel->task = rn_task_self();
-	rn_task_release(sched);
+	if (rn_task_release(sched) != 0) {
+		rn_channel_abort(channel);
+		return -1;
+	}
 	return size;
 }
@@ -20,12 +20,23 @@ rn_sched_t *rn_scheduler(void)
 {
 	rn_sched_t *sched;
 
-	sched = calloc(1, sizeof(*sched));
+	sched = rn_calloc(1, sizeof(*sched));
 	if (sched == NULL) {
 		return NULL;
 	}
+	if (rn_slab(&sched->slab) != 0) {
+		rn_free(sched);
+		return NULL;
+	}
+	if (rn_buffer_pool(&sched->bufpool) != 0) {
+		rn_slab_destroy(&sched->slab);
+		rn_free(sched);
+		return NULL;
+	}
 	if (rn_task_driver_init(sched) != 0) {
-		free(sched);
+		rn_buffer_pool_destroy(&sched->bufpool);
+		rn_slab_destroy(&sched->slab);
+		rn_free(sched);
 		return NULL;
 	}
 	if (rn_epoll_init(sched) != 0) {
@@ -68,7 +79,9 @@ void rn_scheduler_destroy(rn_sched_t *sched)
 	rn_list_flush(&sched->nodes, rn_sched_cancel_task);
 	rn_task_driver_destroy(sched);
 	rn_epoll_destroy(sched);
-	free(sched);
+	rn_buffer_pool_destroy(&sched->bufpool);
+	rn_slab_destroy(&sched->slab);
+	rn_free(sched);
 }
 
 /**
@@ -88,6 +101,50 @@ rn_sched_t *rn_scheduler_self(void)
 	return task->sched;
 }
 
+/**
+ * Registers a polling mode for a node in the file descriptor monitoring layer.
+ *
+ * @param node Scheduler node to monitor.
+ * @param mode Mode to enable (IN/OUT).
+ *
+ * @return 0 on success, or -1 if an error occurs.
+ */
+static int rn_scheduler_register(rn_sched_node_t *node, rn_sched_mode_t mode)
+{
+	if (!rn_mode_registered(node, mode)) {
+		if (rn_mode_registered_get(node) == RN_MODE_NONE) {
+			if (unlikely(rn_epoll_insert(node, mode) != 0)) {
+				return -1;
+			}
+			rn_list_put(&node->sched->nodes, &node->lnode);
+		} else {
+			if (unlikely(rn_epoll_addmode(node, rn_mode_registered_get(node) | mode) != 0)) {
+				return -1;
+			}
+		}
+		rn_mode_registered_set(node, mode);
+	}
+	return 0;
+}
+
+/**
+ * Register a file descriptor in the scheduler without waiting for IO.
+ * Pending events are cleared, so rn_mode_received tells whether
+ * an event occurred since this call.
+ *
+ * @param node Scheduler node to monitor.
+ * @param mode Mode to enable (IN/OUT).
+ *
+ * @return 0 on success, or -1 if an error occurs.
+ */
+int rn_scheduler_watch(rn_sched_node_t *node, rn_sched_mode_t mode)
+{
+	XASSERT(mode != RN_MODE_NONE, -1);
+
+	rn_mode_received_unset(node, mode);
+	return rn_scheduler_register(node, mode);
+}
+
 /**
  * Register a file descriptor in the scheduler and wait for IO.
  *
@@ -98,6 +155,8 @@ rn_sched_t *rn_scheduler_self(void)
  */
 int rn_scheduler_waitfor(rn_sched_node_t *node, rn_sched_mode_t mode)
 {
+	int error;
+
 	XASSERT(mode != RN_MODE_NONE, -1);
 
 	if (node->error != 0) {
@@ -109,18 +168,8 @@ int rn_scheduler_waitfor(rn_sched_node_t *node, rn_sched_mode_t mode)
 		rn_mode_received_unset(node, mode);
 		return 0;
 	}
-	if (!rn_mode_registered(node, mode)) {
-		if (rn_mode_registered_get(node) == RN_MODE_NONE) {
-			if (unlikely(rn_epoll_insert(node, mode) != 0)) {
-				return -1;
-			}
-			rn_list_put(&node->sched->nodes, &node->lnode);
-		} else {
-			if (unlikely(rn_epoll_addmode(node, rn_mode_registered_get(node) | mode) != 0)) {
-				return -1;
-			}
-		}
-		rn_mode_registered_set(node, mode);
+	if (rn_scheduler_register(node, mode) != 0) {
+		return -1;
 	}
 	rn_mode_waiting_set(node, mode);
 	node->task = rn_task_driver_getcurrent(node->sched);
@@ -139,7 +188,16 @@ int rn_scheduler_waitfor(rn_sched_node_t *node, rn_sched_mode_t mode)
 		return 0;
 	}
 	if (rn_task_release(node->sched) != 0 && node->error == 0) {
-		node->error = rn_error;
+		/*
+		 * Deadline, cancellation or stop: the node itself is still
+		 * usable, keep it registered and only detach the task.
+		 */
+		error = rn_error;
+		node->sched->nbpending--;
+		node->task = NULL;
+		rn_mode_waiting_unset(node, mode);
+		rn_error_set(error);
+		return -1;
 	}
 	node->sched->nbpending--;
 	/* Detach task */
@@ -242,6 +300,7 @@ int rn_scheduler_poll(rn_sched_t *sched)
 	int timeout;
 
 	gettimeofday(&sched->clock, NULL);
+	rn_slab_reclaim(&sched->slab);
 	timeout = rn_task_driver_run(sched);
 	if (!rn_sched_end(sched)) {
 		return rn_epoll_poll(sched, timeout);
@@ -258,7 +317,13 @@ int rn_scheduler_poll(rn_sched_t *sched)
  */
 void rn_scheduler_loop(rn_sched_t *sched)
 {
+	rn_allocator_stats_t *prev;
+
 	sched->stop = false;
+	/* The loop thread owns the scheduler slab from now on */
+	rn_slab_owner(&sched->slab);
+	/* Allocations made while looping are accounted to this scheduler */
+	prev = rn_allocator_stats_set(&sched->alloc);
 	if (rn_spawn_start(sched) != 0) {
 		goto loop_stop;
 	}
@@ -267,4 +332,5 @@ void rn_scheduler_loop(rn_sched_t *sched)
 	}
 loop_stop:
 	rn_spawn_join(sched);
+	rn_allocator_stats_set(prev);
 }
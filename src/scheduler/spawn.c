@@ -25,12 +25,12 @@ int rn_spawn(rn_sched_t *sched, int count)
 	rn_thread_t *thread;
 
 	if (sched->spawns.count == 0) {
-		thread = calloc(count, sizeof(*thread));
+		thread = rn_calloc(count, sizeof(*thread));
 		if (thread == NULL) {
 			return -1;
 		}
 	} else {
-		thread = realloc(sched->spawns.thread, sizeof(*thread) * (sched->spawns.count + count));
+		thread = rn_realloc(sched->spawns.thread, sizeof(*thread) * sched->spawns.count, sizeof(*thread) * (sched->spawns.count + count));
 		if (thread == NULL) {
 			return -1;
 		}
@@ -58,7 +58,7 @@ int rn_spawn(rn_sched_t *sched, int count)
 void rn_spawn_destroy(rn_sched_t *sched)
 {
 	if (sched->spawns.thread != NULL) {
-		free(sched->spawns.thread);
+		rn_free(sched->spawns.thread);
 	}
 	sched->spawns.count = 0;
 }
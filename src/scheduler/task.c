@@ -46,6 +46,7 @@ int rn_task_driver_init(rn_sched_t *sched)
 		return -1;
 	}
 	sched->driver.main.sched = sched;
+	rn_arena(&sched->driver.main.arena, 0);
 	sched->driver.current = &sched->driver.main;
 	current_task = &sched->driver.main;
 	return 0;
@@ -61,6 +62,7 @@ void rn_task_driver_destroy(rn_sched_t *sched)
 	XASSERTN(sched != NULL);
 
 	rn_rbtree_flush(&sched->driver.proc_tree);
+	rn_arena_destroy(&sched->driver.main.arena);
 }
 
 /**
@@ -187,14 +189,24 @@ rn_task_t *rn_task(rn_sched_t *sched, rn_task_t *parent, void (*function)(void *
 	XASSERT(parent != NULL, NULL);
 	XASSERT(function != NULL, NULL);
 
-	task = malloc(sizeof(*task));
+	task = rn_aligned_alloc(64, sizeof(*task));
 	if (task == NULL) {
 		return NULL;
 	}
 	task->sched = sched;
+	task->released = false;
 	task->scheduled = false;
+	task->deadlined = false;
 	memset(&task->tv, 0, sizeof(task->tv));
 	memset(&task->proc_node, 0, sizeof(task->proc_node));
+	rn_arena(&task->arena, 0);
+	/* Deadline and cancellation token are inherited from the parent task */
+	task->deadline = parent->deadline;
+	task->cancel = NULL;
+	memset(&task->cancel_node, 0, sizeof(task->cancel_node));
+	if (parent->cancel != NULL) {
+		rn_cancel_attach(parent->cancel, task);
+	}
 
 #if defined(RINOO_JUMP_BOOST)
 	task->active = 1;
@@ -233,11 +245,15 @@ void rn_task_destroy(rn_task_t *task)
 	VALGRIND_STACK_DEREGISTER(task->valgrind_stackid);
 #endif /* !RINOO_DEBUG */
 	rn_task_unschedule(task);
-	free(task);
+	rn_cancel_detach(task);
+	rn_arena_destroy(&task->arena);
+	rn_free(task);
 }
 
 /**
  * Queue a task to be launch asynchronously.
+ * When called from a task, the new task inherits the deadline and
+ * the cancellation token of the calling task.
  *
  * @param sched Pointer to the scheduler to use
  * @param function Pointer to the routine function
@@ -248,11 +264,20 @@ void rn_task_destroy(rn_task_t *task)
 int rn_task_start(rn_sched_t *sched, void (*function)(void *arg), void *arg)
 {
 	rn_task_t *task;
+	rn_task_t *current;
 
 	task = rn_task(sched, &sched->driver.main, function, arg);
 	if (task == NULL) {
 		return -1;
 	}
+	/* The task returns to the main task but runs on behalf of the current one */
+	current = rn_task_driver_getcurrent(sched);
+	if (current != &sched->driver.main) {
+		task->deadline = current->deadline;
+		if (current->cancel != NULL) {
+			rn_cancel_attach(current->cancel, task);
+		}
+	}
 	rn_task_schedule(task, NULL);
 	return 0;
 }
@@ -318,6 +343,9 @@ int rn_task_resume(rn_task_t *task)
 
 /**
  * Release execution of a task currently running on a scheduler.
+ * If the task has a deadline, it is guaranteed to be resumed once
+ * the deadline expires. The task fails to release (or fails once resumed)
+ * if its deadline has expired or if its cancellation token has been triggered.
  *
  * @param sched Pointer to the scheduler to use
  *
@@ -325,8 +353,24 @@ int rn_task_resume(rn_task_t *task)
  */
 int rn_task_release(rn_sched_t *sched)
 {
+	rn_task_t *task;
+
 	XASSERT(sched != NULL, -1);
 
+	task = sched->driver.current;
+	if (rn_task_check(task) != 0) {
+		/* Drop any wake up set for this release */
+		rn_task_unschedule(task);
+		return -1;
+	}
+	if (timerisset(&task->deadline) && (task->scheduled == false || timercmp(&task->tv, &task->deadline, >))) {
+		if (rn_task_schedule(task, &task->deadline) != 0) {
+			return -1;
+		}
+		task->deadlined = true;
+	}
+	task->released = true;
+
 #if defined(RINOO_JUMP_BOOST)
 	fcontext_swap(sched->driver.current, &sched->driver.main);
 # elif defined(RINOO_JUMP_FCONTEXT)
@@ -335,10 +379,15 @@ int rn_task_release(rn_sched_t *sched)
 	#error unhandled RINOO_CONTEXT type
 #endif
 
+	task->released = false;
 	if (sched->stop == true) {
 		rn_error_set(ECANCELED);
 		return -1;
 	}
+	if (rn_task_check(task) != 0) {
+		rn_task_unschedule(task);
+		return -1;
+	}
 	return 0;
 }
 
@@ -359,6 +408,7 @@ int rn_task_schedule(rn_task_t *task, struct timeval *tv)
 		rn_rbtree_remove(&task->sched->driver.proc_tree, &task->proc_node);
 		task->scheduled = false;
 	}
+	task->deadlined = false;
 	if (tv != NULL) {
 		task->tv = *tv;
 	} else {
@@ -388,6 +438,7 @@ int rn_task_unschedule(rn_task_t *task)
 		memset(&task->tv, 0, sizeof(task->tv));
 		task->scheduled = false;
 	}
+	task->deadlined = false;
 	return 0;
 }
 
@@ -429,6 +480,7 @@ int rn_task_wait(rn_sched_t *sched, uint32_t ms)
  */
 int rn_task_pause(rn_sched_t *sched)
 {
+	bool deadlined;
 	rn_task_t *task;
 	struct timeval tv;
 
@@ -438,6 +490,7 @@ int rn_task_pause(rn_sched_t *sched)
 	}
 	if (task->scheduled == true) {
 		tv = task->tv;
+		deadlined = task->deadlined;
 		if (rn_task_schedule(task, NULL) != 0) {
 			return -1;
 		}
@@ -447,6 +500,7 @@ int rn_task_pause(rn_sched_t *sched)
 		if (rn_task_schedule(task, &tv) != 0) {
 			return -1;
 		}
+		task->deadlined = deadlined;
 	} else {
 		if (rn_task_schedule(task, NULL) != 0) {
 			return -1;
@@ -458,6 +512,60 @@ int rn_task_pause(rn_sched_t *sched)
 	return 0;
 }
 
+/**
+ * Sets the deadline of the current task.
+ * Once the deadline expires, every blocking call made by the task
+ * (and by tasks it runs) fails with ETIMEDOUT.
+ *
+ * @param sched Pointer to the scheduler to use
+ * @param ms Deadline in milliseconds from now, 0 removes the deadline
+ *
+ * @return 0 on success or -1 if an error occurs
+ */
+int rn_task_deadline(rn_sched_t *sched, uint32_t ms)
+{
+	rn_task_t *task;
+	struct timeval toadd;
+
+	XASSERT(sched != NULL, -1);
+
+	task = rn_task_driver_getcurrent(sched);
+	if (task->deadlined == true) {
+		/* Drop the wake up set by a previous release */
+		rn_task_unschedule(task);
+	}
+	if (ms == 0) {
+		timerclear(&task->deadline);
+		return 0;
+	}
+	toadd.tv_sec = ms / 1000;
+	toadd.tv_usec = (ms % 1000) * 1000;
+	timeradd(&sched->clock, &toadd, &task->deadline);
+	return 0;
+}
+
+/**
+ * Checks whether a task can keep on running.
+ *
+ * @param task Pointer to the task to check
+ *
+ * @return 0 if the task can go on, or -1 if its deadline expired (ETIMEDOUT) or it has been cancelled (ECANCELED)
+ */
+int rn_task_check(rn_task_t *task)
+{
+	XASSERT(task != NULL, -1);
+
+	if (unlikely(task->cancel != NULL && task->cancel->cancelled)) {
+		rn_error_set(ECANCELED);
+		return -1;
+	}
+	if (unlikely(timerisset(&task->deadline) && timercmp(&task->sched->clock, &task->deadline, >=))) {
+		rn_error_set(ETIMEDOUT);
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * Gets current running task.
  *
@@ -468,3 +576,18 @@ rn_task_t *rn_task_self(void)
 {
 	return current_task;
 }
+
+/**
+ * Gets the arena of the current task.
+ * Memory allocated from it is released at once when the task ends.
+ *
+ * @param sched Pointer to the scheduler to use
+ *
+ * @return Pointer to the current task arena
+ */
+rn_arena_t *rn_task_arena(rn_sched_t *sched)
+{
+	XASSERT(sched != NULL, NULL);
+
+	return &rn_task_driver_getcurrent(sched)->arena;
+}
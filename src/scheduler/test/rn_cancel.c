@@ -0,0 +1,86 @@
+/**
+ * @file   rn_cancel.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_cancel unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+rn_cancel_t cancel;
+rn_channel_t *channel;
+int nb_cancelled = 0;
+
+void waiting_task(void *unused(arg))
+{
+	int x;
+
+	XTEST(rn_cancel_attach(&cancel, rn_task_self()) == 0);
+	XTEST(rn_channel_read(channel, &x, sizeof(x)) == -1);
+	XTEST(rn_error == ECANCELED);
+	nb_cancelled++;
+}
+
+void started_task(void *unused(arg))
+{
+	rn_sched_t *sched = rn_scheduler_self();
+
+	/* Token is inherited from the task which started this one */
+	XTEST(rn_task_self()->cancel == &cancel);
+	XTEST(rn_task_wait(sched, 10000) == -1);
+	XTEST(rn_error == ECANCELED);
+	nb_cancelled++;
+}
+
+void sleeping_task(void *unused(arg))
+{
+	rn_sched_t *sched = rn_scheduler_self();
+
+	XTEST(rn_cancel_attach(&cancel, rn_task_self()) == 0);
+	XTEST(rn_task_start(sched, started_task, NULL) == 0);
+	XTEST(rn_task_wait(sched, 10000) == -1);
+	XTEST(rn_error == ECANCELED);
+	XTEST(rn_task_wait(sched, 10) == -1);
+	XTEST(rn_error == ECANCELED);
+	nb_cancelled++;
+}
+
+void cancelling_task(void *unused(arg))
+{
+	rn_sched_t *sched = rn_scheduler_self();
+
+	XTEST(rn_task_wait(sched, 100) == 0);
+	XTEST(rn_cancel_triggered(&cancel) == false);
+	rn_cancel_trigger(&cancel);
+	XTEST(rn_cancel_triggered(&cancel) == true);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	channel = rn_channel(sched);
+	XTEST(channel != NULL);
+	XTEST(rn_cancel(&cancel) == 0);
+	XTEST(rn_task_start(sched, waiting_task, NULL) == 0);
+	XTEST(rn_task_start(sched, sleeping_task, NULL) == 0);
+	XTEST(rn_task_start(sched, cancelling_task, NULL) == 0);
+	rn_scheduler_loop(sched);
+	XTEST(nb_cancelled == 3);
+	XTEST(rn_list_size(&cancel.tasks) == 0);
+	rn_cancel_destroy(&cancel);
+	rn_channel_destroy(channel);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
@@ -0,0 +1,107 @@
+/**
+ * @file   rn_task_deadline.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_task_deadline unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define LATENCY		50
+
+int check_time(struct timeval *prev, uint32_t ms)
+{
+	uint32_t diffms;
+	struct timeval cur;
+	struct timeval diff;
+
+	if (gettimeofday(&cur, NULL) != 0) {
+		return -1;
+	}
+	timersub(&cur, prev, &diff);
+	diffms = diff.tv_sec * 1000;
+	diffms += diff.tv_usec / 1000;
+	rn_log("Time diff found: %u, expected: %u - %u", diffms, ms, LATENCY);
+	if (diffms > ms) {
+		diffms = diffms - ms;
+	} else {
+		diffms = ms - diffms;
+	}
+	if (diffms > LATENCY) {
+		return -1;
+	}
+	*prev = cur;
+	return 0;
+}
+
+static struct timeval started_deadline;
+
+void child_func(void *deadline)
+{
+	/* Deadline is inherited from the parent task */
+	XTEST(timercmp(&rn_task_self()->deadline, (struct timeval *) deadline, ==));
+	XTEST(rn_task_check(rn_task_self()) == 0);
+}
+
+void task_func(void *channel)
+{
+	int x;
+	struct timeval prev;
+	rn_sched_t *sched = rn_scheduler_self();
+
+	XTEST(gettimeofday(&prev, NULL) == 0);
+	XTEST(rn_task_deadline(sched, 100) == 0);
+	XTEST(rn_task_wait(sched, 1000) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	XTEST(check_time(&prev, 100) == 0);
+	/* Expired deadline makes any blocking call fail right away */
+	XTEST(rn_channel_read(channel, &x, sizeof(x)) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	XTEST(check_time(&prev, 0) == 0);
+	/* Failed wait does not leave its wake up behind */
+	XTEST(rn_task_wait(sched, 50) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	XTEST(rn_task_self()->scheduled == false);
+	/* Removing the deadline */
+	XTEST(rn_task_deadline(sched, 0) == 0);
+	XTEST(rn_task_wait(sched, 100) == 0);
+	XTEST(check_time(&prev, 100) == 0);
+	/* Deadline shorter than the operation */
+	XTEST(rn_task_deadline(sched, 200) == 0);
+	XTEST(rn_channel_read(channel, &x, sizeof(x)) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	XTEST(check_time(&prev, 200) == 0);
+	/* Deadline propagation */
+	XTEST(rn_task_deadline(sched, 100) == 0);
+	XTEST(rn_task_run(sched, child_func, &rn_task_self()->deadline) >= 0);
+	/* Tasks started from a task inherit its deadline too */
+	started_deadline = rn_task_self()->deadline;
+	XTEST(rn_task_start(sched, child_func, &started_deadline) == 0);
+	XTEST(rn_task_deadline(sched, 0) == 0);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+	rn_channel_t *channel;
+
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	channel = rn_channel(sched);
+	XTEST(channel != NULL);
+	XTEST(rn_task_start(sched, task_func, channel) == 0);
+	rn_scheduler_loop(sched);
+	XTEST(channel->task == NULL);
+	rn_channel_destroy(channel);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
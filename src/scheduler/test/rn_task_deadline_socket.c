@@ -0,0 +1,80 @@
+/**
+ * @file   rn_task_deadline_socket.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rn_task_deadline unit test on sockets
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define PORT	4261
+
+static rn_addr_t addr;
+
+void process_client(void *arg)
+{
+	char b;
+	rn_socket_t *socket = arg;
+
+	XTEST(rn_socket_read(socket, &b, 1) == 1);
+	XTEST(rn_socket_write(socket, &b, 1) == 1);
+	rn_socket_destroy(socket);
+}
+
+void server_func(void *sched)
+{
+	rn_socket_t *server;
+	rn_socket_t *client;
+
+	server = rn_tcp_server(sched, &addr, NULL);
+	XTEST(server != NULL);
+	client = rn_socket_accept(server, NULL);
+	XTEST(client != NULL);
+	XTEST(rn_task_start(sched, process_client, client) == 0);
+	rn_socket_destroy(server);
+}
+
+void client_func(void *sched)
+{
+	char b;
+	rn_socket_t *socket;
+
+	socket = rn_tcp_client(sched, &addr, 0, NULL);
+	XTEST(socket != NULL);
+	/* Nothing comes before the deadline */
+	XTEST(rn_task_deadline(sched, 100) == 0);
+	XTEST(rn_socket_read(socket, &b, 1) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	XTEST(rn_socket_write(socket, "x", 1) == -1);
+	XTEST(rn_error == ETIMEDOUT);
+	/* The socket is usable again once the deadline is removed */
+	XTEST(rn_task_deadline(sched, 0) == 0);
+	XTEST(socket->node.error == 0);
+	XTEST(rn_socket_write(socket, "x", 1) == 1);
+	XTEST(rn_socket_read(socket, &b, 1) == 1);
+	XTEST(b == 'x');
+	rn_socket_destroy(socket);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	rn_sched_t *sched;
+
+	rn_addr4(&addr, "127.0.0.1", PORT);
+	sched = rn_scheduler();
+	XTEST(sched != NULL);
+	XTEST(rn_task_start(sched, server_func, sched) == 0);
+	XTEST(rn_task_start(sched, client_func, sched) == 0);
+	rn_scheduler_loop(sched);
+	rn_scheduler_destroy(sched);
+	XPASS();
+}
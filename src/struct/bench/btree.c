@@ -0,0 +1,153 @@
+/**
+ * @file   btree.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Ordered maps benchmark, rn_btree against rn_rbtree.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+typedef struct entry {
+	uint64_t key;
+	rn_rbtree_node_t node;
+} entry_t;
+
+static size_t min_entries = 1000;
+static size_t max_entries = 1000000;
+static volatile uint64_t sink;
+
+static int rbtree_cmp(rn_rbtree_node_t *node1, rn_rbtree_node_t *node2)
+{
+	uint64_t a = container_of(node1, entry_t, node)->key;
+	uint64_t b = container_of(node2, entry_t, node)->key;
+
+	return (a == b ? 0 : (a > b ? 1 : -1));
+}
+
+static void report(const char *tree, const char *op, size_t count, long long start)
+{
+	printf("%-7s %-7s %9zu entries: %8.2f ns/op\n", tree, op, count, (double) (clock_ns() - start) / count);
+}
+
+static void bench_rbtree(entry_t *entries, size_t count)
+{
+	size_t i;
+	uint64_t sum;
+	long long start;
+	entry_t dummy;
+	rn_rbtree_t tree;
+	rn_rbtree_node_t *node;
+
+	XTEST(rn_rbtree(&tree, rbtree_cmp, NULL) == 0);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_rbtree_put(&tree, &entries[i].node) == 0);
+	}
+	report("rbtree", "insert", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		dummy.key = entries[(i * 7919) % count].key;
+		XTEST(rn_rbtree_find(&tree, &dummy.node) != NULL);
+	}
+	report("rbtree", "lookup", count, start);
+	sum = 0;
+	start = clock_ns();
+	for (node = rn_rbtree_head(&tree); node != NULL; node = rn_rbtree_next(node)) {
+		sum += container_of(node, entry_t, node)->key;
+	}
+	report("rbtree", "iterate", count, start);
+	sink = sum;
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		rn_rbtree_remove(&tree, &entries[i].node);
+	}
+	report("rbtree", "delete", count, start);
+	rn_rbtree_flush(&tree);
+}
+
+static void bench_btree(entry_t *entries, size_t count)
+{
+	size_t i;
+	uint64_t sum;
+	long long start;
+	rn_btree_t tree;
+	rn_btree_iter_t iter;
+
+	XTEST(rn_btree(&tree) == 0);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_btree_put(&tree, entries[i].key, &entries[i]) == 0);
+	}
+	report("btree", "insert", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_btree_find(&tree, entries[(i * 7919) % count].key) != NULL);
+	}
+	report("btree", "lookup", count, start);
+	sum = 0;
+	start = clock_ns();
+	if (rn_btree_head(&tree, &iter) == 0) {
+		do {
+			sum += ((entry_t *) rn_btree_iter_value(&iter))->key;
+		} while (rn_btree_next(&iter) == 0);
+	}
+	report("btree", "iterate", count, start);
+	sink = sum;
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_btree_remove(&tree, entries[i].key, NULL) == 0);
+	}
+	report("btree", "delete", count, start);
+	rn_btree_flush(&tree, NULL);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -m min_entries -M max_entries\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	size_t count;
+	entry_t *entries;
+
+	while ((ch = getopt(argc, argv, "hm:M:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'm':
+			min_entries = atol(optarg);
+			break;
+		case 'M':
+			max_entries = atol(optarg);
+			break;
+		default:
+			break;
+		}
+	}
+	if (min_entries < 1) {
+		min_entries = 1;
+	}
+	entries = rn_malloc(max_entries * sizeof(*entries));
+	XTEST(entries != NULL);
+	/* Distinct keys in random order */
+	for (i = 0; i < max_entries; i++) {
+		entries[i].key = rn_hash_u64(i, 0);
+	}
+	for (count = min_entries; count <= max_entries; count *= 10) {
+		bench_rbtree(entries, count);
+		bench_btree(entries, count);
+	}
+	rn_free(entries);
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file   cmap.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Concurrent hash map benchmark, rn_cmap against a locked rn_hmap,
+ *         with read-mostly mixes from 1 to 64 threads.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+#define MAX_THREADS	64
+
+typedef struct entry {
+	uint64_t key;
+	uint64_t value;
+	rn_cmap_node_t cnode;
+	rn_hmap_node_t mnode;
+} entry_t;
+
+typedef struct worker {
+	unsigned int id;
+	unsigned int writes;
+	pthread_t thread;
+} worker_t;
+
+static size_t nb_keys = 100000;
+static size_t nb_ops = 1000000;
+static size_t max_threads = MAX_THREADS;
+static rn_cmap_t cmap;
+static rn_hmap_t hmap;
+static pthread_mutex_t hmap_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static inline uint64_t mix(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return key;
+}
+
+static uint64_t cmap_hash(rn_cmap_node_t *node)
+{
+	return rn_hash_default(&container_of(node, entry_t, cnode)->key, sizeof(uint64_t));
+}
+
+static int cmap_cmp(rn_cmap_node_t *node1, rn_cmap_node_t *node2)
+{
+	return (container_of(node1, entry_t, cnode)->key != container_of(node2, entry_t, cnode)->key);
+}
+
+static void cmap_release(rn_cmap_node_t *node)
+{
+	rn_free(container_of(node, entry_t, cnode));
+}
+
+static uint64_t hmap_hash(rn_hmap_node_t *node)
+{
+	return rn_hash_default(&container_of(node, entry_t, mnode)->key, sizeof(uint64_t));
+}
+
+static int hmap_cmp(rn_hmap_node_t *node1, rn_hmap_node_t *node2)
+{
+	return (container_of(node1, entry_t, mnode)->key != container_of(node2, entry_t, mnode)->key);
+}
+
+static void hmap_release(rn_hmap_node_t *node)
+{
+	rn_free(container_of(node, entry_t, mnode));
+}
+
+static entry_t *entry(uint64_t key)
+{
+	entry_t *entry;
+
+	entry = rn_malloc(sizeof(*entry));
+	XTEST(entry != NULL);
+	entry->key = key;
+	entry->value = key;
+	return entry;
+}
+
+static void *run_cmap(void *arg)
+{
+	size_t i;
+	uint64_t sum;
+	uint64_t seed;
+	entry_t dummy;
+	rn_cmap_node_t *node;
+	worker_t *worker = arg;
+
+	sum = 0;
+	seed = worker->id + 1;
+	for (i = 0; i < nb_ops; i++) {
+		seed = mix(seed + i);
+		dummy.key = seed % nb_keys;
+		if (seed % 1000 < worker->writes) {
+			rn_cmap_put(&cmap, &entry(dummy.key)->cnode);
+			continue;
+		}
+		rn_cmap_enter(&cmap, worker->id);
+		node = rn_cmap_get(&cmap, &dummy.cnode);
+		if (node != NULL) {
+			sum += container_of(node, entry_t, cnode)->value;
+		}
+		rn_cmap_leave(&cmap, worker->id);
+	}
+	XTEST(sum > 0);
+	return NULL;
+}
+
+static void *run_hmap(void *arg)
+{
+	size_t i;
+	uint64_t sum;
+	uint64_t seed;
+	entry_t dummy;
+	entry_t *new;
+	rn_hmap_node_t *node;
+	worker_t *worker = arg;
+
+	sum = 0;
+	seed = worker->id + 1;
+	for (i = 0; i < nb_ops; i++) {
+		seed = mix(seed + i);
+		dummy.key = seed % nb_keys;
+		if (seed % 1000 < worker->writes) {
+			new = entry(dummy.key);
+			pthread_mutex_lock(&hmap_lock);
+			node = rn_hmap_get(&hmap, &dummy.mnode);
+			if (node != NULL) {
+				rn_hmap_remove(&hmap, node);
+			}
+			rn_hmap_put(&hmap, &new->mnode);
+			pthread_mutex_unlock(&hmap_lock);
+			if (node != NULL) {
+				hmap_release(node);
+			}
+			continue;
+		}
+		pthread_mutex_lock(&hmap_lock);
+		node = rn_hmap_get(&hmap, &dummy.mnode);
+		if (node != NULL) {
+			sum += container_of(node, entry_t, mnode)->value;
+		}
+		pthread_mutex_unlock(&hmap_lock);
+	}
+	XTEST(sum > 0);
+	return NULL;
+}
+
+static void bench(int use_cmap, size_t nb_threads, unsigned int writes)
+{
+	size_t i;
+	long long start;
+	worker_t workers[MAX_THREADS];
+
+	if (use_cmap) {
+		XTEST(rn_cmap(&cmap, nb_keys, nb_threads, cmap_hash, cmap_cmp, cmap_release) == 0);
+	} else {
+		XTEST(rn_hmap(&hmap, nb_keys, hmap_hash, hmap_cmp) == 0);
+	}
+	for (i = 0; i < nb_keys; i++) {
+		if (use_cmap) {
+			rn_cmap_put(&cmap, &entry(i)->cnode);
+		} else {
+			rn_hmap_put(&hmap, &entry(i)->mnode);
+		}
+	}
+	start = clock_ns();
+	for (i = 0; i < nb_threads; i++) {
+		workers[i].id = i;
+		workers[i].writes = writes;
+		XTEST(pthread_create(&workers[i].thread, NULL, (use_cmap ? run_cmap : run_hmap), &workers[i]) == 0);
+	}
+	for (i = 0; i < nb_threads; i++) {
+		XTEST(pthread_join(workers[i].thread, NULL) == 0);
+	}
+	printf("%-5s %5.1f%% reads %2zu threads: %8.2f Mops/s\n",
+	       (use_cmap ? "cmap" : "hmap"), (1000 - writes) / 10.0, nb_threads,
+	       (double) nb_ops * nb_threads * 1000 / (clock_ns() - start));
+	if (use_cmap) {
+		rn_cmap_flush(&cmap);
+		rn_cmap_destroy(&cmap);
+	} else {
+		rn_hmap_flush(&hmap, hmap_release);
+		rn_hmap_destroy(&hmap);
+	}
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -k nb_keys -o ops_per_thread -t max_threads\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	size_t threads;
+	static const unsigned int writes[] = { 100, 10, 1 };
+
+	while ((ch = getopt(argc, argv, "hk:o:t:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'k':
+			nb_keys = atol(optarg);
+			break;
+		case 'o':
+			nb_ops = atol(optarg);
+			break;
+		case 't':
+			max_threads = atol(optarg);
+			break;
+		default:
+			break;
+		}
+	}
+	if (nb_keys < 1) {
+		nb_keys = 1;
+	}
+	if (max_threads < 1 || max_threads > MAX_THREADS) {
+		max_threads = MAX_THREADS;
+	}
+	for (i = 0; i < ARRAY_SIZE(writes); i++) {
+		for (threads = 1; threads <= max_threads; threads *= 2) {
+			bench(1, threads, writes[i]);
+			bench(0, threads, writes[i]);
+		}
+	}
+	XPASS();
+	return 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file   hmap.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Hash tables benchmark, rn_hmap against rn_htable.
+ *
+ *
+ */
+
+#include <getopt.h>
+
+#include "rinoo/rinoo.h"
+
+#include "rinoo/global/benchmark.h"
+
+typedef struct entry {
+	uint64_t key;
+	rn_htable_node_t hnode;
+	rn_hmap_node_t mnode;
+} entry_t;
+
+static size_t min_entries = 1000;
+static size_t max_entries = 1000000;
+static size_t table_size = 65536;
+
+static inline uint64_t mix(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	return key;
+}
+
+static uint32_t htable_hash(rn_htable_node_t *node)
+{
+	return (uint32_t) mix(container_of(node, entry_t, hnode)->key);
+}
+
+static int htable_cmp(rn_htable_node_t *node1, rn_htable_node_t *node2)
+{
+	uint64_t a = container_of(node1, entry_t, hnode)->key;
+	uint64_t b = container_of(node2, entry_t, hnode)->key;
+
+	return (a == b ? 0 : (a > b ? 1 : -1));
+}
+
+static uint64_t hmap_hash(rn_hmap_node_t *node)
+{
+	return rn_hash_default(&container_of(node, entry_t, mnode)->key, sizeof(uint64_t));
+}
+
+static int hmap_cmp(rn_hmap_node_t *node1, rn_hmap_node_t *node2)
+{
+	return (container_of(node1, entry_t, mnode)->key != container_of(node2, entry_t, mnode)->key);
+}
+
+static void report(const char *table, const char *op, size_t count, long long start)
+{
+	printf("%-7s %-6s %9zu entries: %8.2f ns/op\n", table, op, count, (double) (clock_ns() - start) / count);
+}
+
+static void bench_htable(entry_t *entries, size_t count)
+{
+	size_t i;
+	long long start;
+	entry_t dummy;
+	rn_htable_t htable;
+
+	XTEST(rn_htable(&htable, table_size, htable_hash, htable_cmp) == 0);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		rn_htable_put(&htable, &entries[i].hnode);
+	}
+	report("htable", "insert", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		dummy.key = entries[(i * 7919) % count].key;
+		XTEST(rn_htable_get(&htable, &dummy.hnode) != NULL);
+	}
+	report("htable", "lookup", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		rn_htable_remove(&htable, &entries[i].hnode);
+	}
+	report("htable", "delete", count, start);
+	rn_htable_destroy(&htable);
+}
+
+static void bench_hmap(entry_t *entries, size_t count)
+{
+	size_t i;
+	long long start;
+	entry_t dummy;
+	rn_hmap_t hmap;
+
+	XTEST(rn_hmap(&hmap, 0, hmap_hash, hmap_cmp) == 0);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_hmap_put(&hmap, &entries[i].mnode) == 0);
+	}
+	report("hmap", "insert", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		dummy.key = entries[(i * 7919) % count].key;
+		XTEST(rn_hmap_get(&hmap, &dummy.mnode) != NULL);
+	}
+	report("hmap", "lookup", count, start);
+	start = clock_ns();
+	for (i = 0; i < count; i++) {
+		XTEST(rn_hmap_remove(&hmap, &entries[i].mnode) == 0);
+	}
+	report("hmap", "delete", count, start);
+	rn_hmap_destroy(&hmap);
+}
+
+static void usage(const char* procname) {
+	printf("usage: %s -h [help] -m min_entries -M max_entries -t htable_size\r\n", procname);
+}
+
+int main(int argc, char* argv[])
+{
+	int ch;
+	size_t i;
+	size_t count;
+	entry_t *entries;
+
+	while ((ch = getopt(argc, argv, "hm:M:t:")) > 0) {
+		switch (ch) {
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		case 'm':
+			min_entries = atol(optarg);
+			break;
+		case 'M':
+			max_entries = atol(optarg);
+			break;
+		case 't':
+			table_size = atol(optarg);
+			break;
+		default:
+			break;
+		}
+	}
+	if (min_entries < 1) {
+		min_entries = 1;
+	}
+	entries = rn_malloc(max_entries * sizeof(*entries));
+	XTEST(entries != NULL);
+	for (i = 0; i < max_entries; i++) {
+		entries[i].key = ((uint64_t) random() << 31) ^ random();
+	}
+	for (count = min_entries; count <= max_entries; count *= 10) {
+		bench_htable(entries, count);
+		bench_hmap(entries, count);
+	}
+	rn_free(entries);
+	XPASS();
+	return 0;
+}
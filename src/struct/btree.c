@@ -0,0 +1,573 @@
+/**
+ * @file   btree.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  B+tree ordered map functions. Keys are 64-bit integers stored
+ *         inline in wide nodes, so that a lookup reads a few cache lines
+ *         per level and never calls a compare function. Values live in
+ *         the leaves, which are chained for in-order iteration.
+ *
+ *         Inner node keys are separators: keys[i] is the smallest key
+ *         of children[i + 1]. Nodes other than the root keep at least
+ *         RN_BTREE_MIN keys (leaves) or children (inner nodes).
+ *
+ *
+ */
+
+#include "rinoo/struct/module.h"
+
+/**
+ * Gets the position of the first key greater than or equal to a key.
+ *
+ * @param keys Sorted keys
+ * @param nbkeys Number of keys
+ * @param key Key to look for
+ *
+ * @return Position between 0 and nbkeys
+ */
+static inline unsigned int rn_btree_lower(const uint64_t *keys, unsigned int nbkeys, uint64_t key)
+{
+	unsigned int half;
+	const uint64_t *base = keys;
+
+	if (nbkeys == 0) {
+		return 0;
+	}
+	/* Branchless binary search */
+	while (nbkeys > 1) {
+		half = nbkeys / 2;
+		base = (base[half] < key ? base + half : base);
+		nbkeys -= half;
+	}
+	return (base - keys) + (*base < key);
+}
+
+/**
+ * Gets the position of the first key greater than a key.
+ *
+ * @param keys Sorted keys
+ * @param nbkeys Number of keys
+ * @param key Key to look for
+ *
+ * @return Position between 0 and nbkeys
+ */
+static inline unsigned int rn_btree_upper(const uint64_t *keys, unsigned int nbkeys, uint64_t key)
+{
+	unsigned int half;
+	const uint64_t *base = keys;
+
+	if (nbkeys == 0) {
+		return 0;
+	}
+	while (nbkeys > 1) {
+		half = nbkeys / 2;
+		base = (base[half] <= key ? base + half : base);
+		nbkeys -= half;
+	}
+	return (base - keys) + (*base <= key);
+}
+
+/**
+ * Inserts a key in a leaf which is not full.
+ *
+ * @param leaf Pointer to the leaf
+ * @param pos Key position
+ * @param key Key to insert
+ * @param value Value to insert
+ */
+static void rn_btree_leaf_insert(rn_btree_leaf_t *leaf, unsigned int pos, uint64_t key, void *value)
+{
+	memmove(&leaf->keys[pos + 1], &leaf->keys[pos], (leaf->nbkeys - pos) * sizeof(*leaf->keys));
+	memmove(&leaf->values[pos + 1], &leaf->values[pos], (leaf->nbkeys - pos) * sizeof(*leaf->values));
+	leaf->keys[pos] = key;
+	leaf->values[pos] = value;
+	leaf->nbkeys++;
+}
+
+/**
+ * Inserts a separator key and its right child in an inner node. If the
+ * node is full, it is split with the preallocated right node.
+ *
+ * @param inner Pointer to the inner node
+ * @param pos Separator position
+ * @param key Separator key
+ * @param child Right child of the separator
+ * @param right Empty node to split into, or NULL if the node is not full
+ * @param split_key Set to the key promoted to the parent on split
+ */
+static void rn_btree_inner_insert(rn_btree_inner_t *inner, unsigned int pos, uint64_t key, void *child, rn_btree_inner_t *right, uint64_t *split_key)
+{
+	uint64_t keys[RN_BTREE_ORDER + 1];
+	void *children[RN_BTREE_ORDER + 2];
+
+	if (right == NULL) {
+		memmove(&inner->keys[pos + 1], &inner->keys[pos], (inner->nbkeys - pos) * sizeof(*inner->keys));
+		memmove(&inner->children[pos + 2], &inner->children[pos + 1], (inner->nbkeys - pos) * sizeof(*inner->children));
+		inner->keys[pos] = key;
+		inner->children[pos + 1] = child;
+		inner->nbkeys++;
+		return;
+	}
+	memcpy(keys, inner->keys, pos * sizeof(*keys));
+	keys[pos] = key;
+	memcpy(&keys[pos + 1], &inner->keys[pos], (RN_BTREE_ORDER - pos) * sizeof(*keys));
+	memcpy(children, inner->children, (pos + 1) * sizeof(*children));
+	children[pos + 1] = child;
+	memcpy(&children[pos + 2], &inner->children[pos + 1], (RN_BTREE_ORDER - pos) * sizeof(*children));
+	/* RN_BTREE_MIN keys stay, the next one moves up */
+	memcpy(inner->keys, keys, RN_BTREE_MIN * sizeof(*keys));
+	memcpy(inner->children, children, (RN_BTREE_MIN + 1) * sizeof(*children));
+	inner->nbkeys = RN_BTREE_MIN;
+	*split_key = keys[RN_BTREE_MIN];
+	right->nbkeys = RN_BTREE_ORDER - RN_BTREE_MIN;
+	memcpy(right->keys, &keys[RN_BTREE_MIN + 1], right->nbkeys * sizeof(*keys));
+	memcpy(right->children, &children[RN_BTREE_MIN + 1], (right->nbkeys + 1) * sizeof(*children));
+}
+
+/**
+ * Inserts a key in a subtree.
+ *
+ * @param node Subtree root
+ * @param depth Subtree depth, 0 for a leaf
+ * @param key Key to insert
+ * @param value Value to insert
+ * @param split_key Set to the separator key if the subtree root was split
+ * @param split Set to the new right node if the subtree root was split, otherwise NULL
+ *
+ * @return 0 if inserted, 1 if an existing value was replaced, or -1 on error
+ */
+static int rn_btree_insert(void *node, unsigned int depth, uint64_t key, void *value, uint64_t *split_key, void **split)
+{
+	int ret;
+	unsigned int pos;
+	uint64_t child_key;
+	void *child_split;
+	rn_btree_leaf_t *leaf;
+	rn_btree_leaf_t *leaf_right;
+	rn_btree_inner_t *inner;
+	rn_btree_inner_t *inner_right;
+
+	*split = NULL;
+	if (depth == 0) {
+		leaf = node;
+		pos = rn_btree_lower(leaf->keys, leaf->nbkeys, key);
+		if (pos < leaf->nbkeys && leaf->keys[pos] == key) {
+			leaf->values[pos] = value;
+			return 1;
+		}
+		if (leaf->nbkeys < RN_BTREE_ORDER) {
+			rn_btree_leaf_insert(leaf, pos, key, value);
+			return 0;
+		}
+		leaf_right = rn_malloc(sizeof(*leaf_right));
+		if (leaf_right == NULL) {
+			return -1;
+		}
+		leaf_right->nbkeys = RN_BTREE_ORDER - RN_BTREE_MIN;
+		memcpy(leaf_right->keys, &leaf->keys[RN_BTREE_MIN], leaf_right->nbkeys * sizeof(*leaf->keys));
+		memcpy(leaf_right->values, &leaf->values[RN_BTREE_MIN], leaf_right->nbkeys * sizeof(*leaf->values));
+		leaf->nbkeys = RN_BTREE_MIN;
+		leaf_right->next = leaf->next;
+		leaf->next = leaf_right;
+		if (pos > RN_BTREE_MIN) {
+			rn_btree_leaf_insert(leaf_right, pos - RN_BTREE_MIN, key, value);
+		} else {
+			rn_btree_leaf_insert(leaf, pos, key, value);
+		}
+		*split_key = leaf_right->keys[0];
+		*split = leaf_right;
+		return 0;
+	}
+	inner = node;
+	inner_right = NULL;
+	if (inner->nbkeys == RN_BTREE_ORDER) {
+		/* Allocated first, so that a child split is never lost */
+		inner_right = rn_malloc(sizeof(*inner_right));
+		if (inner_right == NULL) {
+			return -1;
+		}
+	}
+	pos = rn_btree_upper(inner->keys, inner->nbkeys, key);
+	ret = rn_btree_insert(inner->children[pos], depth - 1, key, value, &child_key, &child_split);
+	if (child_split == NULL) {
+		rn_free(inner_right);
+		return ret;
+	}
+	rn_btree_inner_insert(inner, pos, child_key, child_split, inner_right, split_key);
+	*split = inner_right;
+	return ret;
+}
+
+/**
+ * Gets the number of keys of a node.
+ *
+ * @param node Pointer to the node
+ * @param depth Node depth, 0 for a leaf
+ *
+ * @return Number of keys
+ */
+static inline unsigned int rn_btree_nbkeys(void *node, unsigned int depth)
+{
+	return (depth == 0 ? ((rn_btree_leaf_t *) node)->nbkeys : ((rn_btree_inner_t *) node)->nbkeys);
+}
+
+/**
+ * Fixes an underflowing child of an inner node, by merging it with a
+ * sibling or moving one key from that sibling.
+ *
+ * @param inner Pointer to the inner node
+ * @param depth Inner node depth
+ * @param pos Position of the underflowing child
+ */
+static void rn_btree_rebalance(rn_btree_inner_t *inner, unsigned int depth, unsigned int pos)
+{
+	unsigned int left;
+	rn_btree_leaf_t *leaf_left;
+	rn_btree_leaf_t *leaf_right;
+	rn_btree_inner_t *inner_left;
+	rn_btree_inner_t *inner_right;
+
+	left = (pos > 0 ? pos - 1 : pos);
+	if (depth == 1) {
+		leaf_left = inner->children[left];
+		leaf_right = inner->children[left + 1];
+		if (leaf_left->nbkeys + leaf_right->nbkeys <= RN_BTREE_ORDER) {
+			memcpy(&leaf_left->keys[leaf_left->nbkeys], leaf_right->keys, leaf_right->nbkeys * sizeof(*leaf_right->keys));
+			memcpy(&leaf_left->values[leaf_left->nbkeys], leaf_right->values, leaf_right->nbkeys * sizeof(*leaf_right->values));
+			leaf_left->nbkeys += leaf_right->nbkeys;
+			leaf_left->next = leaf_right->next;
+			rn_free(leaf_right);
+			goto merged;
+		}
+		if (leaf_left->nbkeys > leaf_right->nbkeys) {
+			leaf_left->nbkeys--;
+			rn_btree_leaf_insert(leaf_right, 0, leaf_left->keys[leaf_left->nbkeys], leaf_left->values[leaf_left->nbkeys]);
+		} else {
+			rn_btree_leaf_insert(leaf_left, leaf_left->nbkeys, leaf_right->keys[0], leaf_right->values[0]);
+			leaf_right->nbkeys--;
+			memmove(leaf_right->keys, &leaf_right->keys[1], leaf_right->nbkeys * sizeof(*leaf_right->keys));
+			memmove(leaf_right->values, &leaf_right->values[1], leaf_right->nbkeys * sizeof(*leaf_right->values));
+		}
+		inner->keys[left] = leaf_right->keys[0];
+		return;
+	}
+	inner_left = inner->children[left];
+	inner_right = inner->children[left + 1];
+	if (inner_left->nbkeys + inner_right->nbkeys + 1 <= RN_BTREE_ORDER) {
+		inner_left->keys[inner_left->nbkeys] = inner->keys[left];
+		memcpy(&inner_left->keys[inner_left->nbkeys + 1], inner_right->keys, inner_right->nbkeys * sizeof(*inner_right->keys));
+		memcpy(&inner_left->children[inner_left->nbkeys + 1], inner_right->children, (inner_right->nbkeys + 1) * sizeof(*inner_right->children));
+		inner_left->nbkeys += inner_right->nbkeys + 1;
+		rn_free(inner_right);
+		goto merged;
+	}
+	if (inner_left->nbkeys > inner_right->nbkeys) {
+		memmove(&inner_right->keys[1], inner_right->keys, inner_right->nbkeys * sizeof(*inner_right->keys));
+		memmove(&inner_right->children[1], inner_right->children, (inner_right->nbkeys + 1) * sizeof(*inner_right->children));
+		inner_right->keys[0] = inner->keys[left];
+		inner_right->children[0] = inner_left->children[inner_left->nbkeys];
+		inner_right->nbkeys++;
+		inner->keys[left] = inner_left->keys[inner_left->nbkeys - 1];
+		inner_left->nbkeys--;
+	} else {
+		inner_left->keys[inner_left->nbkeys] = inner->keys[left];
+		inner_left->children[inner_left->nbkeys + 1] = inner_right->children[0];
+		inner_left->nbkeys++;
+		inner->keys[left] = inner_right->keys[0];
+		inner_right->nbkeys--;
+		memmove(inner_right->keys, &inner_right->keys[1], inner_right->nbkeys * sizeof(*inner_right->keys));
+		memmove(inner_right->children, &inner_right->children[1], (inner_right->nbkeys + 1) * sizeof(*inner_right->children));
+	}
+	return;
+merged:
+	/* The right child is gone with its separator */
+	inner->nbkeys--;
+	memmove(&inner->keys[left], &inner->keys[left + 1], (inner->nbkeys - left) * sizeof(*inner->keys));
+	memmove(&inner->children[left + 1], &inner->children[left + 2], (inner->nbkeys - left) * sizeof(*inner->children));
+}
+
+/**
+ * Removes a key from a subtree.
+ *
+ * @param node Subtree root
+ * @param depth Subtree depth, 0 for a leaf
+ * @param key Key to remove
+ * @param value Set to the removed value
+ *
+ * @return 0 on success, or -1 if the key was not found
+ */
+static int rn_btree_delete(void *node, unsigned int depth, uint64_t key, void **value)
+{
+	unsigned int pos;
+	unsigned int min;
+	rn_btree_leaf_t *leaf;
+	rn_btree_inner_t *inner;
+
+	if (depth == 0) {
+		leaf = node;
+		pos = rn_btree_lower(leaf->keys, leaf->nbkeys, key);
+		if (pos == leaf->nbkeys || leaf->keys[pos] != key) {
+			return -1;
+		}
+		*value = leaf->values[pos];
+		leaf->nbkeys--;
+		memmove(&leaf->keys[pos], &leaf->keys[pos + 1], (leaf->nbkeys - pos) * sizeof(*leaf->keys));
+		memmove(&leaf->values[pos], &leaf->values[pos + 1], (leaf->nbkeys - pos) * sizeof(*leaf->values));
+		return 0;
+	}
+	inner = node;
+	pos = rn_btree_upper(inner->keys, inner->nbkeys, key);
+	if (rn_btree_delete(inner->children[pos], depth - 1, key, value) != 0) {
+		return -1;
+	}
+	min = (depth == 1 ? RN_BTREE_MIN : RN_BTREE_MIN - 1);
+	if (rn_btree_nbkeys(inner->children[pos], depth - 1) < min) {
+		rn_btree_rebalance(inner, depth, pos);
+	}
+	return 0;
+}
+
+/**
+ * Frees a subtree.
+ *
+ * @param node Subtree root
+ * @param depth Subtree depth, 0 for a leaf
+ */
+static void rn_btree_free(void *node, unsigned int depth)
+{
+	unsigned int i;
+	rn_btree_inner_t *inner;
+
+	if (depth > 0) {
+		inner = node;
+		for (i = 0; i <= inner->nbkeys; i++) {
+			rn_btree_free(inner->children[i], depth - 1);
+		}
+	}
+	rn_free(node);
+}
+
+/**
+ * Initializes a B+tree.
+ *
+ * @param tree Pointer to the tree to initialize
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_btree(rn_btree_t *tree)
+{
+	XASSERT(tree != NULL, -1);
+
+	tree->size = 0;
+	tree->depth = 0;
+	tree->root = NULL;
+	tree->head = NULL;
+	return 0;
+}
+
+/**
+ * Removes every key from a B+tree.
+ *
+ * @param tree Pointer to the tree
+ * @param delete Function called on each value, or NULL
+ */
+void rn_btree_flush(rn_btree_t *tree, void (*delete)(void *value))
+{
+	unsigned int i;
+	rn_btree_leaf_t *leaf;
+
+	if (delete != NULL) {
+		for (leaf = tree->head; leaf != NULL; leaf = leaf->next) {
+			for (i = 0; i < leaf->nbkeys; i++) {
+				delete(leaf->values[i]);
+			}
+		}
+	}
+	if (tree->root != NULL) {
+		rn_btree_free(tree->root, tree->depth);
+	}
+	rn_btree(tree);
+}
+
+/**
+ * Adds a key to a B+tree. If the key already exists, its value is replaced.
+ *
+ * @param tree Pointer to the tree
+ * @param key Key to add
+ * @param value Value associated to the key
+ *
+ * @return 0 if the key was added, 1 if its value was replaced, or -1 on error
+ */
+int rn_btree_put(rn_btree_t *tree, uint64_t key, void *value)
+{
+	int ret;
+	uint64_t split_key;
+	void *split;
+	rn_btree_inner_t *root;
+
+	if (tree->root == NULL) {
+		tree->head = rn_malloc(sizeof(*tree->head));
+		if (tree->head == NULL) {
+			return -1;
+		}
+		tree->head->nbkeys = 0;
+		tree->head->next = NULL;
+		tree->root = tree->head;
+		tree->depth = 0;
+	}
+	root = NULL;
+	if (rn_btree_nbkeys(tree->root, tree->depth) == RN_BTREE_ORDER) {
+		/* Allocated first, so that a root split is never lost */
+		root = rn_malloc(sizeof(*root));
+		if (root == NULL) {
+			return -1;
+		}
+	}
+	ret = rn_btree_insert(tree->root, tree->depth, key, value, &split_key, &split);
+	if (split != NULL) {
+		root->nbkeys = 1;
+		root->keys[0] = split_key;
+		root->children[0] = tree->root;
+		root->children[1] = split;
+		tree->root = root;
+		tree->depth++;
+	} else {
+		rn_free(root);
+	}
+	if (ret == 0) {
+		tree->size++;
+	}
+	return ret;
+}
+
+/**
+ * Removes a key from a B+tree.
+ *
+ * @param tree Pointer to the tree
+ * @param key Key to remove
+ * @param value If not NULL, set to the removed value
+ *
+ * @return 0 on success, or -1 if the key was not found
+ */
+int rn_btree_remove(rn_btree_t *tree, uint64_t key, void **value)
+{
+	void *old;
+	rn_btree_inner_t *root;
+
+	if (tree->root == NULL || rn_btree_delete(tree->root, tree->depth, key, &old) != 0) {
+		return -1;
+	}
+	if (value != NULL) {
+		*value = old;
+	}
+	tree->size--;
+	if (tree->depth > 0) {
+		root = tree->root;
+		if (root->nbkeys == 0) {
+			tree->root = root->children[0];
+			tree->depth--;
+			rn_free(root);
+		}
+	} else if (tree->head->nbkeys == 0) {
+		rn_free(tree->head);
+		rn_btree(tree);
+	}
+	return 0;
+}
+
+/**
+ * Finds a key in a B+tree.
+ *
+ * @param tree Pointer to the tree
+ * @param key Key to look for
+ *
+ * @return Value associated to the key, or NULL if not found
+ */
+void *rn_btree_find(rn_btree_t *tree, uint64_t key)
+{
+	void *node;
+	unsigned int pos;
+	unsigned int depth;
+	rn_btree_leaf_t *leaf;
+	rn_btree_inner_t *inner;
+
+	node = tree->root;
+	if (node == NULL) {
+		return NULL;
+	}
+	for (depth = tree->depth; depth > 0; depth--) {
+		inner = node;
+		node = inner->children[rn_btree_upper(inner->keys, inner->nbkeys, key)];
+	}
+	leaf = node;
+	pos = rn_btree_lower(leaf->keys, leaf->nbkeys, key);
+	if (pos == leaf->nbkeys || leaf->keys[pos] != key) {
+		return NULL;
+	}
+	return leaf->values[pos];
+}
+
+/**
+ * Sets an iterator on the smallest key of a B+tree.
+ *
+ * @param tree Pointer to the tree
+ * @param iter Iterator to set
+ *
+ * @return 0 on success, or -1 if the tree is empty
+ */
+int rn_btree_head(rn_btree_t *tree, rn_btree_iter_t *iter)
+{
+	iter->leaf = tree->head;
+	iter->pos = 0;
+	return (iter->leaf != NULL && iter->leaf->nbkeys > 0 ? 0 : -1);
+}
+
+/**
+ * Sets an iterator on the smallest key greater than or equal to a key.
+ *
+ * @param tree Pointer to the tree
+ * @param key Key to look for
+ * @param iter Iterator to set
+ *
+ * @return 0 on success, or -1 if there is no such key
+ */
+int rn_btree_seek(rn_btree_t *tree, uint64_t key, rn_btree_iter_t *iter)
+{
+	void *node;
+	unsigned int depth;
+	rn_btree_inner_t *inner;
+
+	node = tree->root;
+	if (node == NULL) {
+		return -1;
+	}
+	for (depth = tree->depth; depth > 0; depth--) {
+		inner = node;
+		node = inner->children[rn_btree_upper(inner->keys, inner->nbkeys, key)];
+	}
+	iter->leaf = node;
+	iter->pos = rn_btree_lower(iter->leaf->keys, iter->leaf->nbkeys, key);
+	if (iter->pos == iter->leaf->nbkeys) {
+		iter->leaf = iter->leaf->next;
+		iter->pos = 0;
+	}
+	return (iter->leaf != NULL ? 0 : -1);
+}
+
+/**
+ * Moves an iterator to the next key.
+ *
+ * @param iter Iterator to move
+ *
+ * @return 0 on success, or -1 if the iterator was on the last key
+ */
+int rn_btree_next(rn_btree_iter_t *iter)
+{
+	iter->pos++;
+	if (iter->pos >= iter->leaf->nbkeys) {
+		iter->leaf = iter->leaf->next;
+		iter->pos = 0;
+	}
+	return (iter->leaf != NULL ? 0 : -1);
+}
@@ -0,0 +1,426 @@
+/**
+ * @file   cmap.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Concurrent hash map functions. The map is split in shards,
+ *         each one with its own lock taken by writers only. Readers walk
+ *         bucket chains without locking, inside a read section opened
+ *         on their own slot (usually one per spawn).
+ *
+ *         Removed nodes are retired with the current map epoch and only
+ *         released two epochs later: the epoch advances when every slot
+ *         in a read section has seen the current one, so no reader can
+ *         still be holding a node by then.
+ *
+ *
+ */
+
+#include "rinoo/struct/module.h"
+
+#define RN_CMAP_SHARDS_MAX	256
+#define RN_CMAP_BUCKETS_MIN	16
+
+/**
+ * Gets the smallest power of two greater than or equal to a value.
+ *
+ * @param value Value to round
+ *
+ * @return Power of two
+ */
+static size_t rn_cmap_pow2(size_t value)
+{
+	size_t result;
+
+	for (result = 1; result < value; result *= 2);
+	return result;
+}
+
+/**
+ * Gets the shard of a hash.
+ *
+ * @param cmap Pointer to the map
+ * @param hash Node hash
+ *
+ * @return Pointer to the shard
+ */
+static inline rn_cmap_shard_t *rn_cmap_shard(rn_cmap_t *cmap, uint64_t hash)
+{
+	return &cmap->shards[(hash >> 32) & (cmap->nbshards - 1)];
+}
+
+/**
+ * Gets the bucket of a hash in its shard.
+ *
+ * @param cmap Pointer to the map
+ * @param shard Pointer to the shard
+ * @param hash Node hash
+ *
+ * @return Pointer to the bucket head
+ */
+static inline rn_cmap_node_t **rn_cmap_bucket(rn_cmap_t *cmap, rn_cmap_shard_t *shard, uint64_t hash)
+{
+	return &shard->buckets[hash & (cmap->nbbuckets - 1)];
+}
+
+/**
+ * Tries to advance the map epoch. It succeeds when every slot in a read
+ * section has seen the current epoch.
+ *
+ * @param cmap Pointer to the map
+ */
+static void rn_cmap_advance(rn_cmap_t *cmap)
+{
+	size_t i;
+	uint64_t epoch;
+	uint64_t current;
+
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	epoch = __atomic_load_n(&cmap->epoch, __ATOMIC_SEQ_CST);
+	for (i = 0; i < cmap->nbslots; i++) {
+		current = __atomic_load_n(&cmap->slots[i].epoch, __ATOMIC_ACQUIRE);
+		if (current != 0 && current != epoch) {
+			return;
+		}
+	}
+	__atomic_compare_exchange_n(&cmap->epoch, &epoch, epoch + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+/**
+ * Retires a node unlinked from a shard. The shard lock must be held.
+ *
+ * @param cmap Pointer to the map
+ * @param shard Pointer to the shard
+ * @param node Node to retire
+ */
+static void rn_cmap_retire(rn_cmap_t *cmap, rn_cmap_shard_t *shard, rn_cmap_node_t *node)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	node->epoch = __atomic_load_n(&cmap->epoch, __ATOMIC_SEQ_CST);
+	node->retired = shard->retired;
+	shard->retired = node;
+	shard->nbretired++;
+}
+
+/**
+ * Releases shard retired nodes which cannot be reached by readers anymore.
+ *
+ * @param cmap Pointer to the map
+ * @param shard Pointer to the shard
+ */
+static void rn_cmap_collect(rn_cmap_t *cmap, rn_cmap_shard_t *shard)
+{
+	uint64_t epoch;
+	rn_cmap_node_t *node;
+	rn_cmap_node_t *list;
+	rn_cmap_node_t **prev;
+
+	epoch = __atomic_load_n(&cmap->epoch, __ATOMIC_ACQUIRE);
+	pthread_mutex_lock(&shard->lock);
+	/* Newest nodes come first, the list is cut at the first releasable one */
+	for (prev = &shard->retired; *prev != NULL && (*prev)->epoch + 2 > epoch; prev = &(*prev)->retired);
+	list = *prev;
+	*prev = NULL;
+	for (node = list; node != NULL; node = node->retired) {
+		shard->nbretired--;
+	}
+	pthread_mutex_unlock(&shard->lock);
+	while (list != NULL) {
+		node = list;
+		list = list->retired;
+		if (cmap->release != NULL) {
+			cmap->release(node);
+		}
+	}
+}
+
+/**
+ * Initializes a concurrent map.
+ *
+ * @param cmap Map to initialize
+ * @param size Expected number of nodes
+ * @param nbslots Number of reader slots, usually the number of spawns plus one
+ * @param hash Hash function, usually rn_hash_default() of the node key
+ * @param compare Node compare function, returning 0 on equality
+ * @param release Function called once a removed node cannot be reached anymore
+ *
+ * @return 0 on success otherwise -1
+ */
+int rn_cmap(rn_cmap_t *cmap, size_t size, size_t nbslots, uint64_t (*hash)(rn_cmap_node_t *node), int (*compare)(rn_cmap_node_t *node1, rn_cmap_node_t *node2), void (*release)(rn_cmap_node_t *node))
+{
+	size_t i;
+
+	cmap->epoch = 1;
+	cmap->nbslots = (nbslots > 0 ? nbslots : 1);
+	cmap->nbshards = rn_cmap_pow2(cmap->nbslots * 4);
+	if (cmap->nbshards > RN_CMAP_SHARDS_MAX) {
+		cmap->nbshards = RN_CMAP_SHARDS_MAX;
+	}
+	cmap->nbbuckets = rn_cmap_pow2(size / cmap->nbshards);
+	if (cmap->nbbuckets < RN_CMAP_BUCKETS_MIN) {
+		cmap->nbbuckets = RN_CMAP_BUCKETS_MIN;
+	}
+	cmap->hash = hash;
+	cmap->compare = compare;
+	cmap->release = release;
+	cmap->slots = rn_aligned_alloc(sizeof(*cmap->slots), cmap->nbslots * sizeof(*cmap->slots));
+	if (cmap->slots == NULL) {
+		return -1;
+	}
+	memset(cmap->slots, 0, cmap->nbslots * sizeof(*cmap->slots));
+	cmap->shards = rn_aligned_alloc(sizeof(*cmap->shards), cmap->nbshards * sizeof(*cmap->shards));
+	if (cmap->shards == NULL) {
+		rn_free(cmap->slots);
+		return -1;
+	}
+	for (i = 0; i < cmap->nbshards; i++) {
+		cmap->shards[i].size = 0;
+		cmap->shards[i].nbretired = 0;
+		cmap->shards[i].retired = NULL;
+		cmap->shards[i].buckets = rn_calloc(cmap->nbbuckets, sizeof(*cmap->shards[i].buckets));
+		if (cmap->shards[i].buckets == NULL) {
+			while (i-- > 0) {
+				pthread_mutex_destroy(&cmap->shards[i].lock);
+				rn_free(cmap->shards[i].buckets);
+			}
+			rn_free(cmap->shards);
+			rn_free(cmap->slots);
+			return -1;
+		}
+		pthread_mutex_init(&cmap->shards[i].lock, NULL);
+	}
+	return 0;
+}
+
+/**
+ * Frees allocated memory inside a concurrent map. No other thread may
+ * use the map anymore. Retired nodes are released, nodes still in the
+ * map are not: use rn_cmap_flush first to release them.
+ *
+ * @param cmap Map to destroy
+ */
+void rn_cmap_destroy(rn_cmap_t *cmap)
+{
+	size_t i;
+
+	/* Nobody can be reading anymore */
+	cmap->epoch += 2;
+	for (i = 0; i < cmap->nbshards; i++) {
+		rn_cmap_collect(cmap, &cmap->shards[i]);
+		pthread_mutex_destroy(&cmap->shards[i].lock);
+		rn_free(cmap->shards[i].buckets);
+	}
+	rn_free(cmap->shards);
+	rn_free(cmap->slots);
+	cmap->shards = NULL;
+	cmap->slots = NULL;
+}
+
+/**
+ * Removes every node from a concurrent map. Nodes are retired and
+ * released once readers are done with them.
+ *
+ * @param cmap Map to flush
+ */
+void rn_cmap_flush(rn_cmap_t *cmap)
+{
+	size_t i;
+	size_t j;
+	rn_cmap_node_t *node;
+	rn_cmap_shard_t *shard;
+
+	for (i = 0; i < cmap->nbshards; i++) {
+		shard = &cmap->shards[i];
+		pthread_mutex_lock(&shard->lock);
+		for (j = 0; j < cmap->nbbuckets; j++) {
+			node = shard->buckets[j];
+			__atomic_store_n(&shard->buckets[j], NULL, __ATOMIC_RELEASE);
+			for (; node != NULL; node = node->next) {
+				rn_cmap_retire(cmap, shard, node);
+			}
+		}
+		shard->size = 0;
+		pthread_mutex_unlock(&shard->lock);
+	}
+	rn_cmap_reclaim(cmap);
+}
+
+/**
+ * Gets concurrent map size.
+ *
+ * @param cmap Map to use
+ *
+ * @return Number of nodes in the map
+ */
+size_t rn_cmap_size(rn_cmap_t *cmap)
+{
+	size_t i;
+	size_t size;
+
+	for (i = 0, size = 0; i < cmap->nbshards; i++) {
+		size += __atomic_load_n(&cmap->shards[i].size, __ATOMIC_RELAXED);
+	}
+	return size;
+}
+
+/**
+ * Opens a read section. Nodes got from the map stay valid until the
+ * section is closed with rn_cmap_leave. Sections can be nested, but
+ * must not span a task switch.
+ *
+ * @param cmap Map to use
+ * @param slot Reader slot of the calling thread, usually rn_scheduler_self()->id
+ */
+void rn_cmap_enter(rn_cmap_t *cmap, unsigned int slot)
+{
+	rn_cmap_slot_t *cur;
+
+	cur = &cmap->slots[slot];
+	if (cur->nesting++ == 0) {
+		__atomic_store_n(&cur->epoch, __atomic_load_n(&cmap->epoch, __ATOMIC_ACQUIRE), __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	}
+}
+
+/**
+ * Closes a read section.
+ *
+ * @param cmap Map to use
+ * @param slot Reader slot of the calling thread
+ */
+void rn_cmap_leave(rn_cmap_t *cmap, unsigned int slot)
+{
+	rn_cmap_slot_t *cur;
+
+	cur = &cmap->slots[slot];
+	if (--cur->nesting == 0) {
+		__atomic_store_n(&cur->epoch, 0, __ATOMIC_RELEASE);
+	}
+}
+
+/**
+ * Adds a node to a concurrent map. If an equal node is already in the
+ * map, it is replaced and retired. A removed node must not be added
+ * again before it is released.
+ *
+ * @param cmap Map to add to
+ * @param node Node to add
+ *
+ * @return 0 if the node was added, 1 if it replaced an equal node
+ */
+int rn_cmap_put(rn_cmap_t *cmap, rn_cmap_node_t *node)
+{
+	int ret;
+	rn_cmap_node_t *cur;
+	rn_cmap_node_t **head;
+	rn_cmap_node_t **prev;
+	rn_cmap_shard_t *shard;
+
+	ret = 0;
+	node->hash = cmap->hash(node);
+	shard = rn_cmap_shard(cmap, node->hash);
+	head = rn_cmap_bucket(cmap, shard, node->hash);
+	pthread_mutex_lock(&shard->lock);
+	for (prev = head; (cur = *prev) != NULL; prev = &cur->next) {
+		if (cur->hash == node->hash && cmap->compare(cur, node) == 0) {
+			break;
+		}
+	}
+	if (cur != NULL) {
+		/* Readers on the old node still reach the rest of the chain */
+		node->next = cur->next;
+		__atomic_store_n(prev, node, __ATOMIC_RELEASE);
+		rn_cmap_retire(cmap, shard, cur);
+		ret = 1;
+	} else {
+		node->next = *head;
+		__atomic_store_n(head, node, __ATOMIC_RELEASE);
+		__atomic_store_n(&shard->size, shard->size + 1, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&shard->lock);
+	if (shard->nbretired >= RN_CMAP_RECLAIM) {
+		rn_cmap_advance(cmap);
+		rn_cmap_collect(cmap, shard);
+	}
+	return ret;
+}
+
+/**
+ * Gets a node from a concurrent map. The caller must be in a read
+ * section, the returned node is valid until the section is closed.
+ *
+ * @param cmap Map to use
+ * @param node Dummy node used for comparison
+ *
+ * @return The matching node or NULL if not found.
+ */
+rn_cmap_node_t *rn_cmap_get(rn_cmap_t *cmap, rn_cmap_node_t *node)
+{
+	rn_cmap_node_t *cur;
+	rn_cmap_shard_t *shard;
+
+	node->hash = cmap->hash(node);
+	shard = rn_cmap_shard(cmap, node->hash);
+	cur = __atomic_load_n(rn_cmap_bucket(cmap, shard, node->hash), __ATOMIC_ACQUIRE);
+	while (cur != NULL) {
+		if (cur->hash == node->hash && cmap->compare(cur, node) == 0) {
+			return cur;
+		}
+		cur = __atomic_load_n(&cur->next, __ATOMIC_ACQUIRE);
+	}
+	return NULL;
+}
+
+/**
+ * Removes a node from a concurrent map. The node is retired and
+ * released once readers are done with it.
+ *
+ * @param cmap Map to use
+ * @param node Node to remove
+ *
+ * @return 0 on success, or -1 if the node is not in the map
+ */
+int rn_cmap_remove(rn_cmap_t *cmap, rn_cmap_node_t *node)
+{
+	rn_cmap_node_t *cur;
+	rn_cmap_node_t **prev;
+	rn_cmap_shard_t *shard;
+
+	shard = rn_cmap_shard(cmap, node->hash);
+	pthread_mutex_lock(&shard->lock);
+	for (prev = rn_cmap_bucket(cmap, shard, node->hash); (cur = *prev) != NULL; prev = &cur->next) {
+		if (cur == node) {
+			break;
+		}
+	}
+	if (cur == NULL) {
+		pthread_mutex_unlock(&shard->lock);
+		return -1;
+	}
+	__atomic_store_n(prev, node->next, __ATOMIC_RELEASE);
+	__atomic_store_n(&shard->size, shard->size - 1, __ATOMIC_RELAXED);
+	rn_cmap_retire(cmap, shard, node);
+	pthread_mutex_unlock(&shard->lock);
+	if (shard->nbretired >= RN_CMAP_RECLAIM) {
+		rn_cmap_advance(cmap);
+		rn_cmap_collect(cmap, shard);
+	}
+	return 0;
+}
+
+/**
+ * Releases every retired node which cannot be reached by readers
+ * anymore. Nodes are otherwise released by batches of RN_CMAP_RECLAIM
+ * on updates.
+ *
+ * @param cmap Map to use
+ */
+void rn_cmap_reclaim(rn_cmap_t *cmap)
+{
+	size_t i;
+
+	rn_cmap_advance(cmap);
+	for (i = 0; i < cmap->nbshards; i++) {
+		rn_cmap_collect(cmap, &cmap->shards[i]);
+	}
+}
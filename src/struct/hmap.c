@@ -0,0 +1,445 @@
+/**
+ * @file   hmap.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  Open addressing hash table functions. Slots are probed by
+ *         groups of RN_HMAP_GROUP control bytes, each holding 7 bits of
+ *         the node hash, so that most mismatches never reach the node.
+ *         When the table grows, the previous table is kept and moved
+ *         to the new one a few groups at a time, on each update.
+ *
+ *
+ */
+
+#include "rinoo/struct/module.h"
+
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+#define RN_HMAP_EMPTY		0x80
+#define RN_HMAP_DELETED		0xfe
+#define RN_HMAP_NOTFOUND	((size_t) -1)
+
+#define rn_hmap_h1(hash)	((hash) >> 7)
+#define rn_hmap_h2(hash)	((uint8_t) ((hash) & 0x7f))
+#define rn_hmap_isfull(ctrl)	(((ctrl) & 0x80) == 0)
+
+/**
+ * Gets the slots of a group matching a control byte.
+ *
+ * @param ctrl Pointer to the group control bytes
+ * @param value Control byte to look for
+ *
+ * @return Bit mask of the matching slots
+ */
+static inline uint32_t rn_hmap_match(const uint8_t *ctrl, uint8_t value)
+{
+#ifdef __SSE2__
+	__m128i group;
+
+	group = _mm_loadu_si128((const __m128i *) ctrl);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value)));
+#else
+	int i;
+	uint32_t mask;
+
+	for (i = 0, mask = 0; i < RN_HMAP_GROUP; i++) {
+		mask |= (uint32_t) (ctrl[i] == value) << i;
+	}
+	return mask;
+#endif
+}
+
+/**
+ * Gets the empty or deleted slots of a group.
+ *
+ * @param ctrl Pointer to the group control bytes
+ *
+ * @return Bit mask of the free slots
+ */
+static inline uint32_t rn_hmap_match_free(const uint8_t *ctrl)
+{
+#ifdef __SSE2__
+	return _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) ctrl));
+#else
+	int i;
+	uint32_t mask;
+
+	for (i = 0, mask = 0; i < RN_HMAP_GROUP; i++) {
+		mask |= (uint32_t) (ctrl[i] >> 7) << i;
+	}
+	return mask;
+#endif
+}
+
+/**
+ * Gets the table capacity needed to hold a number of nodes.
+ *
+ * @param size Number of nodes
+ *
+ * @return Capacity, a power of two multiple of RN_HMAP_GROUP
+ */
+static size_t rn_hmap_capacity(size_t size)
+{
+	size_t capacity;
+
+	capacity = RN_HMAP_GROUP;
+	while (capacity * 7 < size * 8) {
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+/**
+ * Allocates table control bytes and slots.
+ *
+ * @param table Pointer to the table to initialize
+ * @param capacity Table capacity
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_hmap_table(rn_hmap_table_t *table, size_t capacity)
+{
+	table->ctrl = rn_malloc(capacity + capacity * sizeof(*table->slots));
+	if (table->ctrl == NULL) {
+		return -1;
+	}
+	memset(table->ctrl, RN_HMAP_EMPTY, capacity);
+	table->slots = (rn_hmap_node_t **) (table->ctrl + capacity);
+	table->capacity = capacity;
+	table->used = 0;
+	return 0;
+}
+
+/**
+ * Releases table memory.
+ *
+ * @param table Pointer to the table to release
+ */
+static void rn_hmap_table_destroy(rn_hmap_table_t *table)
+{
+	if (table->ctrl != NULL) {
+		rn_free(table->ctrl);
+		table->ctrl = NULL;
+		table->slots = NULL;
+	}
+	table->capacity = 0;
+	table->used = 0;
+}
+
+/**
+ * Checks if a table can take one more node.
+ *
+ * @param table Pointer to the table
+ *
+ * @return true if a node can be inserted, otherwise false
+ */
+static inline bool rn_hmap_table_hasroom(rn_hmap_table_t *table)
+{
+	return ((table->used + 1) * 8 <= table->capacity * 7);
+}
+
+/**
+ * Looks for a node in a table.
+ *
+ * @param hmap Pointer to the hash table
+ * @param table Pointer to the table to search
+ * @param node Node to look for, with its hash set
+ * @param identity Whether to match the node itself instead of an equal node
+ *
+ * @return Slot index or RN_HMAP_NOTFOUND
+ */
+static size_t rn_hmap_table_find(rn_hmap_t *hmap, rn_hmap_table_t *table, rn_hmap_node_t *node, bool identity)
+{
+	size_t i;
+	size_t step;
+	size_t mask;
+	size_t group;
+	uint8_t *ctrl;
+	uint32_t match;
+	rn_hmap_node_t *cur;
+
+	mask = table->capacity / RN_HMAP_GROUP - 1;
+	group = rn_hmap_h1(node->hash) & mask;
+	for (step = 1; step <= mask + 1; step++) {
+		ctrl = table->ctrl + group * RN_HMAP_GROUP;
+		for (match = rn_hmap_match(ctrl, rn_hmap_h2(node->hash)); match != 0; match &= match - 1) {
+			i = group * RN_HMAP_GROUP + __builtin_ctz(match);
+			cur = table->slots[i];
+			if (cur == node) {
+				return i;
+			}
+			if (!identity && cur->hash == node->hash && hmap->compare(cur, node) == 0) {
+				return i;
+			}
+		}
+		if (rn_hmap_match(ctrl, RN_HMAP_EMPTY) != 0) {
+			break;
+		}
+		/* Triangular probing visits every group once */
+		group = (group + step) & mask;
+	}
+	return RN_HMAP_NOTFOUND;
+}
+
+/**
+ * Inserts a node in a table. The table must have room for it.
+ *
+ * @param table Pointer to the table
+ * @param node Node to insert, with its hash set
+ */
+static void rn_hmap_table_insert(rn_hmap_table_t *table, rn_hmap_node_t *node)
+{
+	size_t i;
+	size_t step;
+	size_t mask;
+	size_t group;
+	uint32_t match;
+
+	mask = table->capacity / RN_HMAP_GROUP - 1;
+	group = rn_hmap_h1(node->hash) & mask;
+	for (step = 1; (match = rn_hmap_match_free(table->ctrl + group * RN_HMAP_GROUP)) == 0; step++) {
+		group = (group + step) & mask;
+	}
+	i = group * RN_HMAP_GROUP + __builtin_ctz(match);
+	if (table->ctrl[i] == RN_HMAP_EMPTY) {
+		table->used++;
+	}
+	table->ctrl[i] = rn_hmap_h2(node->hash);
+	table->slots[i] = node;
+}
+
+/**
+ * Erases a table slot. The slot is marked empty when no probing
+ * sequence can go through its group, deleted otherwise.
+ *
+ * @param table Pointer to the table
+ * @param i Slot index
+ */
+static void rn_hmap_table_erase(rn_hmap_table_t *table, size_t i)
+{
+	if (rn_hmap_match(table->ctrl + (i & ~(size_t) (RN_HMAP_GROUP - 1)), RN_HMAP_EMPTY) != 0) {
+		table->ctrl[i] = RN_HMAP_EMPTY;
+		table->used--;
+	} else {
+		table->ctrl[i] = RN_HMAP_DELETED;
+	}
+	table->slots[i] = NULL;
+}
+
+/**
+ * Moves old table nodes to the current table.
+ *
+ * @param hmap Pointer to the hash table
+ * @param count Number of old table slots to process
+ */
+static void rn_hmap_migrate(rn_hmap_t *hmap, size_t count)
+{
+	size_t i;
+	size_t end;
+
+	if (hmap->old.ctrl == NULL) {
+		return;
+	}
+	end = hmap->migrated + count;
+	if (end > hmap->old.capacity) {
+		end = hmap->old.capacity;
+	}
+	for (i = hmap->migrated; i < end; i++) {
+		if (!rn_hmap_isfull(hmap->old.ctrl[i])) {
+			continue;
+		}
+		if (!rn_hmap_table_hasroom(&hmap->table)) {
+			/* The next insertion will grow the table */
+			break;
+		}
+		rn_hmap_table_insert(&hmap->table, hmap->old.slots[i]);
+		/* Keeps probing sequences of remaining nodes */
+		hmap->old.ctrl[i] = RN_HMAP_DELETED;
+	}
+	hmap->migrated = i;
+	if (hmap->migrated == hmap->old.capacity) {
+		rn_hmap_table_destroy(&hmap->old);
+		hmap->migrated = 0;
+	}
+}
+
+/**
+ * Grows a hash table. A new table is allocated and becomes the current
+ * one, nodes will be moved from the previous table on next updates.
+ * If a previous resize is still in progress, its remaining nodes are
+ * moved right away.
+ *
+ * @param hmap Pointer to the hash table
+ *
+ * @return 0 on success, otherwise -1
+ */
+static int rn_hmap_grow(rn_hmap_t *hmap)
+{
+	size_t i;
+	rn_hmap_table_t table;
+
+	if (rn_hmap_table(&table, rn_hmap_capacity(2 * (hmap->size + 1))) != 0) {
+		return -1;
+	}
+	if (hmap->old.ctrl != NULL) {
+		for (i = hmap->migrated; i < hmap->old.capacity; i++) {
+			if (rn_hmap_isfull(hmap->old.ctrl[i])) {
+				rn_hmap_table_insert(&table, hmap->old.slots[i]);
+			}
+		}
+		rn_hmap_table_destroy(&hmap->old);
+	}
+	hmap->old = hmap->table;
+	hmap->table = table;
+	hmap->migrated = 0;
+	return 0;
+}
+
+/**
+ * Initializes a hash table.
+ *
+ * @param hmap Hash table to initialize
+ * @param size Expected number of nodes, the table grows past it
+ * @param hash Hash function, usually rn_hash_default() of the node key
+ * @param compare Hash table node compare function, returning 0 on equality
+ *
+ * @return 0 on success otherwise -1
+ */
+int rn_hmap(rn_hmap_t *hmap, size_t size, uint64_t (*hash)(rn_hmap_node_t *node), int (*compare)(rn_hmap_node_t *node1, rn_hmap_node_t *node2))
+{
+	hmap->size = 0;
+	hmap->migrated = 0;
+	hmap->hash = hash;
+	hmap->compare = compare;
+	memset(&hmap->old, 0, sizeof(hmap->old));
+	return rn_hmap_table(&hmap->table, rn_hmap_capacity(size));
+}
+
+/**
+ * Frees allocated memory inside a hash table.
+ *
+ * @param hmap Hash table to destroy
+ */
+void rn_hmap_destroy(rn_hmap_t *hmap)
+{
+	rn_hmap_table_destroy(&hmap->table);
+	rn_hmap_table_destroy(&hmap->old);
+	hmap->size = 0;
+}
+
+/**
+ * Flushes hash table content.
+ *
+ * @param hmap Hash table to flush
+ * @param delete Optional delete function to be called for each hash table node
+ */
+void rn_hmap_flush(rn_hmap_t *hmap, void (*delete)(rn_hmap_node_t *node))
+{
+	size_t i;
+
+	if (delete != NULL) {
+		for (i = 0; i < hmap->table.capacity; i++) {
+			if (rn_hmap_isfull(hmap->table.ctrl[i])) {
+				delete(hmap->table.slots[i]);
+			}
+		}
+		for (i = hmap->migrated; i < hmap->old.capacity; i++) {
+			if (rn_hmap_isfull(hmap->old.ctrl[i])) {
+				delete(hmap->old.slots[i]);
+			}
+		}
+	}
+	rn_hmap_table_destroy(&hmap->old);
+	memset(hmap->table.ctrl, RN_HMAP_EMPTY, hmap->table.capacity);
+	hmap->table.used = 0;
+	hmap->migrated = 0;
+	hmap->size = 0;
+}
+
+/**
+ * Gets hash table size.
+ *
+ * @param hmap Hash table to use
+ *
+ * @return Number of nodes in the hash table
+ */
+size_t rn_hmap_size(rn_hmap_t *hmap)
+{
+	return hmap->size;
+}
+
+/**
+ * Adds an element to a hash table.
+ * Equal nodes are not checked, rn_hmap_get returns any of them.
+ *
+ * @param hmap Hash table to add to
+ * @param node Hash table node to add
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_hmap_put(rn_hmap_t *hmap, rn_hmap_node_t *node)
+{
+	node->hash = hmap->hash(node);
+	rn_hmap_migrate(hmap, RN_HMAP_MIGRATE * RN_HMAP_GROUP);
+	if (!rn_hmap_table_hasroom(&hmap->table) && rn_hmap_grow(hmap) != 0) {
+		return -1;
+	}
+	rn_hmap_table_insert(&hmap->table, node);
+	hmap->size++;
+	return 0;
+}
+
+/**
+ * Gets a node from a hash table.
+ *
+ * @param hmap Hash table to use
+ * @param node Dummy node used for comparison
+ *
+ * @return The matching node or NULL if not found.
+ */
+rn_hmap_node_t *rn_hmap_get(rn_hmap_t *hmap, rn_hmap_node_t *node)
+{
+	size_t i;
+
+	node->hash = hmap->hash(node);
+	i = rn_hmap_table_find(hmap, &hmap->table, node, false);
+	if (i != RN_HMAP_NOTFOUND) {
+		return hmap->table.slots[i];
+	}
+	if (hmap->old.ctrl != NULL) {
+		i = rn_hmap_table_find(hmap, &hmap->old, node, false);
+		if (i != RN_HMAP_NOTFOUND) {
+			return hmap->old.slots[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Removes an element from a hash table.
+ *
+ * @param hmap Hash table to use
+ * @param node Hash table node to remove
+ *
+ * @return 0 on success, otherwise -1
+ */
+int rn_hmap_remove(rn_hmap_t *hmap, rn_hmap_node_t *node)
+{
+	size_t i;
+
+	i = rn_hmap_table_find(hmap, &hmap->table, node, true);
+	if (i != RN_HMAP_NOTFOUND) {
+		rn_hmap_table_erase(&hmap->table, i);
+	} else if (hmap->old.ctrl != NULL &&
+		   (i = rn_hmap_table_find(hmap, &hmap->old, node, true)) != RN_HMAP_NOTFOUND) {
+		rn_hmap_table_erase(&hmap->old, i);
+	} else {
+		return -1;
+	}
+	hmap->size--;
+	rn_hmap_migrate(hmap, RN_HMAP_MIGRATE * RN_HMAP_GROUP);
+	return 0;
+}
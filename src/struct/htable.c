@@ -26,7 +26,7 @@ int rn_htable(rn_htable_t *rn_htable, size_t size, uint32_t (*hash)(rn_htable_no
 	rn_htable->table_size = size;
 	rn_htable->hash = hash;
 	rn_htable->compare = compare;
-	rn_htable->table = calloc(size, sizeof(*rn_htable->table));
+	rn_htable->table = rn_calloc(size, sizeof(*rn_htable->table));
 	if (rn_htable->table == NULL) {
 		return -1;
 	}
@@ -41,7 +41,7 @@ int rn_htable(rn_htable_t *rn_htable, size_t size, uint32_t (*hash)(rn_htable_no
 void rn_htable_destroy(rn_htable_t *rn_htable)
 {
 	if (rn_htable->table != NULL) {
-		free(rn_htable->table);
+		rn_free(rn_htable->table);
 		rn_htable->table = NULL;
 	}
 }
@@ -0,0 +1,188 @@
+/**
+ * @file   btree_put.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rinoo rn_btree unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define RN_BTREETEST_NB_ELEM	20000
+
+typedef struct mytest
+{
+	uint64_t key;
+	bool present;
+} tmytest;
+
+static size_t nbdeleted;
+static tmytest tab[RN_BTREETEST_NB_ELEM];
+
+void delete_func(void *value)
+{
+	tmytest *a = value;
+
+	XTEST(a->present);
+	a->present = false;
+	nbdeleted++;
+}
+
+/**
+ * Checks node occupancy and key bounds, returns the number of keys.
+ */
+static size_t check_node(void *node, unsigned int depth, bool root, uint64_t min, uint64_t max)
+{
+	size_t count;
+	unsigned int i;
+	rn_btree_leaf_t *leaf;
+	rn_btree_inner_t *inner;
+
+	if (depth == 0) {
+		leaf = node;
+		XTEST(root || leaf->nbkeys >= RN_BTREE_MIN);
+		for (i = 0; i < leaf->nbkeys; i++) {
+			XTEST(leaf->keys[i] >= min && leaf->keys[i] < max);
+			XTEST(i == 0 || leaf->keys[i - 1] < leaf->keys[i]);
+		}
+		return leaf->nbkeys;
+	}
+	inner = node;
+	XTEST(inner->nbkeys >= (root ? 1 : RN_BTREE_MIN - 1));
+	count = 0;
+	for (i = 0; i <= inner->nbkeys; i++) {
+		count += check_node(inner->children[i], depth - 1, false,
+				    (i == 0 ? min : inner->keys[i - 1]),
+				    (i == inner->nbkeys ? max : inner->keys[i]));
+	}
+	return count;
+}
+
+static void check(rn_btree_t *tree)
+{
+	size_t i;
+	size_t count;
+	rn_btree_iter_t iter;
+
+	if (tree->root != NULL) {
+		XTEST(check_node(tree->root, tree->depth, true, 0, UINT64_MAX) == rn_btree_size(tree));
+	}
+	for (i = 0, count = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		if (tab[i].present) {
+			XTEST(rn_btree_find(tree, tab[i].key) == &tab[i]);
+			count++;
+		} else {
+			XTEST(rn_btree_find(tree, tab[i].key) == NULL);
+		}
+	}
+	XTEST(count == rn_btree_size(tree));
+	/* Keys are 2 * i + 1, iteration is sorted */
+	count = 0;
+	if (rn_btree_head(tree, &iter) == 0) {
+		do {
+			XTEST(((tmytest *) rn_btree_iter_value(&iter))->key == rn_btree_iter_key(&iter));
+			XTEST(((tmytest *) rn_btree_iter_value(&iter))->present);
+			count++;
+		} while (rn_btree_next(&iter) == 0);
+	}
+	XTEST(count == rn_btree_size(tree));
+}
+
+static void check_seek(rn_btree_t *tree)
+{
+	size_t i;
+	size_t next;
+	rn_btree_iter_t iter;
+
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		/* Even keys are never in the tree */
+		for (next = i; next < RN_BTREETEST_NB_ELEM && !tab[next].present; next++);
+		if (next == RN_BTREETEST_NB_ELEM) {
+			XTEST(rn_btree_seek(tree, tab[i].key - 1, &iter) == -1);
+		} else {
+			XTEST(rn_btree_seek(tree, tab[i].key - 1, &iter) == 0);
+			XTEST(rn_btree_iter_key(&iter) == tab[next].key);
+		}
+	}
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	size_t i;
+	size_t j;
+	void *value;
+	rn_btree_t tree;
+	rn_btree_iter_t iter;
+
+	XTEST(rn_btree(&tree) == 0);
+	XTEST(rn_btree_head(&tree, &iter) == -1);
+	XTEST(rn_btree_seek(&tree, 42, &iter) == -1);
+	XTEST(rn_btree_remove(&tree, 42, NULL) == -1);
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		tab[i].key = 2 * i + 1;
+	}
+	/* Random insertion order */
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		j = (i * 7919) % RN_BTREETEST_NB_ELEM;
+		XTEST(rn_btree_put(&tree, tab[j].key, &tab[j]) == 0);
+		tab[j].present = true;
+		XTEST(rn_btree_size(&tree) == i + 1);
+	}
+	check(&tree);
+	check_seek(&tree);
+	XTEST(rn_btree_put(&tree, tab[0].key, &tab[0]) == 1);
+	XTEST(rn_btree_size(&tree) == RN_BTREETEST_NB_ELEM);
+	/* Removes two keys out of three, in a different order */
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		j = (i * 104729) % RN_BTREETEST_NB_ELEM;
+		if (j % 3 != 0) {
+			XTEST(rn_btree_remove(&tree, tab[j].key, &value) == 0);
+			XTEST(value == &tab[j]);
+			XTEST(rn_btree_remove(&tree, tab[j].key, NULL) == -1);
+			tab[j].present = false;
+		}
+	}
+	check(&tree);
+	check_seek(&tree);
+	/* Sequential insertion, then removal from both ends */
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		if (!tab[i].present) {
+			XTEST(rn_btree_put(&tree, tab[i].key, &tab[i]) == 0);
+			tab[i].present = true;
+		}
+	}
+	check(&tree);
+	for (i = 0; i < RN_BTREETEST_NB_ELEM / 4; i++) {
+		XTEST(rn_btree_remove(&tree, tab[i].key, NULL) == 0);
+		tab[i].present = false;
+		XTEST(rn_btree_remove(&tree, tab[RN_BTREETEST_NB_ELEM - 1 - i].key, NULL) == 0);
+		tab[RN_BTREETEST_NB_ELEM - 1 - i].present = false;
+	}
+	check(&tree);
+	nbdeleted = 0;
+	rn_btree_flush(&tree, delete_func);
+	XTEST(nbdeleted == RN_BTREETEST_NB_ELEM / 2);
+	XTEST(rn_btree_size(&tree) == 0);
+	check(&tree);
+	/* Emptying the tree key by key */
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		XTEST(rn_btree_put(&tree, tab[i].key, &tab[i]) == 0);
+		tab[i].present = true;
+	}
+	for (i = 0; i < RN_BTREETEST_NB_ELEM; i++) {
+		XTEST(rn_btree_remove(&tree, tab[i].key, NULL) == 0);
+		tab[i].present = false;
+	}
+	XTEST(tree.root == NULL);
+	check(&tree);
+	rn_btree_flush(&tree, NULL);
+	XPASS();
+}
@@ -0,0 +1,229 @@
+/**
+ * @file   cmap_put.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rinoo rn_cmap unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define RN_CMAPTEST_NB_ELEM	10000
+#define RN_CMAPTEST_NB_KEYS	256
+#define RN_CMAPTEST_NB_POOL	4096
+#define RN_CMAPTEST_NB_READERS	4
+#define RN_CMAPTEST_NB_WRITERS	2
+#define RN_CMAPTEST_NB_LOOPS	50000
+
+enum {
+	STATE_FREE = 0,
+	STATE_USED
+};
+
+typedef struct mytest
+{
+	uint64_t val;
+	int state;
+	rn_cmap_node_t node;
+} tmytest;
+
+static size_t nbreleased;
+static tmytest tab[RN_CMAPTEST_NB_ELEM];
+static tmytest pool[RN_CMAPTEST_NB_WRITERS][RN_CMAPTEST_NB_POOL];
+static rn_cmap_t stress;
+static volatile int stop;
+
+uint64_t hash_func(rn_cmap_node_t *node)
+{
+	tmytest *a = container_of(node, tmytest, node);
+
+	return rn_hash_default(&a->val, sizeof(a->val));
+}
+
+int cmp_func(rn_cmap_node_t *node1, rn_cmap_node_t *node2)
+{
+	tmytest *a = container_of(node1, tmytest, node);
+	tmytest *b = container_of(node2, tmytest, node);
+
+	return (a->val == b->val ? 0 : 1);
+}
+
+void release_func(rn_cmap_node_t *node)
+{
+	tmytest *a = container_of(node, tmytest, node);
+
+	XTEST(a->state != STATE_FREE);
+	__atomic_store_n(&a->state, STATE_FREE, __ATOMIC_RELEASE);
+	__atomic_add_fetch(&nbreleased, 1, __ATOMIC_RELAXED);
+}
+
+static void check(rn_cmap_t *cmap, size_t count, int present)
+{
+	size_t i;
+	tmytest dummy;
+	rn_cmap_node_t *node;
+
+	rn_cmap_enter(cmap, 0);
+	for (i = 0; i < count; i++) {
+		dummy.val = tab[i].val;
+		node = rn_cmap_get(cmap, &dummy.node);
+		if (present) {
+			XTEST(node == &tab[i].node);
+		} else {
+			XTEST(node == NULL);
+		}
+	}
+	rn_cmap_leave(cmap, 0);
+}
+
+static void api(void)
+{
+	size_t i;
+	rn_cmap_t cmap;
+	tmytest other;
+
+	XTEST(rn_cmap(&cmap, RN_CMAPTEST_NB_ELEM, 1, hash_func, cmp_func, release_func) == 0);
+	nbreleased = 0;
+	for (i = 0; i < RN_CMAPTEST_NB_ELEM; i++) {
+		tab[i].val = i * 7919 + 1;
+		tab[i].state = STATE_USED;
+		XTEST(rn_cmap_put(&cmap, &tab[i].node) == 0);
+		XTEST(rn_cmap_size(&cmap) == i + 1);
+	}
+	check(&cmap, RN_CMAPTEST_NB_ELEM, 1);
+	/* Replacing a node retires the previous one */
+	other.val = tab[0].val;
+	other.state = STATE_USED;
+	XTEST(rn_cmap_put(&cmap, &other.node) == 1);
+	XTEST(rn_cmap_size(&cmap) == RN_CMAPTEST_NB_ELEM);
+	XTEST(rn_cmap_remove(&cmap, &tab[0].node) == -1);
+	XTEST(rn_cmap_remove(&cmap, &other.node) == 0);
+	XTEST(rn_cmap_remove(&cmap, &other.node) == -1);
+	/* Nodes are not released while a reader may hold them */
+	rn_cmap_enter(&cmap, 0);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	XTEST(nbreleased == 0);
+	rn_cmap_leave(&cmap, 0);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	XTEST(nbreleased == 2);
+	/* Released nodes can be added again */
+	tab[0].state = STATE_USED;
+	XTEST(rn_cmap_put(&cmap, &tab[0].node) == 0);
+	for (i = 0; i < RN_CMAPTEST_NB_ELEM; i++) {
+		XTEST(rn_cmap_remove(&cmap, &tab[i].node) == 0);
+	}
+	XTEST(rn_cmap_size(&cmap) == 0);
+	check(&cmap, RN_CMAPTEST_NB_ELEM, 0);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	rn_cmap_reclaim(&cmap);
+	XTEST(nbreleased == 2 + RN_CMAPTEST_NB_ELEM);
+	for (i = 0; i < RN_CMAPTEST_NB_ELEM; i++) {
+		tab[i].state = STATE_USED;
+		XTEST(rn_cmap_put(&cmap, &tab[i].node) == 0);
+	}
+	rn_cmap_flush(&cmap);
+	XTEST(rn_cmap_size(&cmap) == 0);
+	check(&cmap, RN_CMAPTEST_NB_ELEM, 0);
+	rn_cmap_destroy(&cmap);
+	XTEST(nbreleased == 2 + 2 * RN_CMAPTEST_NB_ELEM);
+}
+
+static void *reader(void *arg)
+{
+	unsigned int slot = (unsigned int) (uintptr_t) arg;
+	uint64_t i;
+	tmytest dummy;
+	rn_cmap_node_t *node;
+
+	for (i = 0; !__atomic_load_n(&stop, __ATOMIC_RELAXED); i++) {
+		dummy.val = i % RN_CMAPTEST_NB_KEYS;
+		rn_cmap_enter(&stress, slot);
+		node = rn_cmap_get(&stress, &dummy.node);
+		if (node != NULL) {
+			XTEST(container_of(node, tmytest, node)->val == dummy.val);
+			XTEST(__atomic_load_n(&container_of(node, tmytest, node)->state, __ATOMIC_ACQUIRE) != STATE_FREE);
+		}
+		rn_cmap_leave(&stress, slot);
+	}
+	return NULL;
+}
+
+static void *writer(void *arg)
+{
+	size_t id = (size_t) (uintptr_t) arg;
+	size_t i;
+	size_t nb;
+	size_t cur;
+	tmytest *node;
+
+	for (i = 0, cur = 0; i < RN_CMAPTEST_NB_LOOPS; i++) {
+		/* Finds a node released by the map */
+		for (nb = 0; __atomic_load_n(&pool[id][cur].state, __ATOMIC_ACQUIRE) != STATE_FREE; nb++) {
+			if (nb == RN_CMAPTEST_NB_POOL) {
+				rn_cmap_reclaim(&stress);
+				nb = 0;
+			}
+			cur = (cur + 1) % RN_CMAPTEST_NB_POOL;
+		}
+		node = &pool[id][cur];
+		node->state = STATE_USED;
+		node->val = (i * 31 + id) % RN_CMAPTEST_NB_KEYS;
+		rn_cmap_put(&stress, &node->node);
+		if (i % 4 == 3) {
+			/* May already be replaced by the other writer */
+			rn_cmap_remove(&stress, &node->node);
+		}
+		cur = (cur + 1) % RN_CMAPTEST_NB_POOL;
+	}
+	return NULL;
+}
+
+static void concurrent(void)
+{
+	size_t i;
+	pthread_t readers[RN_CMAPTEST_NB_READERS];
+	pthread_t writers[RN_CMAPTEST_NB_WRITERS];
+
+	XTEST(rn_cmap(&stress, RN_CMAPTEST_NB_KEYS, RN_CMAPTEST_NB_READERS, hash_func, cmp_func, release_func) == 0);
+	nbreleased = 0;
+	stop = 0;
+	for (i = 0; i < RN_CMAPTEST_NB_READERS; i++) {
+		XTEST(pthread_create(&readers[i], NULL, reader, (void *) (uintptr_t) i) == 0);
+	}
+	for (i = 0; i < RN_CMAPTEST_NB_WRITERS; i++) {
+		XTEST(pthread_create(&writers[i], NULL, writer, (void *) (uintptr_t) i) == 0);
+	}
+	for (i = 0; i < RN_CMAPTEST_NB_WRITERS; i++) {
+		XTEST(pthread_join(writers[i], NULL) == 0);
+	}
+	__atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+	for (i = 0; i < RN_CMAPTEST_NB_READERS; i++) {
+		XTEST(pthread_join(readers[i], NULL) == 0);
+	}
+	XTEST(rn_cmap_size(&stress) <= RN_CMAPTEST_NB_KEYS);
+	rn_cmap_flush(&stress);
+	rn_cmap_destroy(&stress);
+	for (i = 0; i < RN_CMAPTEST_NB_POOL * RN_CMAPTEST_NB_WRITERS; i++) {
+		XTEST(pool[i / RN_CMAPTEST_NB_POOL][i % RN_CMAPTEST_NB_POOL].state == STATE_FREE);
+	}
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	api();
+	concurrent();
+	XPASS();
+}
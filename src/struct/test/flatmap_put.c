@@ -0,0 +1,95 @@
+/**
+ * @file   flatmap_put.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  RN_FLATMAP unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define RN_FLATMAPTEST_NB_ELEM	1000
+
+static int int_cmp(const int *a, const int *b)
+{
+	return (*a > *b) - (*a < *b);
+}
+
+static int header_cmp(const char * const *a, const char * const *b)
+{
+	return strcasecmp(*a, *b);
+}
+
+RN_FLATMAP(intmap, int, int, 8, int_cmp)
+RN_FLATMAP(headers, const char *, const char *, 16, header_cmp)
+
+static void check_ints(void)
+{
+	int i;
+	int key;
+	intmap_t map = { 0 };
+
+	for (i = 0; i < RN_FLATMAPTEST_NB_ELEM; i++) {
+		XTEST(intmap_put(&map, (i * 7919) % RN_FLATMAPTEST_NB_ELEM, i) == 0);
+	}
+	XTEST(intmap_size(&map) == RN_FLATMAPTEST_NB_ELEM);
+	/* Entries are sorted */
+	for (i = 0; i < RN_FLATMAPTEST_NB_ELEM; i++) {
+		XTEST(intmap_at(&map, i)->key == i);
+	}
+	for (i = 0; i < RN_FLATMAPTEST_NB_ELEM; i++) {
+		key = (i * 7919) % RN_FLATMAPTEST_NB_ELEM;
+		XTEST(*intmap_get(&map, &key) == i);
+	}
+	key = RN_FLATMAPTEST_NB_ELEM;
+	XTEST(intmap_get(&map, &key) == NULL);
+	XTEST(intmap_remove(&map, &key) == -1);
+	key = 42;
+	XTEST(intmap_put(&map, key, -42) == 1);
+	XTEST(*intmap_get(&map, &key) == -42);
+	for (i = 0; i < RN_FLATMAPTEST_NB_ELEM; i += 2) {
+		XTEST(intmap_remove(&map, &i) == 0);
+	}
+	XTEST(intmap_size(&map) == RN_FLATMAPTEST_NB_ELEM / 2);
+	for (i = 0; i < RN_FLATMAPTEST_NB_ELEM; i++) {
+		XTEST((intmap_get(&map, &i) != NULL) == (i % 2 == 1));
+	}
+	intmap_destroy(&map);
+}
+
+static void check_headers(void)
+{
+	const char *key;
+	headers_t map;
+
+	headers_init(&map);
+	XTEST(headers_put(&map, "Host", "localhost") == 0);
+	XTEST(headers_put(&map, "Content-Length", "42") == 0);
+	XTEST(headers_put(&map, "Accept", "*/*") == 0);
+	XTEST(headers_put(&map, "content-length", "43") == 1);
+	XTEST(headers_size(&map) == 3);
+	XTEST(map.entries.heap == NULL);
+	key = "CONTENT-LENGTH";
+	XTEST(strcmp(*headers_get(&map, &key), "43") == 0);
+	XTEST(strcmp(headers_at(&map, 0)->key, "Accept") == 0);
+	XTEST(strcmp(headers_at(&map, 2)->key, "Host") == 0);
+	key = "host";
+	XTEST(headers_remove(&map, &key) == 0);
+	XTEST(headers_get(&map, &key) == NULL);
+	headers_destroy(&map);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	check_ints();
+	check_headers();
+	XPASS();
+}
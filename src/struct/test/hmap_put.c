@@ -0,0 +1,123 @@
+/**
+ * @file   hmap_put.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  rinoo rn_hmap unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+#define RN_HMAPTEST_NB_ELEM	100000
+#define RN_HMAPTEST_NB_COLLIDE	2000
+
+typedef struct mytest
+{
+	uint64_t val;
+	bool present;
+	rn_hmap_node_t node;
+} tmytest;
+
+static size_t nbdeleted;
+static tmytest tab[RN_HMAPTEST_NB_ELEM];
+
+uint64_t hash_func(rn_hmap_node_t *node)
+{
+	tmytest *a = container_of(node, tmytest, node);
+
+	return rn_hash_default(&a->val, sizeof(a->val));
+}
+
+uint64_t collide_func(rn_hmap_node_t *unused(node))
+{
+	return 42;
+}
+
+int cmp_func(rn_hmap_node_t *node1, rn_hmap_node_t *node2)
+{
+	tmytest *a = container_of(node1, tmytest, node);
+	tmytest *b = container_of(node2, tmytest, node);
+
+	return (a->val == b->val ? 0 : 1);
+}
+
+void delete_func(rn_hmap_node_t *node)
+{
+	tmytest *a = container_of(node, tmytest, node);
+
+	XTEST(a->present);
+	a->present = false;
+	nbdeleted++;
+}
+
+static void check(rn_hmap_t *hmap, size_t count)
+{
+	size_t i;
+	tmytest dummy;
+	rn_hmap_node_t *node;
+
+	for (i = 0; i < count; i++) {
+		dummy.val = tab[i].val;
+		node = rn_hmap_get(hmap, &dummy.node);
+		if (tab[i].present) {
+			XTEST(node == &tab[i].node);
+		} else {
+			XTEST(node == NULL);
+		}
+	}
+}
+
+static void run(uint64_t (*hash)(rn_hmap_node_t *node), size_t count)
+{
+	size_t i;
+	rn_hmap_t hmap;
+
+	XTEST(rn_hmap(&hmap, 1, hash, cmp_func) == 0);
+	for (i = 0; i < count; i++) {
+		tab[i].val = i * 7919 + 1;
+		tab[i].present = true;
+		XTEST(rn_hmap_put(&hmap, &tab[i].node) == 0);
+		XTEST(rn_hmap_size(&hmap) == i + 1);
+	}
+	check(&hmap, count);
+	/* Removes every third node, while a resize may be in progress */
+	for (i = 0; i < count; i += 3) {
+		XTEST(rn_hmap_remove(&hmap, &tab[i].node) == 0);
+		XTEST(rn_hmap_remove(&hmap, &tab[i].node) == -1);
+		tab[i].present = false;
+	}
+	check(&hmap, count);
+	/* Put them back and remove others */
+	for (i = 0; i < count; i++) {
+		if (i % 3 == 0) {
+			XTEST(rn_hmap_put(&hmap, &tab[i].node) == 0);
+			tab[i].present = true;
+		} else if (i % 3 == 1) {
+			XTEST(rn_hmap_remove(&hmap, &tab[i].node) == 0);
+			tab[i].present = false;
+		}
+	}
+	check(&hmap, count);
+	XTEST(rn_hmap_size(&hmap) == count - (count + 1) / 3);
+	nbdeleted = 0;
+	rn_hmap_flush(&hmap, delete_func);
+	XTEST(nbdeleted == count - (count + 1) / 3);
+	XTEST(rn_hmap_size(&hmap) == 0);
+	check(&hmap, count);
+	rn_hmap_destroy(&hmap);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	run(hash_func, RN_HMAPTEST_NB_ELEM);
+	run(collide_func, RN_HMAPTEST_NB_COLLIDE);
+	XPASS();
+}
@@ -0,0 +1,105 @@
+/**
+ * @file   svector_add.c
+ * @author Reginald Lips <reginald.l@gmail.com> - Copyright 2026
+ * @date   Mon Oct 19 10:12:41 2026
+ *
+ * @brief  RN_SVECTOR unit test
+ *
+ *
+ */
+
+#include "rinoo/rinoo.h"
+
+typedef struct point {
+	int x;
+	int y;
+} point_t;
+
+RN_SVECTOR(points, point_t, 4)
+RN_SVECTOR(ints, int, 0)
+
+static void check_points(void)
+{
+	int i;
+	point_t point;
+	point_t more[3] = { { 100, 200 }, { 101, 201 }, { 102, 202 } };
+	points_t vector = { 0 };
+
+	XTEST(points_capacity(&vector) == 4);
+	for (i = 0; i < 4; i++) {
+		point.x = i;
+		point.y = i * 2;
+		XTEST(points_add(&vector, point) == 0);
+	}
+	/* Inline storage only */
+	XTEST(vector.heap == NULL);
+	XTEST(points_data(&vector) == vector.inl);
+	XTEST(points_size(&vector) == 4);
+	point.x = 4;
+	point.y = 8;
+	XTEST(points_add(&vector, point) == 0);
+	XTEST(vector.heap != NULL);
+	XTEST(points_capacity(&vector) == RN_SVECTOR_MIN_HEAP);
+	for (i = 0; i < 5; i++) {
+		XTEST(points_get(&vector, i)->x == i);
+		XTEST(points_get(&vector, i)->y == i * 2);
+	}
+	XTEST(points_get(&vector, 5) == NULL);
+	XTEST(points_append(&vector, more, ARRAY_SIZE(more)) == 0);
+	XTEST(points_size(&vector) == 8);
+	XTEST(points_get(&vector, 7)->x == 102);
+	/* Swap remove moves the last element */
+	XTEST(points_swap_remove(&vector, 1) == 0);
+	XTEST(points_size(&vector) == 7);
+	XTEST(points_get(&vector, 1)->x == 102);
+	XTEST(points_get(&vector, 6)->x == 101);
+	/* Ordered remove keeps the order */
+	XTEST(points_remove(&vector, 0) == 0);
+	XTEST(points_get(&vector, 0)->x == 102);
+	XTEST(points_get(&vector, 1)->x == 2);
+	XTEST(points_remove(&vector, 6) == -1);
+	XTEST(points_swap_remove(&vector, 6) == -1);
+	point.x = -1;
+	XTEST(points_insert(&vector, 0, point) == 0);
+	XTEST(points_insert(&vector, points_size(&vector), point) == 0);
+	XTEST(points_insert(&vector, points_size(&vector) + 1, point) == -1);
+	XTEST(points_get(&vector, 0)->x == -1);
+	XTEST(points_get(&vector, 1)->x == 102);
+	XTEST(points_get(&vector, points_size(&vector) - 1)->x == -1);
+	points_clear(&vector);
+	XTEST(points_size(&vector) == 0);
+	points_destroy(&vector);
+	XTEST(vector.heap == NULL);
+}
+
+static void check_ints(void)
+{
+	int i;
+	ints_t vector;
+
+	ints_init(&vector);
+	XTEST(ints_capacity(&vector) == 0);
+	XTEST(ints_reserve(&vector, 1000) == 0);
+	XTEST(ints_capacity(&vector) == 1000);
+	for (i = 0; i < 10000; i++) {
+		XTEST(ints_add(&vector, i) == 0);
+	}
+	XTEST(ints_size(&vector) == 10000);
+	for (i = 0; i < 10000; i++) {
+		XTEST(*ints_get(&vector, i) == i);
+	}
+	ints_destroy(&vector);
+}
+
+/**
+ * Main function for this unit test
+ *
+ *
+ * @return 0 if test passed
+ */
+int main()
+{
+	check_points();
+	check_ints();
+	XPASS();
+}
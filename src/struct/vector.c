@@ -29,10 +29,10 @@ int rn_vector_add(rn_vector_t *vector, void *item)
 	if (vector->size == vector->msize) {
 		msize = vector->msize * 2;
 		if (msize > 0) {
-			ptr = realloc(vector->ptr, sizeof(*vector->ptr) * msize);
+			ptr = rn_realloc(vector->ptr, sizeof(*vector->ptr) * vector->msize, sizeof(*vector->ptr) * msize);
 		} else {
 			msize = 8;
-			ptr = malloc(sizeof(*vector->ptr) * msize);
+			ptr = rn_malloc(sizeof(*vector->ptr) * msize);
 		}
 		if (ptr == NULL) {
 			return -1;
@@ -55,7 +55,7 @@ void rn_vector_destroy(rn_vector_t *vector)
 	if (vector == NULL || vector->msize == 0 || vector->ptr == NULL) {
 		return;
 	}
-	free(vector->ptr);
+	rn_free(vector->ptr);
 	vector->ptr = NULL;
 }
 